@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""
+Kernel benchmark comparison
+
+Extracts the '#BENCH ... #END' CSV block printed by App_BenchReport()
+(app_bench.c) from a console capture and compares it with a baseline
+capture, e.g. taken before an os_cfg.h change or on the previous commit.
+Failed checks of the '#CHECK ... #END' block are listed on stderr and make
+the script exit with status 3.
+
+Usage:
+    bench_cmp.py run.log                       print the results
+    bench_cmp.py run.log --csv out.csv         save the CSV block
+    bench_cmp.py run.log --baseline base.log   compare average cycles
+    bench_cmp.py run.log --baseline base.log --threshold 5
+                                               exit 2 if any benchmark got
+                                               more than 5 % slower
+"""
+
+import argparse
+import csv
+import io
+import sys
+
+
+def load(path):
+    """Returns (header dict, {(name, param): row}, [failed check names]) from a capture or CSV file."""
+    with open(path, encoding="latin-1") as f:
+        lines = [l.strip() for l in f]
+
+    hdr = {}
+    block = []
+    checks = []
+    failed = []
+    inside = None
+    for line in lines:
+        if line.startswith("#BENCH"):
+            inside = block = []
+            hdr = dict(kv.split("=", 1) for kv in line.split()[2:] if "=" in kv)
+        elif line.startswith("#CHECK"):
+            inside = checks = []
+            failed = []
+        elif line.startswith("#END"):
+            if inside is checks and line.split()[1:2] != ["PASS"]:
+                failed = [row["name"] for row in csv.DictReader(io.StringIO("\n".join(checks)))
+                          if row["result"] != "PASS"] or ["(dropped)"]
+            inside = None
+        elif inside is not None:
+            inside.append(line)
+    if not hdr:                                                 # Bare CSV file, e.g. written by --csv.
+        block = [l for l in lines if l]
+
+    if not block:
+        sys.exit("%s: no benchmark results found" % path)
+
+    rows = {}
+    for row in csv.DictReader(io.StringIO("\n".join(block))):
+        rows[(row["name"], int(row["param"]))] = {k: int(row[k]) for k in ("samples", "min", "avg", "max")}
+    return hdr, rows, failed
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("capture", help="console capture (or CSV) with the benchmark results")
+    ap.add_argument("--baseline", metavar="FILE", help="capture to compare against")
+    ap.add_argument("--csv", metavar="FILE", help="write the results as CSV")
+    ap.add_argument("--threshold", type=float, metavar="PCT",
+                    help="exit with status 2 if an average got more than PCT percent slower")
+    args = ap.parse_args()
+
+    hdr, rows, failed = load(args.capture)
+    base_hdr, base, _ = load(args.baseline) if args.baseline else ({}, None, [])
+
+    for h, path in ((hdr, args.capture), (base_hdr, args.baseline)):
+        if h.get("dropped", "0") != "0":
+            print("warning: %s: %s results dropped, the table in app_bench.h is too small" % (path, h["dropped"]),
+                  file=sys.stderr)
+
+    freq = int(hdr.get("ts_freq", "0"))
+    if base is not None and base_hdr.get("ts_freq") not in (None, hdr.get("ts_freq")):
+        print("warning: timestamp frequencies differ (%s vs %s Hz)" % (base_hdr["ts_freq"], hdr.get("ts_freq")),
+              file=sys.stderr)
+
+    title = "%-18s %5s %8s %8s %8s" % ("benchmark", "param", "min", "avg", "max")
+    if freq:
+        title += " %9s" % "avg_us"
+    if base is not None:
+        title += " %8s %8s" % ("base", "delta")
+    print(title)
+
+    regressed = []
+    for key in rows:
+        r = rows[key]
+        line = "%-18s %5d %8d %8d %8d" % (key[0], key[1], r["min"], r["avg"], r["max"])
+        if freq:
+            line += " %9.3f" % (r["avg"] * 1e6 / freq)
+        if base is not None:
+            b = base.get(key)
+            if b is None:
+                line += " %8s %8s" % ("-", "new")
+            else:
+                pct = 100.0 * (r["avg"] - b["avg"]) / b["avg"] if b["avg"] else 0.0
+                line += " %8d %+7.1f%%" % (b["avg"], pct)
+                if args.threshold is not None and pct > args.threshold:
+                    regressed.append(key)
+        print(line)
+
+    if args.csv:
+        with open(args.csv, "w", newline="") as f:
+            w = csv.writer(f)
+            w.writerow(["name", "param", "samples", "min", "avg", "max"])
+            for (name, param), r in rows.items():
+                w.writerow([name, param, r["samples"], r["min"], r["avg"], r["max"]])
+
+    if failed:
+        print("failed checks: %s" % ", ".join(failed), file=sys.stderr)
+        sys.exit(3)
+    if regressed:
+        print("regressions: %s" % ", ".join("%s/%d" % k for k in regressed), file=sys.stderr)
+        sys.exit(2)
+
+
+if __name__ == "__main__":
+    main()
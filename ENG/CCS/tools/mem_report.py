@@ -0,0 +1,387 @@
+#!/usr/bin/env python3
+"""
+Firmware memory budget report
+
+Breaks the RAM and flash usage of a firmware image down per module and per
+component (uCOS-III, uC-CPU, uC-LIB, BSP, application, run-time libraries)
+and lists the largest RAM consumers (task stacks, message pool, OSRdyList,
+Mem_Heap, driver buffers...). A report can be saved as JSON and used as the
+baseline of a later report to see what a change cost.
+
+Inputs:
+    - TI ARM linker map file (CCS: <ProjName>.map in the build configuration
+      folder, produced by linking with msp432p401r.cmd), or
+    - any ELF image (TI .out, GCC/host ELF). ELF images carry no per-object
+      attribution for global symbols, so they are broken down per output
+      section and per symbol instead of per module.
+
+Usage:
+    mem_report.py Debug/TIRSLK.map
+    mem_report.py Debug/TIRSLK.map --json budget.json
+    mem_report.py Debug/TIRSLK.map --baseline budget.json
+    mem_report.py Debug/TIRSLK.out --symbols 30
+
+As a CCS post-build step (Project Properties > Build > Steps):
+    python "${PROJECT_LOC}/tools/mem_report.py" "${BuildArtifactFileBaseName}.map"
+        --baseline "${PROJECT_LOC}/tools/mem_baseline.json"
+
+Per-symbol detail requires the objects to be compiled with
+--gen_data_subsections=on (TI) / -fdata-sections (GCC), which put every
+variable in its own '.bss:<name>' / '.data:<name>' input section.
+"""
+
+import argparse
+import fnmatch
+import json
+import re
+import struct
+import sys
+
+RAM = "ram"
+FLASH = "flash"
+
+# Component grouping, first match wins. Patterns match the module name
+# (object file name without path, or library name).
+GROUP_RULES = [
+    ("os_*",                "uCOS-III"),
+    ("cpu_bsp*",            "BSP"),
+    ("cpu_*",               "uC-CPU"),
+    ("lib_*",               "uC-LIB"),
+    ("bsp*",                "BSP"),
+    ("msp432_startup*",     "BSP"),
+    ("system_msp432*",      "BSP"),
+    ("rts*.lib",            "RTS library"),
+    ("*.lib",               "Libraries"),
+    ("*.a",                 "Libraries"),
+    ("(linker)*",           "Linker"),
+]
+GROUP_DEFAULT = "Application"
+
+
+# ------------------------------------------------------------------------------------------------
+#                                       TI LINKER MAP PARSER
+# ------------------------------------------------------------------------------------------------
+
+RE_MEM = re.compile(r"^\s+(\w+)\s+([0-9a-fA-F]{8})\s+([0-9a-fA-F]{8})\s+([0-9a-fA-F]{8})\s+"
+                    r"([0-9a-fA-F]{8})\s+([RWX ]+?)\s*(\S*)\s*$")
+RE_OUT_SECT = re.compile(r"^(\S+)?\s+(\*|\d+)\s+([0-9a-fA-F]{8})\s+([0-9a-fA-F]{8})\s*(.*)$")
+RE_IN_SECT = re.compile(r"^\s+([0-9a-fA-F]{8})\s+([0-9a-fA-F]{8})\s+(.*?)\s*$")
+RE_MODULE = re.compile(r"^(?:(\S+)\s+:\s+)?(\S+)\s+\(([^)]*)\)")
+
+
+def parse_ti_map(text, lib_detail):
+    """Returns (regions, entries). Each entry is a dict with module, section,
+    symbol, addr and size."""
+    regions = []
+    entries = []
+    state = None
+    out_sect = None
+    pending_name = None
+
+    for line in text.splitlines():
+        stripped = line.strip()
+
+        if stripped == "MEMORY CONFIGURATION":
+            state = "mem"
+            continue
+        if stripped == "SECTION ALLOCATION MAP":
+            state = "sect"
+            continue
+        if stripped in ("SEGMENT ALLOCATION MAP", "MODULE SUMMARY", "LINKER GENERATED COPY TABLES",
+                        "GLOBAL SYMBOLS: SORTED ALPHABETICALLY BY Name",
+                        "GLOBAL SYMBOLS: SORTED BY Symbol Address",
+                        "GLOBAL DATA SYMBOLS: SORTED BY DATA PAGE",
+                        "LINKER GENERATED HANDLER TABLE"):
+            state = None
+            continue
+
+        if state == "mem":
+            m = RE_MEM.match(line)
+            if m:
+                name, origin, length, used, _unused, attr, _fill = m.groups()
+                regions.append({
+                    "name": name,
+                    "origin": int(origin, 16),
+                    "length": int(length, 16),
+                    "used": int(used, 16),
+                    "kind": RAM if "W" in attr else FLASH,
+                })
+            continue
+
+        if state != "sect" or not stripped or stripped.startswith("-") or stripped.startswith("output") \
+                or stripped.startswith("section"):
+            continue
+
+        if not line[0].isspace():
+            m = RE_OUT_SECT.match(line)
+            if m:                                               # Output section header.
+                name = m.group(1) or pending_name
+                pending_name = None
+                attrs = m.group(5)
+                out_sect = {"name": name,
+                            "noload": any(a in attrs for a in ("COPY", "DSECT", "NOLOAD"))}
+            elif len(line.split()) == 1:                        # Long name, numbers on the next line.
+                pending_name = stripped
+            continue
+
+        if line.lstrip().startswith("*") and pending_name:      # Continuation of a long output section name.
+            m = RE_OUT_SECT.match(line)
+            if m:
+                out_sect = {"name": pending_name, "noload": "COPY" in m.group(5)}
+                pending_name = None
+            continue
+
+        m = RE_IN_SECT.match(line)
+        if not m or out_sect is None or out_sect["noload"]:
+            continue
+        addr = int(m.group(1), 16)
+        size = int(m.group(2), 16)
+        rest = m.group(3)
+        if size == 0:
+            continue
+
+        if rest.startswith("--HOLE--"):
+            module = "(linker) %s holes" % out_sect["name"]
+            in_sect = out_sect["name"]
+        elif rest.startswith("("):                              # Linker generated, e.g. (.cinit..data.load)
+            module = "(linker) %s" % out_sect["name"]
+            in_sect = rest[1:rest.find(")")] if ")" in rest else rest
+        else:
+            mm = RE_MODULE.match(rest)
+            if not mm:
+                continue
+            lib, obj, in_sect = mm.groups()
+            if lib:
+                module = "%s(%s)" % (lib, obj) if lib_detail else lib
+            else:
+                module = obj
+            module = re.sub(r"\.obj$|\.o$", "", module.replace("\\", "/").split("/")[-1])
+
+        symbol = in_sect.split(":", 1)[1] if ":" in in_sect else None
+        if symbol and symbol.startswith("retain"):
+            symbol = None
+        entries.append({"module": module, "section": out_sect["name"], "symbol": symbol,
+                        "addr": addr, "size": size})
+
+    return regions, entries
+
+
+# ------------------------------------------------------------------------------------------------
+#                                           ELF PARSER
+# ------------------------------------------------------------------------------------------------
+
+SHF_WRITE = 0x1
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+SHT_SYMTAB = 2
+STT_OBJECT = 1
+STT_FUNC = 2
+
+
+def parse_elf(data):
+    """Returns (regions, entries) from an ELF32/ELF64 image. Entries are per
+    symbol, the 'module' of an entry is its output section."""
+    if data[:4] != b"\x7fELF":
+        raise ValueError("not an ELF file")
+    is64 = data[4] == 2
+    end = "<" if data[5] == 1 else ">"
+
+    if is64:
+        shoff, = struct.unpack_from(end + "Q", data, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(end + "HHH", data, 0x3A)
+        sh_fmt = end + "IIQQQQIIQQ"
+    else:
+        shoff, = struct.unpack_from(end + "I", data, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(end + "HHH", data, 0x2E)
+        sh_fmt = end + "IIIIIIIIII"
+
+    sects = []
+    for i in range(shnum):
+        f = struct.unpack_from(sh_fmt, data, shoff + i * shentsize)
+        sects.append({"name_off": f[0], "type": f[1], "flags": f[2], "addr": f[3], "offset": f[4],
+                      "size": f[5], "link": f[6], "entsize": f[9]})
+    strtab = sects[shstrndx]
+
+    def cstr(sect, off):
+        start = sect["offset"] + off
+        return data[start:data.index(b"\0", start)].decode("latin-1")
+
+    for s in sects:
+        s["name"] = cstr(strtab, s["name_off"])
+
+    entries = []
+    for s in sects:
+        if s["type"] != SHT_SYMTAB:
+            continue
+        names = sects[s["link"]]
+        for off in range(s["offset"], s["offset"] + s["size"], s["entsize"]):
+            if is64:
+                st_name, st_info, _o, st_shndx, st_value, st_size = struct.unpack_from(end + "IBBHQQ", data, off)
+            else:
+                st_name, st_value, st_size, st_info, _o, st_shndx = struct.unpack_from(end + "IIIBBH", data, off)
+            if st_size == 0 or (st_info & 0xF) not in (STT_OBJECT, STT_FUNC) or not 0 < st_shndx < len(sects):
+                continue
+            sect = sects[st_shndx]
+            if not sect["flags"] & SHF_ALLOC:
+                continue
+            entries.append({"module": sect["name"], "section": sect["name"], "symbol": cstr(names, st_name),
+                            "addr": st_value, "size": st_size,
+                            "kind": RAM if sect["flags"] & SHF_WRITE else FLASH})
+
+    regions = []
+    for kind in (FLASH, RAM):
+        used = sum(s["size"] for s in sects
+                   if s["flags"] & SHF_ALLOC and bool(s["flags"] & SHF_WRITE) == (kind == RAM))
+        if kind == FLASH:                                       # Initialized RAM also needs a flash image.
+            used += sum(s["size"] for s in sects
+                        if s["flags"] & SHF_ALLOC and s["flags"] & SHF_WRITE and s["type"] != SHT_NOBITS)
+        regions.append({"name": kind.upper(), "origin": 0, "length": 0, "used": used, "kind": kind})
+    return regions, entries
+
+
+# ------------------------------------------------------------------------------------------------
+#                                             REPORT
+# ------------------------------------------------------------------------------------------------
+
+def classify(regions, entries):
+    for e in entries:
+        if "kind" in e:
+            continue
+        e["kind"] = FLASH
+        for r in regions:
+            if r["origin"] <= e["addr"] < r["origin"] + r["length"]:
+                e["kind"] = r["kind"]
+                break
+
+
+def group_of(module, rules):
+    for pattern, group in rules:
+        if fnmatch.fnmatch(module, pattern):
+            return group
+    return GROUP_DEFAULT
+
+
+def build_report(regions, entries, rules):
+    classify(regions, entries)
+    modules = {}
+    groups = {}
+    symbols = []
+    for e in entries:
+        mod = modules.setdefault(e["module"], {RAM: 0, FLASH: 0, "group": group_of(e["module"], rules)})
+        mod[e["kind"]] += e["size"]
+        grp = groups.setdefault(mod["group"], {RAM: 0, FLASH: 0})
+        grp[e["kind"]] += e["size"]
+        if e["kind"] == RAM:
+            symbols.append({"name": e["symbol"] or e["section"], "module": e["module"], "size": e["size"]})
+    symbols.sort(key=lambda s: -s["size"])
+    return {
+        "regions": regions,
+        "groups": groups,
+        "modules": modules,
+        "ram_symbols": symbols,
+        "total": {RAM: sum(m[RAM] for m in modules.values()),
+                  FLASH: sum(m[FLASH] for m in modules.values())},
+    }
+
+
+def fmt_delta(cur, base):
+    if base is None:
+        return "     new"
+    d = cur - base
+    return "%+8d" % d if d else "       ."
+
+
+def print_table(title, rows, base_rows, out):
+    print("\n%s" % title, file=out)
+    has_base = base_rows is not None
+    hdr = "  %-40s %8s %8s" % ("", "RAM", "Flash")
+    if has_base:
+        hdr += " %8s %8s" % ("dRAM", "dFlash")
+    print(hdr, file=out)
+    for name, row in sorted(rows.items(), key=lambda kv: (-kv[1][RAM], -kv[1][FLASH], kv[0])):
+        line = "  %-40s %8d %8d" % (name[:40], row[RAM], row[FLASH])
+        if has_base:
+            b = base_rows.get(name)
+            line += " %s %s" % (fmt_delta(row[RAM], b and b[RAM]), fmt_delta(row[FLASH], b and b[FLASH]))
+        print(line, file=out)
+    if has_base:
+        for name in sorted(set(base_rows) - set(rows)):
+            b = base_rows[name]
+            print("  %-40s %8s %8s %+8d %+8d" % (name[:40], "-", "-", -b[RAM], -b[FLASH]), file=out)
+
+
+def print_report(rep, base, nbr_sym, out):
+    print("MEMORY REGIONS", file=out)
+    for r in rep["regions"]:
+        pct = (100.0 * r["used"] / r["length"]) if r["length"] else 0.0
+        line = "  %-12s %-5s used %8d" % (r["name"], r["kind"], r["used"])
+        if r["length"]:
+            line += " of %8d (%5.1f%%)" % (r["length"], pct)
+        if base:
+            b = next((x for x in base["regions"] if x["name"] == r["name"]), None)
+            if b:
+                line += "  %s" % fmt_delta(r["used"], b["used"]).strip()
+        print(line, file=out)
+
+    print_table("COMPONENTS", rep["groups"], base and base["groups"], out)
+    print_table("MODULES", rep["modules"], base and base["modules"], out)
+
+    total = rep["total"]
+    line = "\n  %-40s %8d %8d" % ("Total", total[RAM], total[FLASH])
+    if base:
+        line += " %+8d %+8d" % (total[RAM] - base["total"][RAM], total[FLASH] - base["total"][FLASH])
+    print(line, file=out)
+
+    if nbr_sym:
+        print("\nLARGEST RAM CONSUMERS", file=out)
+        for s in rep["ram_symbols"][:nbr_sym]:
+            print("  %8d  %-40s %s" % (s["size"], s["name"][:40], s["module"]), file=out)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("image", help="TI linker map file or ELF image")
+    ap.add_argument("--json", metavar="FILE", help="also write the report as JSON (e.g. to use as a baseline)")
+    ap.add_argument("--baseline", metavar="FILE", help="JSON report to compare against")
+    ap.add_argument("--symbols", type=int, default=20, metavar="N", help="list the N largest RAM consumers")
+    ap.add_argument("--lib-detail", action="store_true", help="split libraries into their members")
+    ap.add_argument("--group", action="append", default=[], metavar="PATTERN=NAME",
+                    help="extra module grouping rule, checked before the built-in ones")
+    ap.add_argument("--max-ram", type=int, metavar="BYTES",
+                    help="exit with status 2 if the RAM total exceeds BYTES")
+    args = ap.parse_args()
+
+    rules = [tuple(g.split("=", 1)) for g in args.group] + GROUP_RULES
+
+    with open(args.image, "rb") as f:
+        data = f.read()
+    if data[:4] == b"\x7fELF":
+        regions, entries = parse_elf(data)
+    else:
+        regions, entries = parse_ti_map(data.decode("latin-1"), args.lib_detail)
+    if not entries:
+        sys.exit("%s: no section allocation found" % args.image)
+
+    rep = build_report(regions, entries, rules)
+
+    base = None
+    if args.baseline:
+        try:
+            with open(args.baseline) as f:
+                base = json.load(f)
+        except FileNotFoundError:
+            print("baseline %s not found, no diff" % args.baseline, file=sys.stderr)
+
+    print_report(rep, base, args.symbols, sys.stdout)
+
+    if args.json:
+        with open(args.json, "w") as f:
+            json.dump(rep, f, indent=1, sort_keys=True)
+
+    if args.max_ram is not None and rep["total"][RAM] > args.max_ram:
+        print("RAM budget exceeded: %d > %d bytes" % (rep["total"][RAM], args.max_ram), file=sys.stderr)
+        sys.exit(2)
+
+
+if __name__ == "__main__":
+    main()
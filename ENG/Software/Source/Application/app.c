@@ -40,6 +40,8 @@
 #include  <bsp_int.h>
 #include  <bsp_sys.h>
 #include  <app_cfg.h>
+#include  <app_stk.h>
+#include  <app_bench.h>
 #include  <cpu_cfg.h>
 #include  <lib_mem.h>
 #include  <lib_math.h>
@@ -77,7 +79,7 @@ static OS_TCB App_TaskStartTCB;
 static OS_TCB App_TaskSensorsTCB;
 
 static CPU_STK_SIZE App_TaskStartStk[APP_CFG_TASK_START_STK_SIZE];
-static CPU_STK_SIZE App_TaskSensorsStk[APP_CFG_TASK_START_STK_SIZE];
+static CPU_STK_SIZE App_TaskSensorsStk[APP_CFG_TASK_SENSORS_STK_SIZE];
 
 static CPU_INT16U RGB_Ctr;
 
@@ -159,12 +161,17 @@ int main(void)
 static void App_TaskStart(void *p_arg)
 {
   OS_ERR os_err;
+#if (APP_CFG_STK_MON_REPORT_PERIOD > 0u)
+  CPU_INT32U stk_mon_ctr;
+#endif
 
   (void) p_arg; /* See Note #1                                          */
 
   BSP_Init(); /* Start BSP and tick initialization                    */
   BSP_Tick_Init();
 
+  OS_TRACE_START(); /* TS timer now running, latch its freq. in the trace    */
+
   Board_Init();
 
   Math_Init();
@@ -177,6 +184,10 @@ static void App_TaskStart(void *p_arg)
   CPU_IntDisMeasMaxCurReset();
 #endif
 
+#if (APP_CFG_BENCH_EN == DEF_ENABLED)
+  App_BenchRun(); /* Before the app. tasks exist, see 'app_bench.c'.      */
+#endif
+
   APP_TRACE_INFO(("Creating Application Events...\n\r"));
   App_ObjCreate(); /* Create Application kernel objects                    */
 
@@ -186,10 +197,22 @@ static void App_TaskStart(void *p_arg)
   BSP_LED_Off(BSP_GPIO_LED_ALL);
 
   App_LED1_Dly_ms = 200u;
+#if (APP_CFG_STK_MON_REPORT_PERIOD > 0u)
+  stk_mon_ctr = 0u;
+#endif
 
   while (DEF_TRUE)
   { /* Task body, always written as an infinite loop.       */
     BSP_LED_Toggle(BSP_GPIO_LED1);
+    App_StkMonUpdate(); /* Record stack peaks, see App_StkMonReport().           */
+#if (APP_CFG_STK_MON_REPORT_PERIOD > 0u)
+    stk_mon_ctr++;
+    if (stk_mon_ctr >= APP_CFG_STK_MON_REPORT_PERIOD)
+    { /* Output the recommended stack sizes periodically.     */
+      stk_mon_ctr = 0u;
+      App_StkMonReport();
+    }
+#endif
     OSTimeDlyHMSM(0u, 0u, 1, 0,
     OS_OPT_TIME_HMSM_STRICT,
                   &os_err);
@@ -346,11 +369,15 @@ static void App_TaskSensors(void *p_arg)
   Motor_SetState(eMotor_PositionLeft, eMotor_StateActive);
   Motor_SetState(eMotor_PositionRight, eMotor_StateActive);
 
+  OSTaskPeriodSet((OS_TCB *) 0, /* Fixed control period, released on absolute ticks.    */
+                  (OS_TICK) ((APP_CFG_TASK_SENSORS_PERIOD_MS * OSCfg_TickRate_Hz) / 1000u),
+                  (OS_TICK) 0u,
+                  (OS_TICK) 0u,
+                  &err);
+
   while (DEF_ON)
   {
-    OSTimeDlyHMSM(0u, 0, 0, 20,
-    OS_OPT_TIME_HMSM_STRICT,
-                  &err);
+    OSTaskPeriodWait(&err); /* Overruns & jitter: see App_TaskSensorsTCB.Period...   */
 
     Motor_ControllerStep();
     myCurVal = LineSensor_GetBufferDirection();
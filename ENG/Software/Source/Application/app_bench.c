@@ -0,0 +1,1718 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can find our product's user manual, API reference, release notes and
+*               more information at https://doc.micrium.com.
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                      KERNEL PRIMITIVE BENCHMARKS
+*
+*                                          TI MSP-EXP432P401R
+*                                       LaunchPad Development Kit
+*
+* Filename      : app_bench.c
+* Version       : V1.00
+*
+* Note(s)       : (1) Every benchmark measures, with CPU_TS_TmrRd(), the time between two points of a kernel
+*                     operation & records the min/avg/max over APP_CFG_BENCH_ITER samples :
+*
+*                     ts_overhead          Two back-to-back timestamp reads (subtract from the others).
+*                     ctx_sw_task          OSTaskSuspend() of a task to the return of OSTaskResume() in the
+*                                          task it switches to (OSSched() + PendSV context switch).
+*                     isr_post_wakeup      OSTaskSemPost() in an ISR to the pending task running
+*                                          (OSIntExit() context switch).
+*                     sem_wakeup           OSSemPost() to the higher priority pending task running.
+*                     q_post_pend          OSQPost() + OSQPend() of one message, no waiter (throughput).
+*                     q_wakeup             OSQPost() to the higher priority pending task running.
+*                     flag_fanout          OSFlagPost() readying 'param' lower priority waiters.
+*                     mutex_pend_post      OSMutexPend() + OSMutexPost() of a free mutex.
+*                     mutex_handoff        OSMutexPost() to the higher priority waiter owning the mutex
+*                                          (includes undoing the priority inheritance).
+*                     tick_task            OS_TickTask list update, with 'param' tasks in the delay list.
+*                     mem_copy             Mem_Copy() of 'param' octets, word-aligned bufs.
+*                     mem_copy_unaligned   Mem_Copy() of 'param' octets, bufs not mutually word-aligned.
+*                     mem_set              Mem_Set() of 'param' octets.
+*                     mem_cmp              Mem_Cmp() of 'param' identical octets.
+*                     str_fmt_dec          Str_FmtDec_Int32S() of a number spread over the 32-bit range.
+*                     str_fmt_nbr          Str_FmtNbr_Int32S() of the same number, base 10.
+*                     str_snprintf         snprintf() "%d" of the same number.
+*                     str_fmt_fix_pt       Str_FmtFixPt_Int32S() of the same number, Q15 with 3 decimals.
+*                     str_fmt_lite         Str_FmtLite() of a telemetry line (fixed-point & 2 integers).
+*                     str_snprintf_fmt     snprintf() of the same line, the fixed-point value as a double.
+*                     str_parse_list       Str_ParseNbrList_Int32S() of a command line of 'param' integers.
+*                     str_strtol           strtol() of the same command line.
+*                     math_sin_q15         Math_SinQ15() of an angle spread over the full turn.
+*                     math_sincos_q31      Math_SinCosQ31() of the same angle.
+*                     math_atan2_16        Math_Atan2_Angle16() of a vector spread over the 32-bit range.
+*                     math_atan2_32        Math_Atan2_Angle32() of the same vector.
+*                     math_sqrt_64         Math_Hypot_Int32S() of the same vector (64-bit square root).
+*                     math_div             Integer division by a divisor spread over the 32-bit range.
+*                     math_div_recip       Math_DivRecip_Int32U() by the same divisor.
+*                     math_sin_fp32        Math_Sin_32() of the angle, in radians (if LIB_MATH_CFG_FP_EN).
+*                     math_atan2_fp32      Math_Atan2_32() of the vector         (if LIB_MATH_CFG_FP_EN).
+*                     math_rand_lcg        Math_Rand() (global seed, critical section).
+*                     math_rand_xoro       Math_RandXoro() of a generator owned by the benchmark.
+*                     math_rand_pcg        Math_RandPCG() of a generator owned by the benchmark.
+*                     math_rand_bounded    Math_RandXoroBounded() in [0, 'param').
+*                     math_rand_fill       Math_RandXoroFill() of 'param' octets.
+*
+*                 (2) 'mem_check' (see Note #9) cross-checks Mem_Copy(), Mem_Set() & Mem_Cmp() (C or assembly
+*                     versions, see 'lib_cfg.h') against octet loops for all sizes up to
+*                     APP_BENCH_MEM_CHK_SIZE_MAX & all alignments.
+*
+*                 (3) 'str_check' checks Str_FmtDec_Int32S() against snprintf() & parses back with
+*                     Str_ParseNbrList_Int32S() lines formatted with Str_FmtLite().
+*
+*                 (4) Results are printed with APP_CFG_TRACE as CSV between '#BENCH' & '#END' lines so that
+*                     captures of two builds can be compared (see 'ENG/CCS/tools/bench_cmp.py'), followed by the
+*                     checks (see Note #9).
+*
+*                 (5) 'budget_check' (if OS_CFG_TASK_BUDGET_EN) : a helper task that owns a mutex the benchmark
+*                     task waits on exhausts its CPU budget, & must keep the inherited priority while it owns the
+*                     mutex, then be demoted once it released it.
+*
+*                 (6) 'str_scan_check' compares Str_Len_N(), Str_Char_N(), Str_Cmp_N() & Str_Str_N()
+*                     (word-at-a-time if LIB_STR_CFG_WORD_EN) with octet loops, on random strings of random
+*                     lengths & alignments.
+*
+*                 (7) 'math_check' compares the lib_math trig & square root functions with the C library's
+*                     (double precision) sin(), cos(), atan2() & sqrt() on random arguments, against the error
+*                     bounds documented in 'lib_math.c', & checks the exact functions (integer square roots,
+*                     Math_DivRecip_Int32U(), Math_MacQ15()) with integer arithmetic.
+*
+*                 (8) 'rand_check' checks the PRNGs against known answers, i.e. the outputs of the authors'
+*                     reference implementations : PCG32 seeded with pcg32_srandom_r(42, 54) as in M. O'Neill's
+*                     pcg32-demo, & xoroshiro64** (D. Blackman & S. Vigna) from the state {1, 2}.  The bounded &
+*                     fill functions are checked against the same sequences.
+*
+*                 (9) The '*_check' functions are not timed : each case passes or fails, & they are reported
+*                     with PASS or FAIL in a separate '#CHECK' section (see 'App_BenchReport()  Note #3').
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <cpu.h>
+#include  <cpu_core.h>
+#include  <os.h>
+#include  <lib_def.h>
+#include  <lib_mem.h>
+#include  <lib_str.h>
+#include  <lib_math.h>
+#include  <bsp_int.h>
+#include  <app_cfg.h>
+#include  <app_bench.h>
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <math.h>
+
+
+#if (APP_CFG_BENCH_EN == DEF_ENABLED)
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_BENCH_FLAG                         ((OS_FLAGS)0x01u)
+#define  APP_BENCH_DLY_LONG                     ((OS_TICK)60000u)   /* Delay of the tick benchmark's idle tasks.        */
+
+#define  APP_BENCH_PRINT(x)                     ((void)(APP_CFG_TRACE x))
+
+#define  APP_BENCH_MEM_SIZE                           1024u     /* Large buf size of the lib_mem benchmarks.            */
+#define  APP_BENCH_MEM_SIZE_SMALL                       64u     /* Small buf size of the lib_mem benchmarks.            */
+#define  APP_BENCH_MEM_CHK_SIZE_MAX                     72u     /* Largest size checked by App_BenchMemChk().           */
+
+#define  APP_BENCH_STR_LEN                              48u     /* Buf size of the lib_str benchmarks.                  */
+#define  APP_BENCH_STR_NBR_LIST                          5u     /* Nbr of integers in App_BenchStrCmdLine.              */
+#define  APP_BENCH_STR_CHK_NBR                        1000u     /* Nbr of cases checked by App_BenchStrChk().           */
+#define  APP_BENCH_STR_SCAN_CHK_NBR                   2000u     /* Nbr of cases checked by App_BenchStrScanChk().       */
+#define  APP_BENCH_STR_SCAN_LEN_MAX                     64u     /* Longest random str of App_BenchStrScanChk().         */
+
+#define  APP_BENCH_MATH_RAND_BOUND                    1000u     /* Range of the bounded random nbr benchmark.           */
+#define  APP_BENCH_MATH_CHK_NBR                       1000u     /* Nbr of cases checked by App_BenchMathChk().          */
+#define  APP_BENCH_RAND_CHK_NBR                          8u     /* Nbr of known answers per PRNG (see Note #8).         */
+
+#define  APP_BENCH_MATH_2_PI                    6.283185307179586
+                                                                /* Max errors of App_BenchMathChk() (see 'lib_math.c'). */
+#define  APP_BENCH_MATH_ERR_Q15                 1.001           /*   Math_SinQ15() & Math_CosQ15(), in LSB.             */
+#define  APP_BENCH_MATH_ERR_Q31                41.1             /*   Math_SinCosQ31(), in LSB.                          */
+#define  APP_BENCH_MATH_ERR_ANGLE16             1.0             /*   Math_Atan2_Angle16(), in LSB.                      */
+#define  APP_BENCH_MATH_ERR_ANGLE32             3.2e-8          /*   Math_Atan2_Angle32(), in rad.                      */
+#define  APP_BENCH_MATH_ERR_FP32_SIN            2.0e-7          /*   Math_Sin_32() & Math_Cos_32().                     */
+#define  APP_BENCH_MATH_ERR_FP32_ATAN2          4.0e-7          /*   Math_Atan2_32(), in rad.                           */
+#define  APP_BENCH_MATH_ERR_FP32_SQRT           3.0e-7          /*   Math_Sqrt_32(), relative.                          */
+
+#define  APP_BENCH_BUDGET_TICKS                          2u     /* CPU budget of App_BenchBudgetChk()'s helper task ... */
+#define  APP_BENCH_BUDGET_PERIOD                      1000u     /* ... per replenishment period (longer than the chk).  */
+#define  APP_BENCH_BUDGET_PRIO                  (APP_CFG_BENCH_PRIO_LO + 1u)   /* Prio of the helper once demoted.      */
+
+
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+APP_BENCH_RESULT  App_BenchResultTbl[APP_BENCH_RESULT_NBR];
+CPU_INT32U        App_BenchResultCnt;
+CPU_INT32U        App_BenchResultDropped;
+
+APP_BENCH_CHK     App_BenchChkTbl[APP_BENCH_CHK_NBR];
+CPU_INT32U        App_BenchChkCnt;
+CPU_INT32U        App_BenchChkFailed;
+
+
+/*
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+static  OS_TCB             App_BenchTaskTCB[APP_CFG_BENCH_TASK_NBR];
+static  CPU_STK            App_BenchTaskStk[APP_CFG_BENCH_TASK_NBR][APP_CFG_BENCH_STK_SIZE];
+
+static  OS_SEM             App_BenchSem;
+static  OS_Q               App_BenchQ;
+static  OS_FLAG_GRP        App_BenchFlagGrp;
+static  OS_MUTEX           App_BenchMutex;
+
+static  CPU_ALIGN          App_BenchMemBuf[2][(APP_BENCH_MEM_SIZE + 2u * sizeof(CPU_ALIGN)) / sizeof(CPU_ALIGN)];
+
+static  const  CPU_CHAR    App_BenchStrCmdLine[] = "1234,-56789,42,2000000000,-7\r\n";
+static  const  CPU_CHAR    App_BenchStrScanChar[] = "abc\x81";  /* Random str chars, incl one > 0x80 & the NUL.       */
+
+                                                                /* PCG32, seed 42 & stream 54 (see Note #8).            */
+static  const  CPU_INT32U  App_BenchRandTblPCG[APP_BENCH_RAND_CHK_NBR] = {
+    0xA15C02B7u, 0x7B47F409u, 0xBA1D3330u, 0x83D2F293u, 0xBFA4784Bu, 0xCBED606Eu, 0xBFC6A3ADu, 0x812FFF6Du
+};
+
+                                                                /* xoroshiro64**, state {1, 2} (see Note #8).           */
+static  const  CPU_INT32U  App_BenchRandTblXoro[APP_BENCH_RAND_CHK_NBR] = {
+    0xE2AC153Fu, 0x30817EAAu, 0x607A3436u, 0xB030543Bu, 0xC1E30385u, 0x435A2FA5u, 0x97600274u, 0x4F21BC1Cu
+};
+
+static  APP_BENCH_RESULT   App_BenchResultOvf;                  /* Scratch result of the benchmarks that do not fit.    */
+static  APP_BENCH_RESULT  *App_BenchResultCur;                  /* Result the helper tasks & ISR record samples into.   */
+static  APP_BENCH_CHK      App_BenchChkOvf;                     /* Scratch check of the checks that do not fit.         */
+static  volatile  CPU_TS_TMR  App_BenchTsStart;                 /* Start of the sample in progress.                     */
+static  volatile  CPU_INT32U  App_BenchIntCtr;                  /* Nbr of samples taken by the ISR benchmark's task.    */
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+static  volatile  OS_PRIO     App_BenchBudgetPrio;              /* Prio of the budget helper once throttled.            */
+static  CPU_TS_TMR            App_BenchBudgetTimeout;           /* Max time the budget helper waits to be throttled.    */
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  APP_BENCH_RESULT  *App_BenchResultNew   (const  CPU_CHAR          *p_name,
+                                                         CPU_INT32U         param);
+
+static  void               App_BenchSample      (       APP_BENCH_RESULT  *p_res,
+                                                         CPU_TS_TMR         cycles);
+
+static  APP_BENCH_CHK     *App_BenchChkNew      (const  CPU_CHAR          *p_name);
+
+static  void               App_BenchChkCase     (       APP_BENCH_CHK     *p_chk,
+                                                         CPU_BOOLEAN        ok);
+
+static  void               App_BenchTaskCreate  (       CPU_INT32U         ix,
+                                                         OS_TASK_PTR        p_task,
+                                                         OS_PRIO            prio);
+
+static  void               App_BenchTaskDelAll  (void);
+
+static  void               App_BenchTS          (void);
+static  void               App_BenchCtxSw       (void);
+static  void               App_BenchISR_Wakeup  (void);
+static  void               App_BenchSemWakeup   (void);
+static  void               App_BenchQ_PostPend  (void);
+static  void               App_BenchQ_Wakeup    (void);
+static  void               App_BenchFlagFanout  (CPU_INT32U         nbr_waiters);
+static  void               App_BenchMutexPendPost(void);
+static  void               App_BenchMutexHandoff(void);
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+static  void               App_BenchBudgetChk   (void);
+#endif
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+static  void               App_BenchTick        (CPU_INT32U         nbr_dly);
+#endif
+static  void               App_BenchMem         (CPU_INT32U         size);
+static  void               App_BenchMemChk      (void);
+static  void               App_BenchStr         (void);
+static  void               App_BenchStrChk      (void);
+static  void               App_BenchStrScanChk  (void);
+static  void               App_BenchMath        (void);
+static  void               App_BenchMathChk     (void);
+static  double             App_BenchMathAngleErr(double             rad,
+                                                 double             rad_ref);
+static  void               App_BenchRandChk     (void);
+static  CPU_BOOLEAN        App_BenchRandFillChk (const  CPU_INT32U *p_buf,
+                                                 const  CPU_INT32U *p_tbl);
+
+static  void               App_BenchISR         (void);
+
+static  void               App_BenchTaskSuspend (void              *p_arg);
+static  void               App_BenchTaskTaskSem (void              *p_arg);
+static  void               App_BenchTaskSem     (void              *p_arg);
+static  void               App_BenchTaskQ       (void              *p_arg);
+static  void               App_BenchTaskFlag    (void              *p_arg);
+static  void               App_BenchTaskMutex   (void              *p_arg);
+static  void               App_BenchTaskDly     (void              *p_arg);
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+static  void               App_BenchTaskBudget  (void              *p_arg);
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            App_BenchRun()
+*
+* Description : Run all the kernel benchmarks & print the results.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) MUST be called from a task, after BSP_Tick_Init(), at priority APP_CFG_TASK_START_PRIO
+*                   & before the other application tasks are created so that they do not disturb the
+*                   measurements (see 'app_bench.h  DEFAULT CONFIGURATION  Note #4').
+*
+*               (2) Takes about (2 + log2(APP_CFG_BENCH_TASK_NBR)) * APP_CFG_BENCH_ITER ticks.
+*********************************************************************************************************
+*/
+
+void  App_BenchRun (void)
+{
+    CPU_INT32U  nbr;
+    OS_ERR      err;
+
+
+    App_BenchResultCnt     = 0u;
+    App_BenchResultDropped = 0u;
+    App_BenchChkCnt        = 0u;
+    App_BenchChkFailed     = 0u;
+
+    OSSemCreate(&App_BenchSem, (CPU_CHAR *)"Bench Sem", 0u, &err);
+    OSQCreate(&App_BenchQ, (CPU_CHAR *)"Bench Q", 1u, &err);
+    OSFlagCreate(&App_BenchFlagGrp, (CPU_CHAR *)"Bench Flags", (OS_FLAGS)0, &err);
+    OSMutexCreate(&App_BenchMutex, (CPU_CHAR *)"Bench Mutex", &err);
+
+    BSP_IntVectSet(APP_CFG_BENCH_INT_ID, App_BenchISR);
+    BSP_IntEn(APP_CFG_BENCH_INT_ID);
+
+    App_BenchTS();
+    App_BenchCtxSw();
+    App_BenchISR_Wakeup();
+    App_BenchSemWakeup();
+    App_BenchQ_PostPend();
+    App_BenchQ_Wakeup();
+    for (nbr = 1u; nbr <= APP_CFG_BENCH_TASK_NBR; nbr <<= 1u) {
+        App_BenchFlagFanout(nbr);
+    }
+    App_BenchMutexPendPost();
+    App_BenchMutexHandoff();
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+    App_BenchBudgetChk();
+#endif
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    App_BenchTick(0u);
+    App_BenchTick(APP_CFG_BENCH_TASK_NBR);
+#endif
+    App_BenchMemChk();
+    App_BenchMem(APP_BENCH_MEM_SIZE_SMALL);
+    App_BenchMem(APP_BENCH_MEM_SIZE);
+    App_BenchStrChk();
+    App_BenchStrScanChk();
+    App_BenchStr();
+    App_BenchMathChk();
+    App_BenchRandChk();
+    App_BenchMath();
+
+    BSP_IntDis(APP_CFG_BENCH_INT_ID);
+
+    OSSemDel(&App_BenchSem, OS_OPT_DEL_ALWAYS, &err);
+    OSQDel(&App_BenchQ, OS_OPT_DEL_ALWAYS, &err);
+    OSFlagDel(&App_BenchFlagGrp, OS_OPT_DEL_ALWAYS, &err);
+    OSMutexDel(&App_BenchMutex, OS_OPT_DEL_ALWAYS, &err);
+
+    App_BenchReport();
+}
+
+
+/*
+*********************************************************************************************************
+*                                          App_BenchReport()
+*
+* Description : Print the results of the last App_BenchRun().
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : App_BenchRun(),
+*               Application.
+*
+* Note(s)     : (1) Output format, cycles in CPU_TS timer counts :
+*
+*                       #BENCH v1 ts_freq=<Hz> prio_max=<n> tick_rate=<Hz> dropped=<n>
+*                       name,param,samples,min,avg,max
+*                       <name>,<param>,<samples>,<min>,<avg>,<max>
+*                       ...
+*                       #END
+*
+*               (2) 'dropped' is the number of benchmarks whose results did not fit in App_BenchResultTbl[]
+*                   (see 'App_BenchResultNew()  Note #1'); it MUST be 0 for a complete report.
+*
+*               (3) The checks follow, each with PASS if none of its cases failed or FAIL otherwise :
+*
+*                       #CHECK v1 failed=<n>
+*                       name,cases,errors,result
+*                       <name>,<cases>,<errors>,<PASS|FAIL>
+*                       ...
+*                       #END <PASS|FAIL>
+*
+*                   'failed' is App_BenchChkFailed (see 'App_BenchChkNew()  Note #1'); the last line is PASS
+*                   only if it is 0.
+*********************************************************************************************************
+*/
+
+void  App_BenchReport (void)
+{
+    APP_BENCH_RESULT  *p_res;
+    APP_BENCH_CHK     *p_chk;
+    const  CPU_CHAR   *p_verdict;
+    CPU_TS_TMR_FREQ    freq;
+    CPU_INT32U         ix;
+    CPU_ERR            err;
+
+
+    freq = CPU_TS_TmrFreqGet(&err);
+
+    APP_BENCH_PRINT(("#BENCH v1 ts_freq=%lu prio_max=%u tick_rate=%lu dropped=%lu\r\n",
+                     (unsigned long)freq,
+                     (unsigned int )OS_CFG_PRIO_MAX,
+                     (unsigned long)OSCfg_TickRate_Hz,
+                     (unsigned long)App_BenchResultDropped));
+    if (App_BenchResultDropped > 0u) {                          /* See Note #2.                                         */
+        APP_BENCH_PRINT(("#WARNING %lu results dropped, increase APP_BENCH_RESULT_NBR\r\n",
+                         (unsigned long)App_BenchResultDropped));
+    }
+    APP_BENCH_PRINT(("name,param,samples,min,avg,max\r\n"));
+
+    for (ix = 0u; ix < App_BenchResultCnt; ix++) {
+        p_res = &App_BenchResultTbl[ix];
+        if (p_res->Samples == 0u) {
+            continue;
+        }
+        APP_BENCH_PRINT(("%s,%lu,%lu,%lu,%lu,%lu\r\n",
+                         (const char  *)p_res->NamePtr,
+                         (unsigned long)p_res->Param,
+                         (unsigned long)p_res->Samples,
+                         (unsigned long)p_res->CyclesMin,
+                         (unsigned long)(p_res->CyclesTot / p_res->Samples),
+                         (unsigned long)p_res->CyclesMax));
+    }
+
+    APP_BENCH_PRINT(("#END\r\n"));
+                                                                /* See Note #3.                                         */
+    APP_BENCH_PRINT(("#CHECK v1 failed=%lu\r\n", (unsigned long)App_BenchChkFailed));
+    APP_BENCH_PRINT(("name,cases,errors,result\r\n"));
+
+    for (ix = 0u; ix < App_BenchChkCnt; ix++) {
+        p_chk = &App_BenchChkTbl[ix];
+        if (p_chk->Errs == 0u) {
+            p_verdict = "PASS";
+        } else {
+            p_verdict = "FAIL";
+        }
+        APP_BENCH_PRINT(("%s,%lu,%lu,%s\r\n",
+                         (const char  *)p_chk->NamePtr,
+                         (unsigned long)p_chk->Cases,
+                         (unsigned long)p_chk->Errs,
+                         (const char  *)p_verdict));
+    }
+
+    if (App_BenchChkFailed == 0u) {
+        p_verdict = "PASS";
+    } else {
+        p_verdict = "FAIL";
+    }
+    APP_BENCH_PRINT(("#END %s\r\n", (const char *)p_verdict));
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        App_BenchResultNew()
+*
+* Description : Allocate & initialize the next result entry.
+*
+* Argument(s) : p_name      Benchmark name.
+*
+*               param       Benchmark parameter.
+*
+* Return(s)   : Pointer to the result entry.
+*
+* Caller(s)   : Benchmark functions.
+*
+* Note(s)     : (1) Once App_BenchResultTbl[] is full, the benchmark records into a scratch entry that is NOT
+*                   reported & App_BenchResultDropped is incremented; the results already recorded are kept
+*                   & the report flags the missing ones (see 'App_BenchReport()  Note #2').
+*********************************************************************************************************
+*/
+
+static  APP_BENCH_RESULT  *App_BenchResultNew (const  CPU_CHAR    *p_name,
+                                                      CPU_INT32U   param)
+{
+    APP_BENCH_RESULT  *p_res;
+
+
+    if (App_BenchResultCnt < APP_BENCH_RESULT_NBR) {
+        p_res = &App_BenchResultTbl[App_BenchResultCnt];
+        App_BenchResultCnt++;
+    } else {                                                    /* See Note #1.                                         */
+        p_res = &App_BenchResultOvf;
+        App_BenchResultDropped++;
+    }
+    p_res->NamePtr   = p_name;
+    p_res->Param     = param;
+    p_res->Samples   = 0u;
+    p_res->CyclesMin = DEF_INT_32U_MAX_VAL;
+    p_res->CyclesMax = 0u;
+    p_res->CyclesTot = 0u;
+
+    App_BenchResultCur = p_res;
+
+    return (p_res);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          App_BenchSample()
+*
+* Description : Add a sample to a result.
+*
+* Argument(s) : p_res       Result to update.
+*
+*               cycles      Sample, in CPU_TS timer counts.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Benchmark & helper task functions.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  App_BenchSample (APP_BENCH_RESULT  *p_res,
+                               CPU_TS_TMR         cycles)
+{
+    p_res->Samples++;
+    p_res->CyclesTot += cycles;
+    if (p_res->CyclesMin > cycles) {
+        p_res->CyclesMin = cycles;
+    }
+    if (p_res->CyclesMax < cycles) {
+        p_res->CyclesMax = cycles;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          App_BenchChkNew()
+*
+* Description : Allocate & initialize the next check entry.
+*
+* Argument(s) : p_name      Check name.
+*
+* Return(s)   : Pointer to the check entry.
+*
+* Caller(s)   : Check functions.
+*
+* Note(s)     : (1) Once App_BenchChkTbl[] is full, the check records into a scratch entry that is NOT reported
+*                   & starts with a failed case, so that App_BenchChkFailed counts it & the report never passes
+*                   without it.
+*********************************************************************************************************
+*/
+
+static  APP_BENCH_CHK  *App_BenchChkNew (const  CPU_CHAR  *p_name)
+{
+    APP_BENCH_CHK  *p_chk;
+
+
+    if (App_BenchChkCnt < APP_BENCH_CHK_NBR) {
+        p_chk = &App_BenchChkTbl[App_BenchChkCnt];
+        App_BenchChkCnt++;
+    } else {
+        p_chk = &App_BenchChkOvf;
+    }
+    p_chk->NamePtr = p_name;
+    p_chk->Cases   = 0u;
+    p_chk->Errs    = 0u;
+    if (p_chk == &App_BenchChkOvf) {                            /* See Note #1.                                         */
+        App_BenchChkCase(p_chk, DEF_NO);
+    }
+
+    return (p_chk);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         App_BenchChkCase()
+*
+* Description : Add a case to a check.
+*
+* Argument(s) : p_chk       Check to update.
+*
+*               ok          DEF_YES if the case passed, DEF_NO otherwise.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Check functions.
+*
+* Note(s)     : (1) App_BenchChkFailed counts the check once, at its first failed case.
+*********************************************************************************************************
+*/
+
+static  void  App_BenchChkCase (APP_BENCH_CHK  *p_chk,
+                                CPU_BOOLEAN     ok)
+{
+    p_chk->Cases++;
+    if (ok != DEF_YES) {
+        if (p_chk->Errs == 0u) {                                /* See Note #1.                                         */
+            App_BenchChkFailed++;
+        }
+        p_chk->Errs++;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        App_BenchTaskCreate()
+*
+* Description : Create a benchmark helper task.
+*
+* Argument(s) : ix          Helper task index, 0 to APP_CFG_BENCH_TASK_NBR - 1.
+*
+*               p_task      Helper task function; its argument is its index.
+*
+*               prio        Helper task priority.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Benchmark functions.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  App_BenchTaskCreate (CPU_INT32U   ix,
+                                   OS_TASK_PTR  p_task,
+                                   OS_PRIO      prio)
+{
+    OS_ERR  err;
+
+
+    OSTaskCreate((OS_TCB     *)&App_BenchTaskTCB[ix],
+                 (CPU_CHAR   *)"Bench Task",
+                 (OS_TASK_PTR ) p_task,
+                 (void       *)(CPU_ADDR)ix,
+                 (OS_PRIO     ) prio,
+                 (CPU_STK    *)&App_BenchTaskStk[ix][0],
+                 (CPU_STK_SIZE)(APP_CFG_BENCH_STK_SIZE / 10u),
+                 (CPU_STK_SIZE) APP_CFG_BENCH_STK_SIZE,
+                 (OS_MSG_QTY  ) 0u,
+                 (OS_TICK     ) 0u,
+                 (void       *) 0,
+                 (OS_OPT      )(OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR),
+                 (OS_ERR     *)&err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        App_BenchTaskDelAll()
+*
+* Description : Delete all the benchmark helper tasks.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Benchmark functions.
+*
+* Note(s)     : (1) OSTaskDel() clears the TCB, a NULL stack pointer marks a helper that does not exist.
+*********************************************************************************************************
+*/
+
+static  void  App_BenchTaskDelAll (void)
+{
+    CPU_INT32U  ix;
+    OS_ERR      err;
+
+
+    for (ix = 0u; ix < APP_CFG_BENCH_TASK_NBR; ix++) {
+        if (App_BenchTaskTCB[ix].StkPtr != (CPU_STK *)0) {
+            OSTaskDel(&App_BenchTaskTCB[ix], &err);
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                            BENCHMARKS
+*
+* Note(s) : (1) Unless noted otherwise, helper tasks run at APP_CFG_BENCH_PRIO_HI & thus preempt the
+*               benchmark task as soon as they are made ready; they take the sample themselves.
+*********************************************************************************************************
+*/
+
+static  void  App_BenchTS (void)
+{
+    APP_BENCH_RESULT  *p_res;
+    CPU_TS_TMR         ts;
+    CPU_INT32U         i;
+
+
+    p_res = App_BenchResultNew("ts_overhead", 0u);
+    for (i = 0u; i < APP_CFG_BENCH_ITER; i++) {
+        ts = CPU_TS_TmrRd();
+        App_BenchSample(p_res, CPU_TS_TmrRd() - ts);
+    }
+}
+
+
+static  void  App_BenchCtxSw (void)
+{
+    APP_BENCH_RESULT  *p_res;
+    CPU_INT32U         i;
+    OS_ERR             err;
+
+
+    p_res = App_BenchResultNew("ctx_sw_task", 0u);
+    App_BenchTaskCreate(0u, App_BenchTaskSuspend, APP_CFG_BENCH_PRIO_HI);
+    for (i = 0u; i < APP_CFG_BENCH_ITER; i++) {
+        OSTaskResume(&App_BenchTaskTCB[0], &err);               /* Helper runs & suspends itself.                       */
+        App_BenchSample(p_res, CPU_TS_TmrRd() - App_BenchTsStart);
+    }
+    App_BenchTaskDelAll();
+}
+
+
+static  void  App_BenchISR_Wakeup (void)
+{
+    CPU_INT32U  i;
+
+
+    (void)App_BenchResultNew("isr_post_wakeup", 0u);
+    App_BenchIntCtr = 0u;
+    App_BenchTaskCreate(0u, App_BenchTaskTaskSem, APP_CFG_BENCH_PRIO_HI);
+    for (i = 0u; i < APP_CFG_BENCH_ITER; i++) {
+        CPU_REG_NVIC_SW_TRIG = (CPU_INT32U)APP_CFG_BENCH_INT_ID;
+        while (App_BenchIntCtr == i) {                          /* Wait for the ISR & the helper to run.                */
+            ;
+        }
+    }
+    App_BenchTaskDelAll();
+}
+
+
+static  void  App_BenchSemWakeup (void)
+{
+    CPU_INT32U  i;
+    OS_ERR      err;
+
+
+    (void)App_BenchResultNew("sem_wakeup", 0u);
+    App_BenchTaskCreate(0u, App_BenchTaskSem, APP_CFG_BENCH_PRIO_HI);
+    for (i = 0u; i < APP_CFG_BENCH_ITER; i++) {
+        App_BenchTsStart = CPU_TS_TmrRd();
+        OSSemPost(&App_BenchSem, OS_OPT_POST_1, &err);
+    }
+    App_BenchTaskDelAll();
+}
+
+
+static  void  App_BenchQ_PostPend (void)
+{
+    APP_BENCH_RESULT  *p_res;
+    CPU_TS_TMR         ts;
+    OS_MSG_SIZE        msg_size;
+    CPU_INT32U         i;
+    OS_ERR             err;
+
+
+    p_res = App_BenchResultNew("q_post_pend", 0u);
+    for (i = 0u; i < APP_CFG_BENCH_ITER; i++) {
+        ts = CPU_TS_TmrRd();
+        OSQPost(&App_BenchQ, (void *)&i, sizeof(i), OS_OPT_POST_FIFO, &err);
+        (void)OSQPend(&App_BenchQ, 0u, OS_OPT_PEND_NON_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+        App_BenchSample(p_res, CPU_TS_TmrRd() - ts);
+    }
+}
+
+
+static  void  App_BenchQ_Wakeup (void)
+{
+    CPU_INT32U  i;
+    OS_ERR      err;
+
+
+    (void)App_BenchResultNew("q_wakeup", 0u);
+    App_BenchTaskCreate(0u, App_BenchTaskQ, APP_CFG_BENCH_PRIO_HI);
+    for (i = 0u; i < APP_CFG_BENCH_ITER; i++) {
+        App_BenchTsStart = CPU_TS_TmrRd();
+        OSQPost(&App_BenchQ, (void *)&i, sizeof(i), OS_OPT_POST_FIFO, &err);
+    }
+    App_BenchTaskDelAll();
+}
+
+
+static  void  App_BenchFlagFanout (CPU_INT32U  nbr_waiters)
+{
+    APP_BENCH_RESULT  *p_res;
+    CPU_TS_TMR         ts;
+    CPU_INT32U         i;
+    OS_ERR             err;
+
+
+    p_res = App_BenchResultNew("flag_fanout", nbr_waiters);
+    for (i = 0u; i < nbr_waiters; i++) {                        /* Waiters at lower prio: the post only readies them.   */
+        App_BenchTaskCreate(i, App_BenchTaskFlag, APP_CFG_BENCH_PRIO_LO);
+    }
+    OSTimeDly(1u, OS_OPT_TIME_DLY, &err);                       /* Let the waiters pend.                                */
+
+    for (i = 0u; i < APP_CFG_BENCH_ITER; i++) {
+        ts = CPU_TS_TmrRd();
+        OSFlagPost(&App_BenchFlagGrp, APP_BENCH_FLAG, OS_OPT_POST_FLAG_SET, &err);
+        App_BenchSample(p_res, CPU_TS_TmrRd() - ts);
+        OSFlagPost(&App_BenchFlagGrp, APP_BENCH_FLAG, OS_OPT_POST_FLAG_CLR, &err);
+        OSTimeDly(1u, OS_OPT_TIME_DLY, &err);                   /* Let the waiters run & pend again.                    */
+    }
+    App_BenchTaskDelAll();
+}
+
+
+static  void  App_BenchMutexPendPost (void)
+{
+    APP_BENCH_RESULT  *p_res;
+    CPU_TS_TMR         ts;
+    CPU_INT32U         i;
+    OS_ERR             err;
+
+
+    p_res = App_BenchResultNew("mutex_pend_post", 0u);
+    for (i = 0u; i < APP_CFG_BENCH_ITER; i++) {
+        ts = CPU_TS_TmrRd();
+        OSMutexPend(&App_BenchMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSMutexPost(&App_BenchMutex, OS_OPT_POST_NONE, &err);
+        App_BenchSample(p_res, CPU_TS_TmrRd() - ts);
+    }
+}
+
+
+static  void  App_BenchMutexHandoff (void)
+{
+    CPU_INT32U  i;
+    OS_ERR      err;
+
+
+    (void)App_BenchResultNew("mutex_handoff", 0u);
+    App_BenchTaskCreate(0u, App_BenchTaskMutex, APP_CFG_BENCH_PRIO_HI);
+    for (i = 0u; i < APP_CFG_BENCH_ITER; i++) {
+        OSMutexPend(&App_BenchMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSTaskSemPost(&App_BenchTaskTCB[0], OS_OPT_POST_NONE, &err);  /* Helper blocks on the mutex we own.            */
+        App_BenchTsStart = CPU_TS_TmrRd();
+        OSMutexPost(&App_BenchMutex, OS_OPT_POST_NONE, &err);
+    }
+    App_BenchTaskDelAll();
+}
+
+
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+static  void  App_BenchBudgetChk (void)
+{
+    APP_BENCH_CHK     *p_chk;
+    OS_TCB            *p_tcb;
+    CPU_TS_TMR_FREQ    freq;
+    CPU_ERR            err_cpu;
+    OS_ERR             err;
+
+
+    p_chk = App_BenchChkNew("budget_check");
+    p_tcb = &App_BenchTaskTCB[0];
+    freq  = CPU_TS_TmrFreqGet(&err_cpu);
+
+    App_BenchBudgetPrio    = 0u;
+    App_BenchBudgetTimeout = (CPU_TS_TMR)((freq / OSCfg_TickRate_Hz) * (4u * APP_BENCH_BUDGET_TICKS));
+    App_BenchTaskCreate(0u, App_BenchTaskBudget, APP_CFG_BENCH_PRIO_LO);
+    OSTaskBudgetSet(p_tcb, APP_BENCH_BUDGET_TICKS, APP_BENCH_BUDGET_PERIOD, APP_BENCH_BUDGET_PRIO,
+                    OS_OPT_TASK_BUDGET_DEMOTE, &err);
+    App_BenchChkCase(p_chk, (CPU_BOOLEAN)(err == OS_ERR_NONE));
+
+    OSTaskSemPost(p_tcb, OS_OPT_POST_NONE, &err);               /* Wait for the helper to own the mutex.                */
+    (void)OSSemPend(&App_BenchSem, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+                                                                /* Helper inherits our prio & exhausts its budget.      */
+    OSMutexPend(&App_BenchMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+                                                                /* Throttled owner must keep the inherited prio.        */
+    App_BenchChkCase(p_chk, (CPU_BOOLEAN)(App_BenchBudgetPrio == APP_CFG_TASK_START_PRIO));
+
+    OSTimeDly(2u, OS_OPT_TIME_DLY, &err);                       /* Helper released the mutex: demoted at next tick.     */
+    App_BenchChkCase(p_chk, (CPU_BOOLEAN)(p_tcb->Prio == APP_BENCH_BUDGET_PRIO));
+    OSMutexPost(&App_BenchMutex, OS_OPT_POST_NONE, &err);
+
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)                        /* Demoting into the EDF band is rejected.              */
+    OSTaskBudgetSet(p_tcb, APP_BENCH_BUDGET_TICKS, APP_BENCH_BUDGET_PERIOD, OS_CFG_SCHED_EDF_PRIO_HI,
+                    OS_OPT_TASK_BUDGET_DEMOTE, &err);
+    App_BenchChkCase(p_chk, (CPU_BOOLEAN)(err == OS_ERR_PRIO_INVALID));
+#endif
+
+    App_BenchTaskDelAll();
+}
+#endif
+
+
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+static  void  App_BenchTick (CPU_INT32U  nbr_dly)
+{
+    APP_BENCH_RESULT  *p_res;
+    CPU_INT32U         i;
+    OS_ERR             err;
+    CPU_SR_ALLOC();
+
+
+    p_res = App_BenchResultNew("tick_task", nbr_dly);
+    for (i = 0u; i < nbr_dly; i++) {
+        App_BenchTaskCreate(i, App_BenchTaskDly, APP_CFG_BENCH_PRIO_LO);
+    }
+    OSTimeDly(1u, OS_OPT_TIME_DLY, &err);                       /* Let the helpers enter the delay list.                */
+
+    for (i = 0u; i < APP_CFG_BENCH_ITER; i++) {
+        CPU_CRITICAL_ENTER();
+        OSTickTaskTimeMax = 0u;
+        CPU_CRITICAL_EXIT();
+        OSTimeDly(1u, OS_OPT_TIME_DLY, &err);                   /* We run again after the tick task's update.           */
+        App_BenchSample(p_res, (CPU_TS_TMR)OSTickTaskTimeMax);
+    }
+    App_BenchTaskDelAll();
+}
+#endif
+
+
+static  void  App_BenchMem (CPU_INT32U  size)
+{
+    APP_BENCH_RESULT  *p_res_copy;
+    APP_BENCH_RESULT  *p_res_copy_un;
+    APP_BENCH_RESULT  *p_res_set;
+    APP_BENCH_RESULT  *p_res_cmp;
+    CPU_INT08U        *p_dest;
+    CPU_INT08U        *p_src;
+    CPU_TS_TMR         ts;
+    CPU_INT32U         i;
+
+
+    p_dest        = (CPU_INT08U *)&App_BenchMemBuf[0][0];
+    p_src         = (CPU_INT08U *)&App_BenchMemBuf[1][0];
+    p_res_copy    =  App_BenchResultNew("mem_copy",           size);
+    p_res_copy_un =  App_BenchResultNew("mem_copy_unaligned", size);
+    p_res_set     =  App_BenchResultNew("mem_set",            size);
+    p_res_cmp     =  App_BenchResultNew("mem_cmp",            size);
+
+    for (i = 0u; i < APP_CFG_BENCH_ITER; i++) {
+        ts = CPU_TS_TmrRd();
+        Mem_Copy(p_dest, p_src, size);
+        App_BenchSample(p_res_copy, CPU_TS_TmrRd() - ts);
+
+        ts = CPU_TS_TmrRd();
+        Mem_Copy(p_dest, p_src + 1u, size);                     /* Source & destination not mutually aligned.           */
+        App_BenchSample(p_res_copy_un, CPU_TS_TmrRd() - ts);
+
+        ts = CPU_TS_TmrRd();
+        Mem_Set(p_dest, 0xA5u, size);
+        App_BenchSample(p_res_set, CPU_TS_TmrRd() - ts);
+
+        Mem_Set(p_src, 0xA5u, size);
+        ts = CPU_TS_TmrRd();
+        (void)Mem_Cmp(p_dest, p_src, size);                     /* Identical bufs: full compare.                        */
+        App_BenchSample(p_res_cmp, CPU_TS_TmrRd() - ts);
+    }
+}
+
+
+static  void  App_BenchMemChk (void)
+{
+    APP_BENCH_CHK     *p_chk;
+    CPU_INT08U        *p_dest;
+    CPU_INT08U        *p_src;
+    CPU_INT32U         size;
+    CPU_INT32U         off_dest;
+    CPU_INT32U         off_src;
+    CPU_INT32U         i;
+    CPU_BOOLEAN        ok;
+
+
+    p_dest = (CPU_INT08U *)&App_BenchMemBuf[0][0];
+    p_src  = (CPU_INT08U *)&App_BenchMemBuf[1][0];
+    p_chk  =  App_BenchChkNew("mem_check");
+
+    for (size = 0u; size <= APP_BENCH_MEM_CHK_SIZE_MAX; size++) {
+        for (off_dest = 0u; off_dest < sizeof(CPU_ALIGN); off_dest++) {
+            for (off_src = 0u; off_src < sizeof(CPU_ALIGN); off_src++) {
+                for (i = 0u; i < APP_BENCH_MEM_CHK_SIZE_MAX + 2u * sizeof(CPU_ALIGN); i++) {
+                    p_dest[i] = (CPU_INT08U)(i + 0x80u);        /* Distinct patterns to catch copies too long/short.    */
+                    p_src[i]  = (CPU_INT08U)(i * 7u + size);
+                }
+                ok = DEF_YES;
+
+                Mem_Copy(p_dest + off_dest, p_src + off_src, size);
+                for (i = 0u; i < size; i++) {
+                    if (p_dest[off_dest + i] != p_src[off_src + i]) {
+                        ok = DEF_NO;
+                    }
+                }
+                if (p_dest[off_dest + size] != (CPU_INT08U)(off_dest + size + 0x80u)) {
+                    ok = DEF_NO;
+                }
+                if ((Mem_Cmp(p_dest + off_dest, p_src + off_src, size) != DEF_YES) ||
+                    ((size > 0u) &&
+                     (Mem_Cmp(p_dest + off_dest, p_src + off_src + 1u, size) != DEF_NO))) {
+                    ok = DEF_NO;
+                }
+
+                Mem_Set(p_dest + off_dest, (CPU_INT08U)size, size);
+                for (i = 0u; i < size; i++) {
+                    if (p_dest[off_dest + i] != (CPU_INT08U)size) {
+                        ok = DEF_NO;
+                    }
+                }
+                if (p_dest[off_dest + size] != (CPU_INT08U)(off_dest + size + 0x80u)) {
+                    ok = DEF_NO;
+                }
+
+                App_BenchChkCase(p_chk, ok);
+            }
+        }
+    }
+}
+
+static  void  App_BenchStr (void)
+{
+    APP_BENCH_RESULT  *p_res_dec;
+    APP_BENCH_RESULT  *p_res_nbr;
+    APP_BENCH_RESULT  *p_res_printf;
+    APP_BENCH_RESULT  *p_res_fix_pt;
+    APP_BENCH_RESULT  *p_res_lite;
+    APP_BENCH_RESULT  *p_res_printf_fmt;
+    APP_BENCH_RESULT  *p_res_parse;
+    APP_BENCH_RESULT  *p_res_strtol;
+    CPU_CHAR           str[APP_BENCH_STR_LEN];
+    CPU_CHAR          *p_str;
+    CPU_INT32S         nbr_tbl[APP_BENCH_STR_NBR_LIST];
+    CPU_INT32S         nbr;
+    CPU_TS_TMR         ts;
+    CPU_INT32U         i;
+    CPU_INT32U         j;
+
+
+    p_res_dec        = App_BenchResultNew("str_fmt_dec",        0u);
+    p_res_nbr        = App_BenchResultNew("str_fmt_nbr",        0u);
+    p_res_printf     = App_BenchResultNew("str_snprintf",       0u);
+    p_res_fix_pt     = App_BenchResultNew("str_fmt_fix_pt",     0u);
+    p_res_lite       = App_BenchResultNew("str_fmt_lite",       0u);
+    p_res_printf_fmt = App_BenchResultNew("str_snprintf_fmt",   0u);
+    p_res_parse      = App_BenchResultNew("str_parse_list",     APP_BENCH_STR_NBR_LIST);
+    p_res_strtol     = App_BenchResultNew("str_strtol",         APP_BENCH_STR_NBR_LIST);
+
+    for (i = 0u; i < APP_CFG_BENCH_ITER; i++) {
+        nbr = (CPU_INT32S)(i * 2654435761u);                    /* Spread the nbrs over the full 32-bit range.          */
+
+        ts = CPU_TS_TmrRd();
+        (void)Str_FmtDec_Int32S(nbr, str);
+        App_BenchSample(p_res_dec, CPU_TS_TmrRd() - ts);
+
+        ts = CPU_TS_TmrRd();
+        (void)Str_FmtNbr_Int32S(nbr, DEF_INT_32U_NBR_DIG_MAX + 1u, DEF_NBR_BASE_DEC, '\0', DEF_NO, DEF_YES, str);
+        App_BenchSample(p_res_nbr, CPU_TS_TmrRd() - ts);
+
+        ts = CPU_TS_TmrRd();
+        (void)snprintf((char *)str, sizeof(str), "%d", (int)nbr);
+        App_BenchSample(p_res_printf, CPU_TS_TmrRd() - ts);
+
+        ts = CPU_TS_TmrRd();
+        (void)Str_FmtFixPt_Int32S(nbr, 15u, 3u, str);
+        App_BenchSample(p_res_fix_pt, CPU_TS_TmrRd() - ts);
+
+        ts = CPU_TS_TmrRd();                                    /* Typical telemetry line.                              */
+        (void)Str_FmtLite(str, sizeof(str), "I=%.3Q15 V=%d T=%u\r\n", nbr >> 16, nbr, i);
+        App_BenchSample(p_res_lite, CPU_TS_TmrRd() - ts);
+
+        ts = CPU_TS_TmrRd();
+        (void)snprintf((char *)str, sizeof(str), "I=%.3f V=%d T=%u\r\n",
+                       (double)(nbr >> 16) / 32768.0, (int)nbr, (unsigned)i);
+        App_BenchSample(p_res_printf_fmt, CPU_TS_TmrRd() - ts);
+
+        ts = CPU_TS_TmrRd();
+        (void)Str_ParseNbrList_Int32S(App_BenchStrCmdLine, (CPU_CHAR **)0, nbr_tbl, APP_BENCH_STR_NBR_LIST);
+        App_BenchSample(p_res_parse, CPU_TS_TmrRd() - ts);
+
+        ts    = CPU_TS_TmrRd();
+        p_str = (CPU_CHAR *)App_BenchStrCmdLine;
+        for (j = 0u; j < APP_BENCH_STR_NBR_LIST; j++) {
+            nbr_tbl[j] = (CPU_INT32S)strtol((const char *)p_str, (char **)&p_str, 10);
+            if (*p_str == ',') {
+                p_str++;
+            }
+        }
+        App_BenchSample(p_res_strtol, CPU_TS_TmrRd() - ts);
+    }
+}
+
+
+static  void  App_BenchStrChk (void)
+{
+    APP_BENCH_CHK     *p_chk;
+    CPU_CHAR           str[APP_BENCH_STR_LEN];
+    CPU_CHAR           str_ref[APP_BENCH_STR_LEN];
+    CPU_INT32S         nbr_tbl[APP_BENCH_STR_NBR_LIST];
+    CPU_INT32S         nbr;
+    CPU_INT32U         i;
+    CPU_BOOLEAN        ok;
+
+
+    p_chk = App_BenchChkNew("str_check");
+
+    for (i = 0u; i < APP_BENCH_STR_CHK_NBR; i++) {
+        nbr = (CPU_INT32S)(i * 2654435761u);
+        if (i < 2u) {                                           /* Incl the extreme values.                             */
+            nbr = (i == 0u) ? DEF_INT_32S_MIN_VAL : DEF_INT_32S_MAX_VAL;
+        }
+        ok = DEF_YES;
+
+        (void)Str_FmtDec_Int32S(nbr, str);
+        (void)snprintf((char *)str_ref, sizeof(str_ref), "%d", (int)nbr);
+        if (Str_Cmp(str, str_ref) != 0) {
+            ok = DEF_NO;
+        }
+
+        (void)Str_FmtLite(str, sizeof(str), "%d,%d ,%d", nbr, nbr / -7, (CPU_INT32S)i);
+        if ((Str_ParseNbrList_Int32S(str, (CPU_CHAR **)0, nbr_tbl, APP_BENCH_STR_NBR_LIST) != 3u) ||
+            (nbr_tbl[0] != nbr)                                                                  ||
+            (nbr_tbl[1] != nbr / -7)                                                             ||
+            (nbr_tbl[2] != (CPU_INT32S)i)) {
+            ok = DEF_NO;
+        }
+
+        App_BenchChkCase(p_chk, ok);
+    }
+}
+
+
+static  void  App_BenchStrScanChk (void)
+{
+    APP_BENCH_CHK     *p_chk;
+    MATH_RAND_XORO     rand_xoro;
+    CPU_CHAR          *p_str;
+    CPU_CHAR          *p_str_2;
+    CPU_CHAR          *p_srch;
+    CPU_CHAR          *p_srch_end;
+    CPU_CHAR          *p_ref;
+    CPU_SIZE_T         len_max;
+    CPU_SIZE_T         len_ref;
+    CPU_SIZE_T         len_srch;
+    CPU_SIZE_T         i;
+    CPU_SIZE_T         j;
+    CPU_INT16S         cmp_ref;
+    CPU_CHAR           srch_char;
+    CPU_CHAR           srch_end;
+    CPU_INT32U         nbr;
+    CPU_BOOLEAN        ok;
+
+
+    p_chk = App_BenchChkNew("str_scan_check");
+    Math_RandXoroInit(&rand_xoro, 1u);                          /* Same strs on every run.                              */
+
+    for (nbr = 0u; nbr < APP_BENCH_STR_SCAN_CHK_NBR; nbr++) {
+        p_str   = (CPU_CHAR *)&App_BenchMemBuf[0][0] + Math_RandXoroBounded(&rand_xoro, sizeof(CPU_ALIGN));
+        p_str_2 = (CPU_CHAR *)&App_BenchMemBuf[1][0] + Math_RandXoroBounded(&rand_xoro, sizeof(CPU_ALIGN));
+        for (i = 0u; i < APP_BENCH_STR_SCAN_LEN_MAX + 2u * sizeof(CPU_ALIGN); i++) {
+            p_str[i]   = App_BenchStrScanChar[Math_RandXoroBounded(&rand_xoro, 4u)];
+            p_str_2[i] = p_str[i];
+        }
+        i          = Math_RandXoroBounded(&rand_xoro, APP_BENCH_STR_SCAN_LEN_MAX + 1u);
+        p_str[i]   = '\0';                                      /* Chars after the NUL must not be read as the str.     */
+        p_str_2[i] = '\0';
+        if ((nbr & 1u) != 0u) {                                 /* Half of the str pairs differ by one char.            */
+            j          = Math_RandXoroBounded(&rand_xoro, i + 1u);
+            p_str_2[j] = App_BenchStrScanChar[Math_RandXoroBounded(&rand_xoro, 5u)];
+        }
+        len_max   = Math_RandXoroBounded(&rand_xoro, APP_BENCH_STR_SCAN_LEN_MAX + sizeof(CPU_ALIGN) + 1u);
+        srch_char = App_BenchStrScanChar[Math_RandXoroBounded(&rand_xoro, 5u)];
+        ok        = DEF_YES;
+
+                                                                /* --------------------- Str_Len_N() ------------------ */
+        for (len_ref = 0u; (len_ref < len_max) && (p_str[len_ref] != '\0'); len_ref++) {
+            ;
+        }
+        if (Str_Len_N(p_str, len_max) != len_ref) {
+            ok = DEF_NO;
+        }
+
+                                                                /* --------------------- Str_Char_N() ----------------- */
+        for (i = 0u; (i < len_max) && (p_str[i] != '\0') && (p_str[i] != srch_char); i++) {
+            ;
+        }
+        p_ref = ((i < len_max) && (p_str[i] == srch_char)) ? &p_str[i] : (CPU_CHAR *)0;
+        if (Str_Char_N(p_str, len_max, srch_char) != p_ref) {
+            ok = DEF_NO;
+        }
+
+                                                                /* --------------------- Str_Cmp_N() ------------------ */
+        for (i = 0u; (i < len_max) && (p_str[i] == p_str_2[i]) && (p_str[i] != '\0'); i++) {
+            ;
+        }
+        cmp_ref = 0;
+        if ((i < len_max) && (p_str[i] != p_str_2[i])) {
+            cmp_ref = (CPU_INT16S)((CPU_INT16S)p_str[i] - (CPU_INT16S)p_str_2[i]);
+        }
+        if (Str_Cmp_N(p_str, p_str_2, len_max) != cmp_ref) {
+            ok = DEF_NO;
+        }
+
+                                                                /* --------------------- Str_Str_N() ------------------ */
+                                                                /* Search up to 4 chars of the other str.               */
+        p_srch      =  p_str_2 + Math_RandXoroBounded(&rand_xoro, APP_BENCH_STR_SCAN_LEN_MAX);
+        p_srch_end  =  p_srch  + Math_RandXoroBounded(&rand_xoro, 5u);
+        srch_end    = *p_srch_end;
+       *p_srch_end  = '\0';
+        for (len_srch = 0u; (len_srch <= len_max) && (p_srch[len_srch] != '\0'); len_srch++) {
+            ;
+        }
+        if (len_max < 1u) {
+            p_ref = (CPU_CHAR *)0;
+        } else if (len_srch < 1u) {
+            p_ref = p_str;
+        } else {
+            p_ref = (CPU_CHAR *)0;
+            for (i = 0u; (p_ref == (CPU_CHAR *)0) && ((i + len_srch) <= len_ref); i++) {
+                for (j = 0u; (j < len_srch) && (p_str[i + j] == p_srch[j]); j++) {
+                    ;
+                }
+                if (j == len_srch) {
+                    p_ref = &p_str[i];
+                }
+            }
+        }
+        if (Str_Str_N(p_str, p_srch, len_max) != p_ref) {
+            ok = DEF_NO;
+        }
+       *p_srch_end = srch_end;
+
+        App_BenchChkCase(p_chk, ok);
+    }
+}
+
+
+static  void  App_BenchMath (void)
+{
+    APP_BENCH_RESULT  *p_res_sin;
+    APP_BENCH_RESULT  *p_res_sin_cos;
+    APP_BENCH_RESULT  *p_res_atan2_16;
+    APP_BENCH_RESULT  *p_res_atan2_32;
+    APP_BENCH_RESULT  *p_res_sqrt;
+    APP_BENCH_RESULT  *p_res_div;
+    APP_BENCH_RESULT  *p_res_div_recip;
+#if (LIB_MATH_CFG_FP_EN == DEF_ENABLED)
+    APP_BENCH_RESULT  *p_res_sin_fp;
+    APP_BENCH_RESULT  *p_res_atan2_fp;
+#endif
+    APP_BENCH_RESULT  *p_res_rand_lcg;
+    APP_BENCH_RESULT  *p_res_rand_xoro;
+    APP_BENCH_RESULT  *p_res_rand_pcg;
+    APP_BENCH_RESULT  *p_res_rand_bounded;
+    APP_BENCH_RESULT  *p_res_rand_fill;
+    MATH_RAND_XORO     rand_xoro;
+    MATH_RAND_PCG      rand_pcg;
+    CPU_INT32U         rand_buf[APP_BENCH_MEM_SIZE_SMALL / sizeof(CPU_INT32U)];
+    volatile  CPU_INT32U  div;                                  /* Volatile so the compiler cannot hoist the division.  */
+    CPU_INT32U         recip;
+    CPU_INT32U         nbr;
+    CPU_INT32S         x;
+    CPU_INT32S         y;
+    MATH_Q31           val_sin;
+    MATH_Q31           val_cos;
+    CPU_TS_TMR         ts;
+    CPU_INT32U         i;
+
+
+    p_res_sin       = App_BenchResultNew("math_sin_q15",       0u);
+    p_res_sin_cos   = App_BenchResultNew("math_sincos_q31",    0u);
+    p_res_atan2_16  = App_BenchResultNew("math_atan2_16",      0u);
+    p_res_atan2_32  = App_BenchResultNew("math_atan2_32",      0u);
+    p_res_sqrt      = App_BenchResultNew("math_sqrt_64",       0u);
+    p_res_div       = App_BenchResultNew("math_div",           0u);
+    p_res_div_recip = App_BenchResultNew("math_div_recip",     0u);
+#if (LIB_MATH_CFG_FP_EN == DEF_ENABLED)
+    p_res_sin_fp    = App_BenchResultNew("math_sin_fp32",      0u);
+    p_res_atan2_fp  = App_BenchResultNew("math_atan2_fp32",    0u);
+#endif
+    p_res_rand_lcg     = App_BenchResultNew("math_rand_lcg",     0u);
+    p_res_rand_xoro    = App_BenchResultNew("math_rand_xoro",    0u);
+    p_res_rand_pcg     = App_BenchResultNew("math_rand_pcg",     0u);
+    p_res_rand_bounded = App_BenchResultNew("math_rand_bounded", APP_BENCH_MATH_RAND_BOUND);
+    p_res_rand_fill    = App_BenchResultNew("math_rand_fill",    sizeof(rand_buf));
+
+    Math_RandXoroInit(&rand_xoro, 1u);
+    Math_RandPCG_Init(&rand_pcg,  1u, 0u);
+
+    for (i = 0u; i < APP_CFG_BENCH_ITER; i++) {
+        nbr = i * 2654435761u;                                  /* Spread the nbrs over the full 32-bit range.          */
+        x   = (CPU_INT32S)nbr;
+        y   = (CPU_INT32S)(nbr * 2654435761u);
+        div = (nbr >> (i & 31u)) | 1u;
+
+        ts = CPU_TS_TmrRd();
+        (void)Math_SinQ15((MATH_ANGLE16)(nbr >> 16u));
+        App_BenchSample(p_res_sin, CPU_TS_TmrRd() - ts);
+
+        ts = CPU_TS_TmrRd();
+        Math_SinCosQ31((MATH_ANGLE32)nbr, &val_sin, &val_cos);
+        App_BenchSample(p_res_sin_cos, CPU_TS_TmrRd() - ts);
+
+        ts = CPU_TS_TmrRd();
+        (void)Math_Atan2_Angle16(y, x);
+        App_BenchSample(p_res_atan2_16, CPU_TS_TmrRd() - ts);
+
+        ts = CPU_TS_TmrRd();
+        (void)Math_Atan2_Angle32(y, x);
+        App_BenchSample(p_res_atan2_32, CPU_TS_TmrRd() - ts);
+
+        ts = CPU_TS_TmrRd();
+        (void)Math_Hypot_Int32S(y, x);
+        App_BenchSample(p_res_sqrt, CPU_TS_TmrRd() - ts);
+
+        ts = CPU_TS_TmrRd();
+        nbr = nbr / div;
+        App_BenchSample(p_res_div, CPU_TS_TmrRd() - ts);
+
+        recip = Math_Recip_Int32U(div);                         /* Calculated once per divisor, not timed.              */
+        ts    = CPU_TS_TmrRd();
+        nbr   = Math_DivRecip_Int32U(nbr, div, recip);
+        App_BenchSample(p_res_div_recip, CPU_TS_TmrRd() - ts);
+
+#if (LIB_MATH_CFG_FP_EN == DEF_ENABLED)
+        ts = CPU_TS_TmrRd();
+        (void)Math_Sin_32((CPU_FP32)x * 1.4629181e-9f);         /* Angle in [-pi, pi).                                  */
+        App_BenchSample(p_res_sin_fp, CPU_TS_TmrRd() - ts);
+
+        ts = CPU_TS_TmrRd();
+        (void)Math_Atan2_32((CPU_FP32)y, (CPU_FP32)x);
+        App_BenchSample(p_res_atan2_fp, CPU_TS_TmrRd() - ts);
+#endif
+
+        ts = CPU_TS_TmrRd();
+        (void)Math_Rand();
+        App_BenchSample(p_res_rand_lcg, CPU_TS_TmrRd() - ts);
+
+        ts = CPU_TS_TmrRd();
+        (void)Math_RandXoro(&rand_xoro);
+        App_BenchSample(p_res_rand_xoro, CPU_TS_TmrRd() - ts);
+
+        ts = CPU_TS_TmrRd();
+        (void)Math_RandPCG(&rand_pcg);
+        App_BenchSample(p_res_rand_pcg, CPU_TS_TmrRd() - ts);
+
+        ts = CPU_TS_TmrRd();
+        (void)Math_RandXoroBounded(&rand_xoro, APP_BENCH_MATH_RAND_BOUND);
+        App_BenchSample(p_res_rand_bounded, CPU_TS_TmrRd() - ts);
+
+        ts = CPU_TS_TmrRd();
+        Math_RandXoroFill(&rand_xoro, rand_buf, sizeof(rand_buf));
+        App_BenchSample(p_res_rand_fill, CPU_TS_TmrRd() - ts);
+    }
+}
+
+
+static  void  App_BenchMathChk (void)
+{
+    APP_BENCH_CHK     *p_chk;
+    MATH_RAND_XORO     rand_xoro;
+    CPU_INT32U         nbr;
+    CPU_INT32U         nbr_2;
+    CPU_INT32U         res;
+    CPU_INT64U         nbr_64;
+    CPU_INT64U         res_64;
+    CPU_INT64S         acc;
+    CPU_INT32S         x;
+    CPU_INT32S         y;
+    MATH_Q31           val_sin;
+    MATH_Q31           val_cos;
+    double             rad;
+    double             err;
+#if (LIB_MATH_CFG_FP_EN == DEF_ENABLED)
+    CPU_FP32           rad_fp;
+    CPU_FP32           nbr_fp;
+#endif
+    CPU_INT32U         i;
+    CPU_BOOLEAN        ok;
+
+
+    p_chk = App_BenchChkNew("math_check");
+    Math_RandXoroInit(&rand_xoro, 1u);                          /* Same cases on every run.                             */
+
+    for (i = 0u; i < APP_BENCH_MATH_CHK_NBR; i++) {
+        nbr   = Math_RandXoro(&rand_xoro);
+        nbr_2 = Math_RandXoro(&rand_xoro);
+        if (i == 0u) {                                          /* Incl -1 * -1 in Math_MacQ15().                       */
+            nbr = 0x80008000u;
+        } else if (i == 1u) {                                   /* Incl Math_SinCosQ31()'s worst case.                  */
+            nbr = 0x82349E05u;
+        }
+        x     = (CPU_INT32S)nbr   >> (nbr_2 & 31u);             /* Vectors of all magnitudes.                           */
+        y     = (CPU_INT32S)nbr_2 >> (nbr   & 31u);
+        if ((x == 0) && (y == 0)) {
+            x = 1;
+        }
+        ok    = DEF_YES;
+
+                                                                /* --------------- FIXED-POINT TRIG FNCTS ------------- */
+        rad = (double)(nbr >> 16u) * (APP_BENCH_MATH_2_PI / 65536.0);
+        if ((fabs((double)Math_SinQ15((MATH_ANGLE16)(nbr >> 16u)) - (sin(rad) * 32768.0)) > APP_BENCH_MATH_ERR_Q15) ||
+            (fabs((double)Math_CosQ15((MATH_ANGLE16)(nbr >> 16u)) - (cos(rad) * 32768.0)) > APP_BENCH_MATH_ERR_Q15)) {
+            ok = DEF_NO;
+        }
+
+        rad = (double)nbr * (APP_BENCH_MATH_2_PI / 4294967296.0);
+        Math_SinCosQ31((MATH_ANGLE32)nbr, &val_sin, &val_cos);
+        if ((fabs((double)val_sin - (sin(rad) * 2147483648.0)) > APP_BENCH_MATH_ERR_Q31) ||
+            (fabs((double)val_cos - (cos(rad) * 2147483648.0)) > APP_BENCH_MATH_ERR_Q31)) {
+            ok = DEF_NO;
+        }
+
+        rad = atan2((double)y, (double)x);
+        err = App_BenchMathAngleErr((double)(CPU_INT16S)Math_Atan2_Angle16(y, x) * (APP_BENCH_MATH_2_PI / 65536.0),
+                                    rad);
+        if (fabs(err) > (APP_BENCH_MATH_ERR_ANGLE16 * (APP_BENCH_MATH_2_PI / 65536.0))) {
+            ok = DEF_NO;
+        }
+        err = App_BenchMathAngleErr((double)(CPU_INT32S)Math_Atan2_Angle32(y, x) * (APP_BENCH_MATH_2_PI / 4294967296.0),
+                                    rad);
+        if (fabs(err) > APP_BENCH_MATH_ERR_ANGLE32) {
+            ok = DEF_NO;
+        }
+
+#if (LIB_MATH_CFG_FP_EN == DEF_ENABLED)                         /* -------------- FLOATING POINT FNCTS -------------- */
+        rad_fp = (CPU_FP32)(CPU_INT32S)nbr * 1.4629181e-9f;     /* Angle in [-pi, pi).                                  */
+        if ((fabs((double)Math_Sin_32(rad_fp) - sin((double)rad_fp)) > APP_BENCH_MATH_ERR_FP32_SIN) ||
+            (fabs((double)Math_Cos_32(rad_fp) - cos((double)rad_fp)) > APP_BENCH_MATH_ERR_FP32_SIN)) {
+            ok = DEF_NO;
+        }
+        err = (double)Math_Atan2_32((CPU_FP32)y, (CPU_FP32)x) - atan2((double)(CPU_FP32)y, (double)(CPU_FP32)x);
+        if (fabs(err) > APP_BENCH_MATH_ERR_FP32_ATAN2) {
+            ok = DEF_NO;
+        }
+        nbr_fp = (CPU_FP32)nbr * 1.0e-6f;                       /* Relative error.                                      */
+        err    = fabs((double)Math_Sqrt_32(nbr_fp) - sqrt((double)nbr_fp));
+        if (err > (APP_BENCH_MATH_ERR_FP32_SQRT * sqrt((double)nbr_fp))) {
+            ok = DEF_NO;
+        }
+#endif
+                                                                /* ------------------- EXACT FNCTS -------------------- */
+        res = Math_Sqrt_Int32U(nbr);
+        if ((((CPU_INT64U)res         *  res)        >  nbr) ||
+            (((CPU_INT64U)(res + 1u)  * (res + 1u))  <= nbr)) {
+            ok = DEF_NO;
+        }
+        nbr_64 = ((CPU_INT64U)nbr << 32u) | nbr_2;
+        res_64 =   Math_Sqrt_Int64U(nbr_64);
+        if (((res_64 * res_64) > nbr_64) ||
+            ((res_64 < DEF_INT_32U_MAX_VAL) && (((res_64 + 1u) * (res_64 + 1u)) <= nbr_64))) {
+            ok = DEF_NO;
+        }
+
+        nbr_2 = (nbr_2 >> (nbr & 31u)) | 1u;                    /* Divisors of all magnitudes.                          */
+        if (Math_DivRecip_Int32U(nbr, nbr_2, Math_Recip_Int32U(nbr_2)) != (nbr / nbr_2)) {
+            ok = DEF_NO;
+        }
+
+        acc = (CPU_INT64S)(CPU_INT32S)nbr_2 + (2 * (CPU_INT64S)(MATH_Q15)nbr * (CPU_INT64S)(MATH_Q15)(nbr >> 16u));
+        acc = DEF_MIN(DEF_MAX(acc, (CPU_INT64S)MATH_Q31_MIN), (CPU_INT64S)MATH_Q31_MAX);
+        if (Math_MacQ15((MATH_Q31)nbr_2, (MATH_Q15)nbr, (MATH_Q15)(nbr >> 16u)) != (MATH_Q31)acc) {
+            ok = DEF_NO;
+        }
+
+        App_BenchChkCase(p_chk, ok);
+    }
+}
+
+
+static  double  App_BenchMathAngleErr (double  rad,
+                                       double  rad_ref)
+{
+    double  err;
+
+
+    err = rad - rad_ref;                                        /* Wrap the difference to [-pi, pi].                    */
+    if (err > (APP_BENCH_MATH_2_PI / 2.0)) {
+        err -= APP_BENCH_MATH_2_PI;
+    } else if (err < -(APP_BENCH_MATH_2_PI / 2.0)) {
+        err += APP_BENCH_MATH_2_PI;
+    }
+    return (err);
+}
+
+
+static  void  App_BenchRandChk (void)
+{
+    APP_BENCH_CHK     *p_chk;
+    MATH_RAND_XORO     rand_xoro;
+    MATH_RAND_PCG      rand_pcg;
+    CPU_INT32U         buf[4];
+    CPU_INT32U         nbr_ref;
+    CPU_INT32U         i;
+
+
+    p_chk = App_BenchChkNew("rand_check");
+
+                                                                /* ---------- KNOWN ANSWERS (see Note #8) ------------- */
+    Math_RandPCG_Init(&rand_pcg, 42u, 54u);
+    rand_xoro.State[0] = 1u;
+    rand_xoro.State[1] = 2u;
+    for (i = 0u; i < APP_BENCH_RAND_CHK_NBR; i++) {
+        App_BenchChkCase(p_chk, (CPU_BOOLEAN)(Math_RandPCG(&rand_pcg)   == App_BenchRandTblPCG[i]));
+        App_BenchChkCase(p_chk, (CPU_BOOLEAN)(Math_RandXoro(&rand_xoro) == App_BenchRandTblXoro[i]));
+    }
+
+                                                                /* ------------------ BOUNDED NBRS -------------------- */
+    Math_RandPCG_Init(&rand_pcg, 42u, 54u);
+    rand_xoro.State[0] = 1u;
+    rand_xoro.State[1] = 2u;
+    for (i = 0u; i < APP_BENCH_RAND_CHK_NBR; i++) {             /* No product of the tbls' nbrs is rejected.            */
+        nbr_ref = (CPU_INT32U)(((CPU_INT64U)App_BenchRandTblPCG[i]  * APP_BENCH_MATH_RAND_BOUND) >> 32u);
+        App_BenchChkCase(p_chk, (CPU_BOOLEAN)(Math_RandPCG_Bounded(&rand_pcg, APP_BENCH_MATH_RAND_BOUND) == nbr_ref));
+        nbr_ref = (CPU_INT32U)(((CPU_INT64U)App_BenchRandTblXoro[i] * APP_BENCH_MATH_RAND_BOUND) >> 32u);
+        App_BenchChkCase(p_chk, (CPU_BOOLEAN)(Math_RandXoroBounded(&rand_xoro, APP_BENCH_MATH_RAND_BOUND) == nbr_ref));
+    }
+
+                                                                /* ------------------- FILL FNCTS --------------------- */
+    Mem_Clr(buf, sizeof(buf));
+    Math_RandPCG_Init(&rand_pcg, 42u, 54u);
+    Math_RandPCG_Fill(&rand_pcg, (CPU_INT08U *)&buf[0] + 1u, 10u);
+    App_BenchChkCase(p_chk, App_BenchRandFillChk(buf, App_BenchRandTblPCG));
+    Mem_Clr(buf, sizeof(buf));
+    rand_xoro.State[0] = 1u;
+    rand_xoro.State[1] = 2u;
+    Math_RandXoroFill(&rand_xoro, (CPU_INT08U *)&buf[0] + 1u, 10u);
+    App_BenchChkCase(p_chk, App_BenchRandFillChk(buf, App_BenchRandTblXoro));
+}
+
+
+static  CPU_BOOLEAN  App_BenchRandFillChk (const  CPU_INT32U  *p_buf,
+                                           const  CPU_INT32U  *p_tbl)
+{
+    const  CPU_INT08U   *p_buf_08;
+           CPU_BOOLEAN   ok;
+
+
+    p_buf_08 = (const CPU_INT08U *)p_buf;                       /* Octets 1 to 10 filled (see 'lib_math.c  ...          */
+    ok       =  DEF_YES;                                        /* ... Math_RandXoroFill()  Note #1').                  */
+    if ((p_buf_08[0]  != 0u)                     ||             /* Octets around MUST NOT be written.                   */
+        (p_buf_08[11] != 0u)                     ||
+        (p_buf_08[1]  != (CPU_INT08U)p_tbl[0])   ||             /* Unaligned head : one nbr per octet ...               */
+        (p_buf_08[2]  != (CPU_INT08U)p_tbl[1])   ||
+        (p_buf_08[3]  != (CPU_INT08U)p_tbl[2])   ||
+        (p_buf[1]     !=             p_tbl[3])   ||             /* ... aligned word : one nbr ...                       */
+        (p_buf_08[8]  != (CPU_INT08U)p_tbl[4])   ||             /* ... & tail : one nbr per octet.                      */
+        (p_buf_08[9]  != (CPU_INT08U)p_tbl[5])   ||
+        (p_buf_08[10] != (CPU_INT08U)p_tbl[6])) {
+        ok = DEF_NO;
+    }
+    return (ok);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     BENCHMARK ISR & HELPER TASKS
+*********************************************************************************************************
+*/
+
+static  void  App_BenchISR (void)
+{
+    OS_ERR  err;
+
+
+    App_BenchTsStart = CPU_TS_TmrRd();
+    OSTaskSemPost(&App_BenchTaskTCB[0], OS_OPT_POST_NONE, &err);
+}
+
+
+static  void  App_BenchTaskSuspend (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        App_BenchTsStart = CPU_TS_TmrRd();
+        OSTaskSuspend((OS_TCB *)0, &err);
+    }
+}
+
+
+static  void  App_BenchTaskTaskSem (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        App_BenchSample(App_BenchResultCur, CPU_TS_TmrRd() - App_BenchTsStart);
+        App_BenchIntCtr++;
+    }
+}
+
+
+static  void  App_BenchTaskSem (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSSemPend(&App_BenchSem, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        App_BenchSample(App_BenchResultCur, CPU_TS_TmrRd() - App_BenchTsStart);
+    }
+}
+
+
+static  void  App_BenchTaskQ (void  *p_arg)
+{
+    OS_MSG_SIZE  msg_size;
+    OS_ERR       err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSQPend(&App_BenchQ, 0u, OS_OPT_PEND_BLOCKING, &msg_size, (CPU_TS *)0, &err);
+        App_BenchSample(App_BenchResultCur, CPU_TS_TmrRd() - App_BenchTsStart);
+    }
+}
+
+
+static  void  App_BenchTaskFlag (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSFlagPend(&App_BenchFlagGrp,
+                          APP_BENCH_FLAG,
+                          0u,
+                         (OS_OPT_PEND_FLAG_SET_ANY | OS_OPT_PEND_BLOCKING),
+                         (CPU_TS *)0,
+                         &err);                                 /* Flag is cleared by the time we pend again.           */
+    }
+}
+
+
+static  void  App_BenchTaskMutex (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    (void)p_arg;
+
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSMutexPend(&App_BenchMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        App_BenchSample(App_BenchResultCur, CPU_TS_TmrRd() - App_BenchTsStart);
+        OSMutexPost(&App_BenchMutex, OS_OPT_POST_NONE, &err);
+    }
+}
+
+
+static  void  App_BenchTaskDly (void  *p_arg)
+{
+    OS_ERR  err;
+
+
+    for (;;) {
+        OSTimeDly(APP_BENCH_DLY_LONG + (OS_TICK)(CPU_ADDR)p_arg, OS_OPT_TIME_DLY, &err);
+    }
+}
+
+
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+static  void  App_BenchTaskBudget (void  *p_arg)
+{
+    OS_TCB      *p_tcb;
+    CPU_TS_TMR   ts;
+    OS_ERR       err;
+
+
+    p_tcb = &App_BenchTaskTCB[(CPU_ADDR)p_arg];
+
+    for (;;) {
+        (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSMutexPend(&App_BenchMutex, 0u, OS_OPT_PEND_BLOCKING, (CPU_TS *)0, &err);
+        OSSemPost(&App_BenchSem, OS_OPT_POST_1, &err);          /* Benchmark task pends on the mutex, we inherit.       */
+        ts = CPU_TS_TmrRd();
+        while ((p_tcb->BudgetThrottled   == DEF_FALSE) &&       /* Run until the budget is exhausted.                   */
+               ((CPU_TS_TmrRd() - ts)    <  App_BenchBudgetTimeout)) {
+            ;
+        }
+        App_BenchBudgetPrio = p_tcb->Prio;
+        OSMutexPost(&App_BenchMutex, OS_OPT_POST_NONE, &err);
+    }
+}
+#endif
+
+#endif
@@ -0,0 +1,198 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can find our product's user manual, API reference, release notes and
+*               more information at https://doc.micrium.com.
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                      KERNEL PRIMITIVE BENCHMARKS
+*
+*                                          TI MSP-EXP432P401R
+*                                       LaunchPad Development Kit
+*
+* Filename      : app_bench.h
+* Version       : V1.00
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                                 MODULE
+*
+* Note(s) : (1) This header file is protected from multiple pre-processor inclusion through use of the
+*               APP_BENCH present pre-processor macro definition.
+*********************************************************************************************************
+*/
+
+#ifndef  APP_BENCH_PRESENT
+#define  APP_BENCH_PRESENT
+
+
+/*
+*********************************************************************************************************
+*                                              INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <cpu.h>
+#include  <cpu_core.h>
+#include  <os.h>
+#include  <bsp_int.h>
+#include  <app_cfg.h>
+
+
+/*
+*********************************************************************************************************
+*                                        DEFAULT CONFIGURATION
+*
+* Note(s) : (1) APP_CFG_BENCH_EN includes the benchmarks; App_BenchRun() is called by the start task.
+*
+*           (2) APP_CFG_BENCH_ITER is the number of samples taken by each benchmark.  The event flag &
+*               tick benchmarks wait one tick per sample.
+*
+*           (3) APP_CFG_BENCH_TASK_NBR is the number of helper tasks, i.e. the largest event flag fan-out
+*               & the largest number of delayed tasks benchmarked.
+*
+*           (4) Helper tasks run at APP_CFG_BENCH_PRIO_HI (above the task calling App_BenchRun()) or at
+*               APP_CFG_BENCH_PRIO_LO (below it).  Both priorities MUST be free while the benchmarks run.
+*
+*           (5) APP_CFG_BENCH_INT_ID is an interrupt source, unused by the application, that the benchmarks
+*               trigger by software (NVIC STIR) to measure ISR post to task latencies.
+*********************************************************************************************************
+*/
+
+#ifndef  APP_CFG_BENCH_EN
+#define  APP_CFG_BENCH_EN                       DEF_DISABLED
+#endif
+
+#ifndef  APP_CFG_BENCH_ITER
+#define  APP_CFG_BENCH_ITER                            100u
+#endif
+
+#ifndef  APP_CFG_BENCH_TASK_NBR
+#define  APP_CFG_BENCH_TASK_NBR                          8u
+#endif
+
+#ifndef  APP_CFG_BENCH_STK_SIZE
+#define  APP_CFG_BENCH_STK_SIZE                        128u
+#endif
+
+#ifndef  APP_CFG_BENCH_PRIO_HI
+#define  APP_CFG_BENCH_PRIO_HI                  (APP_CFG_TASK_START_PRIO - 1u)
+#endif
+
+#ifndef  APP_CFG_BENCH_PRIO_LO
+#define  APP_CFG_BENCH_PRIO_LO                  (APP_CFG_TASK_START_PRIO + 1u)
+#endif
+
+#ifndef  APP_CFG_BENCH_INT_ID
+#define  APP_CFG_BENCH_INT_ID                   BSP_INT_ID_AES
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                              DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  app_bench_result {
+    const  CPU_CHAR  *NamePtr;                                  /* Benchmark name.                                      */
+    CPU_INT32U        Param;                                    /* Benchmark parameter (e.g. nbr of waiters).           */
+    CPU_INT32U        Samples;                                  /* Nbr of samples taken.                                */
+    CPU_TS_TMR        CyclesMin;                                /* Shortest sample (in CPU_TS timer counts).            */
+    CPU_TS_TMR        CyclesMax;                                /* Longest  sample (in CPU_TS timer counts).            */
+    CPU_INT64U        CyclesTot;                                /* Sum of all samples.                                  */
+} APP_BENCH_RESULT;
+
+typedef  struct  app_bench_chk {
+    const  CPU_CHAR  *NamePtr;                                  /* Check name.                                          */
+    CPU_INT32U        Cases;                                    /* Nbr of cases checked.                                */
+    CPU_INT32U        Errs;                                     /* Nbr of cases that failed.                            */
+} APP_BENCH_CHK;
+
+
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+#define  APP_BENCH_RESULT_NBR                           48u
+#define  APP_BENCH_CHK_NBR                               8u
+
+extern  APP_BENCH_RESULT  App_BenchResultTbl[APP_BENCH_RESULT_NBR]; /* Visible to the debugger / uC/Probe.              */
+extern  CPU_INT32U        App_BenchResultCnt;
+extern  CPU_INT32U        App_BenchResultDropped;               /* Nbr of results that did not fit in the tbl.          */
+
+extern  APP_BENCH_CHK     App_BenchChkTbl[APP_BENCH_CHK_NBR];
+extern  CPU_INT32U        App_BenchChkCnt;
+extern  CPU_INT32U        App_BenchChkFailed;                   /* Nbr of checks with failed cases (0 if all passed).   */
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void  App_BenchRun   (void);
+
+void  App_BenchReport(void);
+
+
+/*
+*********************************************************************************************************
+*                                        CONFIGURATION ERRORS
+*********************************************************************************************************
+*/
+
+#if (APP_CFG_BENCH_EN == DEF_ENABLED)
+
+#if (CPU_CFG_TS_TMR_EN != DEF_ENABLED)
+#error  "app_bench.h requires the CPU timestamp timer (CPU_CFG_TS_32_EN or CPU_CFG_TS_64_EN in 'cpu_cfg.h')"
+#endif
+
+#if ((OS_CFG_SEM_EN          != DEF_ENABLED) || \
+     (OS_CFG_Q_EN            != DEF_ENABLED) || \
+     (OS_CFG_FLAG_EN         != DEF_ENABLED) || \
+     (OS_CFG_MUTEX_EN        != DEF_ENABLED) || \
+     (OS_CFG_TASK_SUSPEND_EN != DEF_ENABLED) || \
+     (OS_CFG_TASK_DEL_EN     != DEF_ENABLED))
+#error  "app_bench.h requires semaphores, queues, event flags, mutexes, OSTaskSuspend() & OSTaskDel() in 'os_cfg.h'"
+#endif
+
+#if ((APP_CFG_BENCH_TASK_NBR < 1u) || \
+     (APP_CFG_BENCH_TASK_NBR > 32u))
+#error  "APP_CFG_BENCH_TASK_NBR illegally #define'd in 'app_cfg.h' [MUST be >= 1 && <= 32]"
+#endif
+
+#if (APP_CFG_BENCH_ITER < 1u)
+#error  "APP_CFG_BENCH_ITER illegally #define'd in 'app_cfg.h' [MUST be >= 1]"
+#endif
+
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
@@ -34,6 +34,8 @@
 *********************************************************************************************************
 */
 
+#define  BSP_CFG_INT_PROF_EN                        DEF_DISABLED /* Per-source ISR count/exec time, see 'bsp_int.h'.    */
+#define  APP_CFG_BENCH_EN                           DEF_DISABLED /* Kernel benchmarks at startup, see 'app_bench.h'.     */
 
 
 /*
@@ -58,6 +60,15 @@
 #define  APP_CFG_TASK_SENSORS_STK_SIZE            1024u
 
 
+/*
+*********************************************************************************************************
+*                                            TASK PERIODS
+*********************************************************************************************************
+*/
+
+#define  APP_CFG_TASK_SENSORS_PERIOD_MS             20u
+
+
 /*
 *********************************************************************************************************
 *                                          SERIAL CONFIGURATION
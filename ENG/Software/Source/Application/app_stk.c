@@ -0,0 +1,414 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can find our product's user manual, API reference, release notes and
+*               more information at https://doc.micrium.com.
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        STACK USAGE MONITOR
+*
+*                                          TI MSP-EXP432P401R
+*                                       LaunchPad Development Kit
+*
+* Filename      : app_stk.c
+* Version       : V1.00
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <cpu.h>
+#include  <os.h>
+#include  <lib_def.h>
+#include  <lib_ascii.h>
+#include  <app_cfg.h>
+#include  <app_stk.h>
+#include  <stdio.h>
+
+
+/*
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*/
+
+#define  APP_STK_MON_CFG_NAME_LEN                       48u     /* Max len of a report's cfg macro name, incl. NUL.     */
+
+#define  APP_STK_MON_PRINT(x)                   ((void)(APP_CFG_TRACE x))
+
+
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+APP_STK_MON  App_StkMonTbl[APP_CFG_STK_MON_TASK_NBR];
+
+
+/*
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+static  APP_STK_MON  *App_StkMonEntryGet(OS_TCB       *p_tcb,
+                                         CPU_CHAR     *p_name);
+
+static  void          App_StkMonCfgName (APP_STK_MON  *p_mon,
+                                         CPU_CHAR     *p_buf);
+
+
+/*
+*********************************************************************************************************
+*                                          App_StkMonUpdate()
+*
+* Description : Sample the stack usage of every task (and of the ISR stack) & record the peaks.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Usage is obtained with OSTaskStkChk(), i.e. by counting the untouched (zero) elements at
+*                   the bottom of the stack.  Tasks MUST therefore be created with OS_OPT_TASK_STK_CHK &
+*                   OS_OPT_TASK_STK_CLR; tasks created without OS_OPT_TASK_STK_CHK are skipped.
+*
+*               (2) The ISR stack is not cleared by the kernel but lives in zero-initialized data, so the
+*                   same method applies to it.
+*
+*               (3) Call periodically, e.g. from the start task, over a representative run.  The peaks are
+*                   kept for tasks that are later deleted.
+*********************************************************************************************************
+*/
+
+void  App_StkMonUpdate (void)
+{
+    APP_STK_MON   *p_mon;
+    OS_TCB        *p_tcb;
+    CPU_STK_SIZE   stk_free;
+    CPU_STK_SIZE   stk_used;
+    CPU_INT32U     ix;
+    OS_ERR         err;
+#if (OS_CFG_ISR_STK_SIZE > 0u)
+    CPU_STK       *p_stk;
+#endif
+    CPU_SR_ALLOC();
+
+
+    for (ix = 0u; ix < APP_CFG_STK_MON_TASK_NBR; ix++) {
+        App_StkMonTbl[ix].Alive = DEF_NO;
+    }
+
+#if (OS_CFG_ISR_STK_SIZE > 0u)                                  /* ------------------- ISR STACK -------------------- */
+    stk_free = 0u;
+    p_stk    = OSCfg_ISRStkBasePtr;                             /* See Note #2.                                         */
+    while ((stk_free <  OSCfg_ISRStkSize) &&
+           (*p_stk   == 0u)) {
+        p_stk++;
+        stk_free++;
+    }
+    p_mon = App_StkMonEntryGet((OS_TCB *)0, (CPU_CHAR *)"ISR Stack");
+    if (p_mon != (APP_STK_MON *)0) {
+        p_mon->Size  = OSCfg_ISRStkSize;
+        p_mon->Alive = DEF_YES;
+        if (p_mon->UsedMax < (OSCfg_ISRStkSize - stk_free)) {
+            p_mon->UsedMax = OSCfg_ISRStkSize - stk_free;
+        }
+    }
+#endif
+                                                                /* --------------------- TASKS ---------------------- */
+    CPU_CRITICAL_ENTER();
+    p_tcb = OSTaskDbgListPtr;
+    CPU_CRITICAL_EXIT();
+    while (p_tcb != (OS_TCB *)0) {
+        OSTaskStkChk(p_tcb, &stk_free, &stk_used, &err);        /* See Note #1.                                         */
+        if (err == OS_ERR_NONE) {
+            p_mon = App_StkMonEntryGet(p_tcb, p_tcb->NamePtr);
+            if (p_mon != (APP_STK_MON *)0) {
+                p_mon->Size  = p_tcb->StkSize;
+                p_mon->Alive = DEF_YES;
+                if (p_mon->UsedMax < stk_used) {
+                    p_mon->UsedMax = stk_used;
+                }
+            }
+        }
+
+        CPU_CRITICAL_ENTER();
+        p_tcb = p_tcb->DbgNextPtr;
+        CPU_CRITICAL_EXIT();
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          App_StkMonReport()
+*
+* Description : Output the recommended stack sizes in the format of 'app_cfg.h'/'os_cfg_app.h'.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : App_TaskStart(),
+*               Application.
+*
+* Note(s)     : (1) The report is output with APP_CFG_TRACE, whatever APP_CFG_TRACE_LEVEL, so that it is
+*                   available in the default configuration.  Sample output :
+*
+*                   #define  APP_CFG_TASK_START_STK_SIZE                 224u   / * App Task Start: peak 170 of 1024 * /
+*                   #define  OS_CFG_IDLE_TASK_STK_SIZE                    64u   / * uC/OS-III Idle Task: peak 38 of 128 * /
+*
+*               (2) Configuration macro names are derived as follows :
+*
+*                   (a) Kernel tasks & the ISR stack map to their 'os_cfg_app.h' macro.
+*
+*                   (b) Application tasks map to APP_CFG_<NAME>_STK_SIZE, where <NAME> is the task name in
+*                       upper case without a leading "App ", non-alphanumeric characters replaced by '_'.
+*
+*               (3) When OS_CFG_TASK_STK_GUARD_EN is enabled, the MPU guard never shows up as used.  Its
+*                   size, plus the worst case alignment loss, is added to the task stacks' recommendation.
+*********************************************************************************************************
+*/
+
+void  App_StkMonReport (void)
+{
+    APP_STK_MON   *p_mon;
+    CPU_STK_SIZE   size_rec;
+    CPU_INT32U     ix;
+    CPU_CHAR       cfg_name[APP_STK_MON_CFG_NAME_LEN];
+
+
+    APP_STK_MON_PRINT(("/* Stack sizes: peak usage + %u%% margin, in CPU_STK elements. */\n\r",
+                       (unsigned int)APP_CFG_STK_MON_MARGIN_PCT));
+
+    for (ix = 0u; ix < APP_CFG_STK_MON_TASK_NBR; ix++) {
+        p_mon = &App_StkMonTbl[ix];
+        if (p_mon->NamePtr == (CPU_CHAR *)0) {                  /* End of used entries.                                 */
+            break;
+        }
+
+        size_rec = App_StkSizeRecommend(p_mon->UsedMax);
+#if (OS_CFG_TASK_STK_GUARD_EN == DEF_ENABLED)
+        if (p_mon->TCB_Ptr != (OS_TCB *)0) {                    /* See Note #3.                                         */
+            size_rec += (2u * OS_CPU_STK_GUARD_SIZE) / sizeof(CPU_STK);
+        }
+#endif
+        App_StkMonCfgName(p_mon, &cfg_name[0]);
+
+        APP_STK_MON_PRINT(("#define  %-40s %5uu   /* %s: peak %u of %u%s */\n\r",
+                           cfg_name,
+                           (unsigned int)size_rec,
+                           p_mon->NamePtr,
+                           (unsigned int)p_mon->UsedMax,
+                           (unsigned int)p_mon->Size,
+                           (p_mon->Alive == DEF_YES) ? "" : " (deleted)"));
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        App_StkSizeRecommend()
+*
+* Description : Compute a recommended stack size from a peak stack usage.
+*
+* Argument(s) : used        Peak stack usage (in CPU_STK elements).
+*
+* Return(s)   : Recommended stack size (in CPU_STK elements).
+*
+* Caller(s)   : App_StkMonReport(),
+*               Application.
+*
+* Note(s)     : (1) The size is the peak usage plus APP_CFG_STK_MON_MARGIN_PCT percent, rounded up to a
+*                   multiple of APP_CFG_STK_MON_ALIGN & no less than OS_CFG_STK_SIZE_MIN.
+*********************************************************************************************************
+*/
+
+CPU_STK_SIZE  App_StkSizeRecommend (CPU_STK_SIZE  used)
+{
+    CPU_STK_SIZE  size;
+
+
+    size  = used + (((used * APP_CFG_STK_MON_MARGIN_PCT) + 99u) / 100u);
+    size  = ((size + APP_CFG_STK_MON_ALIGN - 1u) / APP_CFG_STK_MON_ALIGN) * APP_CFG_STK_MON_ALIGN;
+    if (size < OS_CFG_STK_SIZE_MIN) {
+        size = OS_CFG_STK_SIZE_MIN;
+    }
+
+    return (size);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        App_StkMonEntryGet()
+*
+* Description : Get the monitor entry of a stack, allocating a new entry if needed.
+*
+* Argument(s) : p_tcb       Pointer to the task's TCB, NULL for the ISR stack.
+*
+*               p_name      Name of the stack.
+*
+* Return(s)   : Pointer to the entry,
+*
+*               NULL, if the table is full.
+*
+* Caller(s)   : App_StkMonUpdate().
+*
+* Note(s)     : (1) An entry matches on both the TCB & the name so that a TCB reused by a new task gets its
+*                   own entry.
+*********************************************************************************************************
+*/
+
+static  APP_STK_MON  *App_StkMonEntryGet (OS_TCB    *p_tcb,
+                                          CPU_CHAR  *p_name)
+{
+    APP_STK_MON  *p_mon;
+    CPU_INT32U    ix;
+
+
+    for (ix = 0u; ix < APP_CFG_STK_MON_TASK_NBR; ix++) {
+        p_mon = &App_StkMonTbl[ix];
+        if (p_mon->NamePtr == (CPU_CHAR *)0) {                  /* Free entry, allocate it.                             */
+            p_mon->TCB_Ptr = p_tcb;
+            p_mon->NamePtr = p_name;
+            p_mon->UsedMax = 0u;
+            return (p_mon);
+        }
+        if ((p_mon->TCB_Ptr == p_tcb) &&                        /* See Note #1.                                         */
+            (p_mon->NamePtr == p_name)) {
+            return (p_mon);
+        }
+    }
+
+    return ((APP_STK_MON *)0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         App_StkMonCfgName()
+*
+* Description : Build the name of the configuration macro holding the size of a stack.
+*
+* Argument(s) : p_mon       Pointer to the monitor entry.
+*
+*               p_buf       Pointer to a buffer of APP_STK_MON_CFG_NAME_LEN characters.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : App_StkMonReport().
+*
+* Note(s)     : (1) See 'App_StkMonReport()  Note #2'.
+*********************************************************************************************************
+*/
+
+static  void  App_StkMonCfgName (APP_STK_MON  *p_mon,
+                                 CPU_CHAR     *p_buf)
+{
+    const  CPU_CHAR     *p_src;
+           CPU_CHAR     *p_name;
+           CPU_SIZE_T    len;
+           CPU_BOOLEAN   sep;
+
+
+    p_src = (CPU_CHAR *)0;                                      /* ------------- KERNEL STACKS (Note #2a) ------------- */
+    if (p_mon->TCB_Ptr == (OS_TCB *)0) {
+        p_src = "OS_CFG_ISR_STK_SIZE";
+    }
+#if (OS_CFG_TASK_IDLE_EN == DEF_ENABLED)
+    if (p_mon->TCB_Ptr == &OSIdleTaskTCB) {
+        p_src = "OS_CFG_IDLE_TASK_STK_SIZE";
+    }
+#endif
+#if (OS_CFG_STAT_TASK_EN == DEF_ENABLED)
+    if (p_mon->TCB_Ptr == &OSStatTaskTCB) {
+        p_src = "OS_CFG_STAT_TASK_STK_SIZE";
+    }
+#endif
+#if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
+    if (p_mon->TCB_Ptr == &OSTickTaskTCB) {
+        p_src = "OS_CFG_TICK_TASK_STK_SIZE";
+    }
+#endif
+#if (OS_CFG_TMR_EN == DEF_ENABLED)
+    if (p_mon->TCB_Ptr == &OSTmrTaskTCB) {
+        p_src = "OS_CFG_TMR_TASK_STK_SIZE";
+    }
+#endif
+    if (p_src != (CPU_CHAR *)0) {
+        len = 0u;
+        while ((p_src[len] != ASCII_CHAR_NULL) &&
+               (len        <  (APP_STK_MON_CFG_NAME_LEN - 1u))) {
+            p_buf[len] = p_src[len];
+            len++;
+        }
+        p_buf[len] = ASCII_CHAR_NULL;
+        return;
+    }
+                                                                /* ------------ APP TASK STACKS (Note #2b) ------------ */
+    p_name = p_mon->NamePtr;
+    if ((ASCII_ToUpper(p_name[0]) == ASCII_CHAR_LATIN_UPPER_A) &&
+        (ASCII_ToUpper(p_name[1]) == ASCII_CHAR_LATIN_UPPER_P) &&
+        (ASCII_ToUpper(p_name[2]) == ASCII_CHAR_LATIN_UPPER_P) &&
+        (p_name[3]                == ASCII_CHAR_SPACE)) {       /* Skip leading "App ".                                 */
+        p_name += 4u;
+    }
+
+    p_src = "APP_CFG";
+    len   = 0u;
+    while (*p_src != ASCII_CHAR_NULL) {
+        p_buf[len++] = *p_src++;
+    }
+    sep   = DEF_YES;                                            /* Emit one '_' before the next alphanumeric char.      */
+                                                                /* Keep room for "_STK_SIZE" & NUL.                     */
+    while ((*p_name != ASCII_CHAR_NULL) &&
+           (len     <  (APP_STK_MON_CFG_NAME_LEN - 11u))) {
+        if (ASCII_IsAlphaNum(*p_name) == DEF_YES) {
+            if (sep == DEF_YES) {
+                p_buf[len++] = ASCII_CHAR_LOW_LINE;
+                sep          = DEF_NO;
+            }
+            p_buf[len++] = ASCII_ToUpper(*p_name);
+        } else {
+            sep = DEF_YES;
+        }
+        p_name++;
+    }
+
+    p_src = "_STK_SIZE";
+    while (*p_src != ASCII_CHAR_NULL) {
+        p_buf[len++] = *p_src++;
+    }
+    p_buf[len] = ASCII_CHAR_NULL;
+}
@@ -0,0 +1,149 @@
+/*
+*********************************************************************************************************
+*                                            EXAMPLE CODE
+*
+*               This file is provided as an example on how to use Micrium products.
+*
+*               Please feel free to use any application code labeled as 'EXAMPLE CODE' in
+*               your application products.  Example code may be used as is, in whole or in
+*               part, or may be used as a reference only. This file can be modified as
+*               required to meet the end-product requirements.
+*
+*               Please help us continue to provide the Embedded community with the finest
+*               software available.  Your honesty is greatly appreciated.
+*
+*               You can find our product's user manual, API reference, release notes and
+*               more information at https://doc.micrium.com.
+*               You can contact us at www.micrium.com.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        STACK USAGE MONITOR
+*
+*                                          TI MSP-EXP432P401R
+*                                       LaunchPad Development Kit
+*
+* Filename      : app_stk.h
+* Version       : V1.00
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                                 MODULE
+*
+* Note(s) : (1) This header file is protected from multiple pre-processor inclusion through use of the
+*               APP_STK present pre-processor macro definition.
+*********************************************************************************************************
+*/
+
+#ifndef  APP_STK_PRESENT
+#define  APP_STK_PRESENT
+
+
+/*
+*********************************************************************************************************
+*                                              INCLUDE FILES
+*********************************************************************************************************
+*/
+
+#include  <os.h>
+#include  <app_cfg.h>
+
+
+/*
+*********************************************************************************************************
+*                                        DEFAULT CONFIGURATION
+*
+* Note(s) : (1) APP_CFG_STK_MON_TASK_NBR is the number of stacks (tasks + ISR stack) the monitor keeps track
+*               of.  Entries of deleted tasks are kept so that their peak usage still shows in the report.
+*
+*           (2) APP_CFG_STK_MON_MARGIN_PCT is the safety margin, in percent of the peak usage, added to the
+*               recommended stack sizes.
+*
+*           (3) Recommended stack sizes are rounded up to a multiple of APP_CFG_STK_MON_ALIGN stack elements
+*               (8 elements = 32 bytes on Cortex-M, which also keeps the stacks 8-byte aligned).
+*
+*           (4) APP_CFG_STK_MON_REPORT_PERIOD is the number of App_StkMonUpdate() calls between two reports
+*               output by the start task (see 'app.c  App_TaskStart()'); 0 disables the periodic report.
+*********************************************************************************************************
+*/
+
+#ifndef  APP_CFG_STK_MON_TASK_NBR
+#define  APP_CFG_STK_MON_TASK_NBR                       16u
+#endif
+
+#ifndef  APP_CFG_STK_MON_MARGIN_PCT
+#define  APP_CFG_STK_MON_MARGIN_PCT                     25u
+#endif
+
+#ifndef  APP_CFG_STK_MON_ALIGN
+#define  APP_CFG_STK_MON_ALIGN                           8u
+#endif
+
+#ifndef  APP_CFG_STK_MON_REPORT_PERIOD
+#define  APP_CFG_STK_MON_REPORT_PERIOD                  60u
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                              DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  struct  app_stk_mon {
+    OS_TCB        *TCB_Ptr;                                     /* Task monitored, NULL for the ISR stack.              */
+    CPU_CHAR      *NamePtr;                                     /* Task name, kept after the task is deleted.           */
+    CPU_STK_SIZE   Size;                                        /* Stack size (in CPU_STK elements).                    */
+    CPU_STK_SIZE   UsedMax;                                     /* Peak stack usage (in CPU_STK elements).              */
+    CPU_BOOLEAN    Alive;                                       /* Task still existed at the last update.               */
+} APP_STK_MON;
+
+
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+extern  APP_STK_MON   App_StkMonTbl[APP_CFG_STK_MON_TASK_NBR];  /* Visible to the debugger / uC/Probe.                  */
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void          App_StkMonUpdate    (void);
+
+void          App_StkMonReport    (void);
+
+CPU_STK_SIZE  App_StkSizeRecommend(CPU_STK_SIZE  used);
+
+
+/*
+*********************************************************************************************************
+*                                        CONFIGURATION ERRORS
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN != DEF_ENABLED)
+#error  "app_stk.h requires OS_CFG_DBG_EN enabled in 'os_cfg.h' (task list & names)"
+#endif
+
+#if (APP_CFG_STK_MON_ALIGN < 1u)
+#error  "APP_CFG_STK_MON_ALIGN illegally #define'd in 'app_cfg.h' [MUST be >= 1]"
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*/
+
+#endif
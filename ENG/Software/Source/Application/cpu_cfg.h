@@ -124,6 +124,15 @@
 *                   average the interrupts disabled time measurements overhead.
 *
 *                   See also 'cpu_core.c  CPU_IntDisMeasInit()  Note #3a'.
+*
+*               (c) Configure CPU_CFG_INT_DIS_MEAS_SITE_NBR with the number of critical section sites to keep
+*                   in the worst interrupts disabled time table :
+*
+*                   (a)  Enabled,       if CPU_CFG_INT_DIS_MEAS_SITE_NBR      #define'd in 'cpu_cfg.h'
+*
+*                   (b) Disabled,       if CPU_CFG_INT_DIS_MEAS_SITE_NBR  NOT #define'd in 'cpu_cfg.h'
+*
+*                   See also 'cpu_core.c  CPU_IntDisMeasStartSite()  Note #1'.
 *********************************************************************************************************
 */
 
@@ -134,6 +143,10 @@
                                                                 /* Configure number of interrupts disabled overhead ... */
 #define  CPU_CFG_INT_DIS_MEAS_OVRHD_NBR                    1u   /* ... time measurements (see Note #1b).                */
 
+#if 1                                                           /* Configure number of worst interrupts disabled ...    */
+#define  CPU_CFG_INT_DIS_MEAS_SITE_NBR                     8u   /* ... sites to keep (see Note #1c).                    */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -77,13 +77,15 @@
 *                         MEMORY LIBRARY ASSEMBLY OPTIMIZATION CONFIGURATION
 *
 * Note(s) : (1) Configure LIB_MEM_CFG_OPTIMIZE_ASM_EN to enable/disable assembly-optimized memory function(s).
+*
+*           (2) The assembly-optimized functions are in 'uC-LIB/Ports/ARM-Cortex-M4/CCS/lib_mem_a.asm'.
 *********************************************************************************************************
 */
 
                                                                 /* Assembly-optimized function(s).                      */
                                                                 /* Enable/disable assembly-optimized memory ...         */
                                                                 /* ... function(s). [see Note #1]                       */
-#define  LIB_MEM_CFG_OPTIMIZE_ASM_EN    DEF_DISABLED
+#define  LIB_MEM_CFG_OPTIMIZE_ASM_EN    DEF_ENABLED
 
 
 /*
@@ -103,6 +105,9 @@
 *
 *                   (2) Heap declared to Mem_Heap[] in 'lib_mem.c',       if LIB_MEM_CFG_HEAP_BASE_ADDR
 *                                                                            NOT #define'd in 'lib_cfg.h'
+*
+*           (3) Configure LIB_MEM_CFG_VAR_POOL_EN to enable/disable the variable-size (TLSF) memory pools,
+*               for run-time allocations of arbitrary sizes that must also be freed.
 *********************************************************************************************************
 */
 
@@ -128,6 +133,10 @@
 #endif
 
 
+                                                                /* Variable-size memory pools (see Note #3).            */
+#define  LIB_MEM_CFG_VAR_POOL_EN        DEF_ENABLED
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -161,6 +170,43 @@
 #define  LIB_STR_CFG_FP_MAX_NBR_DIG_SIG         LIB_STR_FP_MAX_NBR_DIG_SIG_DFLT
 
 
+/*
+*********************************************************************************************************
+*                                 STRING WORD-AT-A-TIME CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_STR_CFG_WORD_EN to enable/disable word-at-a-time string search & compare.
+*
+*               See also 'lib_str.h  STRING WORD-AT-A-TIME CONFIGURATION'.
+*********************************************************************************************************
+*/
+
+                                                                /* Scan strings one CPU word at a time [see Note #1].   */
+#define  LIB_STR_CFG_WORD_EN                    DEF_ENABLED
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                     MATH LIBRARY CONFIGURATION
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                  MATH FLOATING POINT CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MATH_CFG_FP_EN to enable/disable the single-precision floating point math
+*               functions; the MSP432P401R has a single-precision FPU.
+*
+*               See also 'lib_math.h  MATH FLOATING POINT CONFIGURATION'.
+*********************************************************************************************************
+*/
+
+                                                                /* Enable/disable FP32 math functions [see Note #1].    */
+#define  LIB_MATH_CFG_FP_EN                     DEF_ENABLED
+
+
 /*
 *********************************************************************************************************
 *                                             MODULE END
@@ -42,11 +42,19 @@
 #define OS_CFG_DBG_EN                   DEF_ENABLED        /* Enable (DEF_ENABLED) debug code/variables                             */
 #define OS_CFG_DYN_TICK_EN              DEF_DISABLED       /* Enable (DEF_ENABLED) the Dynamic Tick                                 */
 #define OS_CFG_INVALID_OS_CALLS_CHK_EN  DEF_ENABLED        /* Enable (DEF_ENABLED) checks for invalid kernel calls                  */
+#define OS_CFG_ISR_POST_DEFERRED_EN     DEF_DISABLED       /* Defer ISR posts to the ISR handler task (see os_int.c)                */
 #define OS_CFG_OBJ_TYPE_CHK_EN          DEF_ENABLED        /* Enable (DEF_ENABLED) object type checking                             */
 #define OS_CFG_TS_EN                    DEF_ENABLED        /* Enable (DEF_ENABLED) time stamping                                    */
 
 #define OS_CFG_PRIO_MAX                 32u                /* Defines the maximum number of task priorities (see OS_PRIO data type) */
-
+#define OS_CFG_PRIO_BITMAP_2L_EN        DEF_DISABLED       /* Two-level ready bitmap: O(1) lookup, up to 1024 prios (see os_prio.c) */
+#define OS_CFG_PEND_LIST_BUCKET_EN      DEF_DISABLED       /* Pend lists indexed by priority: O(1) insert/remove (see os_core.c)    */
+#define OS_CFG_PEND_MULTI_EN            DEF_DISABLED       /* Include (DEF_ENABLED) OSPendMulti() on semaphores, queues and flags   */
+
+#define OS_CFG_SCHED_EDF_EN             DEF_DISABLED       /* EDF scheduling of a band of priorities (see os_edf.c)                 */
+#define OS_CFG_SCHED_EDF_PRIO_HI        8u                 /*     Highest priority of the EDF band                                  */
+#define OS_CFG_SCHED_EDF_PRIO_LO        11u                /*     Lowest  priority of the EDF band                                  */
+#define OS_CFG_SCHED_EDF_TASK_MAX       8u                 /*     Max. nbr of tasks created in the EDF band (size of the heap)      */
 #define OS_CFG_SCHED_LOCK_TIME_MEAS_EN  DEF_DISABLED       /* Include (DEF_ENABLED) code to measure scheduler lock time             */
 #define OS_CFG_SCHED_ROUND_ROBIN_EN     DEF_ENABLED        /* Include (DEF_ENABLED) code for Round-Robin scheduling                 */
 
@@ -58,14 +66,18 @@
 #define OS_CFG_FLAG_DEL_EN              DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSFlagDel()                        */
 #define OS_CFG_FLAG_MODE_CLR_EN         DEF_ENABLED        /*     Include (DEF_ENABLED) code for Wait on Clear EVENT FLAGS          */
 #define OS_CFG_FLAG_PEND_ABORT_EN       DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSFlagPendAbort()                  */
+#define OS_CFG_FLAG_IDX_EN              DEF_DISABLED       /*     Index waiters by flag bit, OSFlagPost() only checks candidates    */
+#define OS_CFG_FLAG_64_EN               DEF_DISABLED       /*     Use 64-bit (DEF_ENABLED) instead of 32-bit OS_FLAGS               */
 
 
                                                            /* ------------------------ MEMORY MANAGEMENT -------------------------  */
 #define OS_CFG_MEM_EN                   DEF_ENABLED        /* Enable (DEF_ENABLED) code generation for the MEMORY MANAGER           */
+#define OS_CFG_MEM_LOCK_FREE_EN         DEF_DISABLED       /*     Use lock-free (DEF_ENABLED) OSMemGet() and OSMemPut()             */
 
 
                                                            /* ------------------- MUTUAL EXCLUSION SEMAPHORES --------------------  */
 #define OS_CFG_MUTEX_EN                 DEF_ENABLED        /* Enable (DEF_ENABLED) code generation for MUTEX                        */
+#define OS_CFG_MUTEX_CEILING_EN         DEF_ENABLED        /*     Include (DEF_ENABLED) code for priority-ceiling mutexes           */
 #define OS_CFG_MUTEX_DEL_EN             DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSMutexDel()                       */
 #define OS_CFG_MUTEX_PEND_ABORT_EN      DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSMutexPendAbort()                 */
 
@@ -75,6 +87,7 @@
 #define OS_CFG_Q_DEL_EN                 DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSQDel()                           */
 #define OS_CFG_Q_FLUSH_EN               DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSQFlush()                         */
 #define OS_CFG_Q_PEND_ABORT_EN          DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSQPendAbort()                     */
+#define OS_CFG_Q_SLOT_EN                DEF_ENABLED        /*     Include (DEF_ENABLED) private slots, inline and bulk queue calls  */
 
 
                                                            /* ---------------------------- SEMAPHORES ----------------------------- */
@@ -82,6 +95,7 @@
 #define OS_CFG_SEM_DEL_EN               DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSSemDel()                         */
 #define OS_CFG_SEM_PEND_ABORT_EN        DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSSemPendAbort()                   */
 #define OS_CFG_SEM_SET_EN               DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSSemSet()                         */
+#define OS_CFG_SEM_BATCH_EN             DEF_ENABLED        /*     Include (DEF_ENABLED) code for OSSemPostN() & OSSemPendUpTo()     */
 
 
                                                            /* ----------------------------- MONITORS ------------------------------ */
@@ -92,15 +106,19 @@
 #define OS_CFG_STAT_TASK_EN             DEF_ENABLED        /* Enable (DEF_ENABLED) the statistics task                              */
 #define OS_CFG_STAT_TASK_STK_CHK_EN     DEF_ENABLED        /*     Check task stacks (DEF_ENABLED) from the statistic task           */
 
+#define OS_CFG_TASK_BUDGET_EN           DEF_DISABLED       /* Include (DEF_ENABLED) code for OSTaskBudgetSet() (CPU budgets)        */
 #define OS_CFG_TASK_CHANGE_PRIO_EN      DEF_ENABLED        /* Include (DEF_ENABLED) code for OSTaskChangePrio()                     */
 #define OS_CFG_TASK_DEL_EN              DEF_ENABLED        /* Include (DEF_ENABLED) code for OSTaskDel()                            */
 #define OS_CFG_TASK_IDLE_EN             DEF_ENABLED        /* Include (DEF_ENABLED) the idle task                                   */
+#define OS_CFG_TASK_PERIOD_EN           DEF_ENABLED        /* Include (DEF_ENABLED) code for OSTaskPeriodXXX()                       */
 #define OS_CFG_TASK_PROFILE_EN          DEF_ENABLED        /* Include (DEF_ENABLED) variables in OS_TCB for profiling               */
 #define OS_CFG_TASK_Q_EN                DEF_ENABLED        /* Include (DEF_ENABLED) code for OSTaskQXXXX()                          */
 #define OS_CFG_TASK_Q_PEND_ABORT_EN     DEF_ENABLED        /* Include (DEF_ENABLED) code for OSTaskQPendAbort()                     */
+#define OS_CFG_TASK_Q_SLOT_EN           DEF_DISABLED       /* Include (DEF_ENABLED) code for OSTaskQSlotsSet() (private slots)      */
 #define OS_CFG_TASK_REG_TBL_SIZE        1u                 /* Number of task specific registers                                     */
 #define OS_CFG_TASK_STK_REDZONE_EN      DEF_DISABLED       /* Enable (DEF_ENABLED) stack redzone                                    */
 #define OS_CFG_TASK_STK_REDZONE_DEPTH   8u                 /*     Depth of the stack redzone                                        */
+#define OS_CFG_TASK_STK_GUARD_EN        DEF_DISABLED       /* Enable (DEF_ENABLED) MPU stack guard on the running task (port)       */
 #define OS_CFG_TASK_SEM_PEND_ABORT_EN   DEF_ENABLED        /* Include (DEF_ENABLED) code for OSTaskSemPendAbort()                   */
 #define OS_CFG_TASK_SUSPEND_EN          DEF_ENABLED        /* Include (DEF_ENABLED) code for OSTaskSuspend() and OSTaskResume()     */
 #define OS_CFG_TASK_TICK_EN             DEF_ENABLED        /* Include (DEF_ENABLED) the kernel tick task                            */
@@ -120,5 +138,8 @@
 #define OS_CFG_TRACE_EN                 DEF_DISABLED       /* Enable (DEF_ENABLED) uC/OS-III Trace instrumentation                  */
 #define OS_CFG_TRACE_API_ENTER_EN       DEF_DISABLED       /* Enable (DEF_ENABLED) uC/OS-III Trace API enter instrumentation        */
 #define OS_CFG_TRACE_API_EXIT_EN        DEF_DISABLED       /* Enable (DEF_ENABLED) uC/OS-III Trace API exit  instrumentation        */
+#define OS_CFG_TRACE_REC_EVT_NBR        512u               /*     Nbr of 8-byte events in the trace ring (power of 2)               */
+#define OS_CFG_TRACE_REC_OBJ_NBR         16u               /*     Nbr of named tasks/objects in the trace object table              */
+#define OS_CFG_TRACE_REC_MODE           OS_TRACE_REC_MODE_OVERWRITE  /* OVERWRITE (ring) or STOP_WHEN_FULL (one-shot)       */
 
 #endif
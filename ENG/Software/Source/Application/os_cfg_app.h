@@ -48,6 +48,11 @@
 #define  OS_CFG_TASK_STK_LIMIT_PCT_EMPTY              10u       /* Stack limit position in percentage to empty          */
 
 
+                                                                /* ----------------- ISR HANDLER TASK ----------------- */
+#define  OS_CFG_INT_Q_SIZE                            16u       /* Size of the deferred ISR post queue (see os_int.c)   */
+#define  OS_CFG_INT_Q_TASK_STK_SIZE                  128u       /* Stack size (number of CPU_STK elements)              */
+
+
                                                                 /* -------------------- IDLE TASK --------------------- */
 #define  OS_CFG_IDLE_TASK_STK_SIZE                   128u       /* Stack size (number of CPU_STK elements)              */
 
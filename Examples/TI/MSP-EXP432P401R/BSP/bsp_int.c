@@ -75,6 +75,10 @@
 
 static CPU_FNCT_VOID BSP_IntVectTbl[BSP_INT_ID_MAX];
 
+#if (BSP_CFG_INT_PROF_EN == DEF_ENABLED)
+static BSP_INT_PROF  BSP_IntProfTbl[BSP_INT_ID_MAX];            /* Per-source profiling data, see 'bsp_int.h' Note #1.  */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -82,6 +86,13 @@ static CPU_FNCT_VOID BSP_IntVectTbl[BSP_INT_ID_MAX];
 *********************************************************************************************************
 */
 
+#if (BSP_CFG_INT_PROF_EN == DEF_ENABLED)
+static CPU_INT08U    BSP_IntProfNestCtr;                        /* Cur nesting level of BSP_IntHandler().               */
+static CPU_INT08U    BSP_IntProfNestMax;                        /* Max nesting level reached since last reset.          */
+                                                                /* Time spent in ISRs nested above each level.          */
+static CPU_TS_TMR    BSP_IntProfNestCycles[BSP_CFG_INT_PROF_NEST_MAX];
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -89,7 +100,15 @@ static CPU_FNCT_VOID BSP_IntVectTbl[BSP_INT_ID_MAX];
 *********************************************************************************************************
 */
 
-static  void  BSP_IntHandlerDummy (void);
+static  void        BSP_IntHandlerDummy (void);
+
+#if (BSP_CFG_INT_PROF_EN == DEF_ENABLED)
+static  CPU_TS_TMR  BSP_IntProfEnter    (void);
+
+static  void        BSP_IntProfExit     (CPU_INT16U  src_nbr,
+                                         CPU_TS_TMR  ts_entry,
+                                         CPU_TS_TMR  cycles);
+#endif
 
 
 /*
@@ -98,6 +117,16 @@ static  void  BSP_IntHandlerDummy (void);
 *********************************************************************************************************
 */
 
+#if (BSP_CFG_INT_PROF_EN == DEF_ENABLED)
+#if (CPU_CFG_TS_TMR_EN != DEF_ENABLED)
+#error  "BSP_CFG_INT_PROF_EN requires CPU_CFG_TS_32_EN or CPU_CFG_TS_64_EN enabled in 'cpu_cfg.h'"
+#endif
+
+#if ((BSP_CFG_INT_PROF_NEST_MAX < 1u) || (BSP_CFG_INT_PROF_NEST_MAX > 255u))
+#error  "BSP_CFG_INT_PROF_NEST_MAX illegally #define'd in 'app_cfg.h' [MUST be >= 1 && <= 255]"
+#endif
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -226,6 +255,116 @@ void  BSP_IntVectSet (CPU_INT08U     int_id,
 }
 
 
+/*
+*********************************************************************************************************
+*                                          BSP_IntProfReset()
+*
+* Description : Reset the interrupt profiling data of all interrupt sources.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application,
+*               BSP_IntInit().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (BSP_CFG_INT_PROF_EN == DEF_ENABLED)
+void  BSP_IntProfReset (void)
+{
+    BSP_INT_PROF  *p_prof;
+    CPU_INT32U     int_id;
+    CPU_SR_ALLOC();
+
+
+    for (int_id = 0u; int_id < BSP_INT_ID_MAX; int_id++) {
+        p_prof = &BSP_IntProfTbl[int_id];
+        CPU_CRITICAL_ENTER();
+        p_prof->Ctr       = 0u;
+        p_prof->CyclesMin = 0u;
+        p_prof->CyclesMax = 0u;
+        p_prof->CyclesTot = 0u;
+        CPU_CRITICAL_EXIT();
+    }
+
+    CPU_CRITICAL_ENTER();
+    BSP_IntProfNestMax = BSP_IntProfNestCtr;                    /* Keep cur level, reset may be called from an ISR.     */
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           BSP_IntProfGet()
+*
+* Description : Get a snapshot of the profiling data of an interrupt source.
+*
+* Argument(s) : int_id      Interrupt source to get the profiling data of.
+*
+*               p_prof      Pointer to variable that will receive the profiling data.
+*
+* Return(s)   : DEF_OK,   if profiling data successfully copied.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Times are expressed in CPU timestamp timer counts.  The average execution time is
+*                   CyclesTot / Ctr; CPU_TS_TmrFreqGet() converts counts to seconds.
+*********************************************************************************************************
+*/
+
+#if (BSP_CFG_INT_PROF_EN == DEF_ENABLED)
+CPU_BOOLEAN  BSP_IntProfGet (CPU_INT08U     int_id,
+                             BSP_INT_PROF  *p_prof)
+{
+    CPU_SR_ALLOC();
+
+
+    if (int_id >= BSP_INT_ID_MAX) {
+        return (DEF_FAIL);
+    }
+    if (p_prof == (BSP_INT_PROF *)0) {
+        return (DEF_FAIL);
+    }
+
+    CPU_CRITICAL_ENTER();                                       /* Copy atomically, 64-bit total is not atomic.         */
+   *p_prof = BSP_IntProfTbl[int_id];
+    CPU_CRITICAL_EXIT();
+
+    return (DEF_OK);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        BSP_IntProfNestMaxGet()
+*
+* Description : Get the maximum interrupt nesting depth reached since the last reset.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Maximum nesting depth (1 means no interrupt was ever nested).
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (BSP_CFG_INT_PROF_EN == DEF_ENABLED)
+CPU_INT08U  BSP_IntProfNestMaxGet (void)
+{
+    return (BSP_IntProfNestMax);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -259,6 +398,10 @@ void  BSP_IntInit (void)
         BSP_IntVectSet((CPU_INT08U)int_id,
                        (CPU_FNCT_VOID)BSP_IntHandlerDummy);
     }
+
+#if (BSP_CFG_INT_PROF_EN == DEF_ENABLED)
+    BSP_IntProfReset();
+#endif
 }
 
 
@@ -366,26 +509,160 @@ static void  BSP_IntHandlerDummy (void)
 *
 * Caller(s)   : CPU_IntHandler().
 *
-* Note(s)     : none.
+* Note(s)     : (1) When BSP_CFG_INT_PROF_EN is enabled, the execution time of the handler is measured and
+*                   accounted to the interrupt source, see 'bsp_int.h  DEFAULT CONFIGURATION  Note #1'.
 *********************************************************************************************************
 */
 
 void  BSP_IntHandler (CPU_INT16U  src_nbr)
 {
     CPU_FNCT_VOID  isr;
+#if (BSP_CFG_INT_PROF_EN == DEF_ENABLED)
+    CPU_TS_TMR     ts_entry;
+    CPU_TS_TMR     ts_start;
+    CPU_TS_TMR     cycles;
+#endif
     CPU_SR_ALLOC();
 
     CPU_CRITICAL_ENTER();                                       /* Tell the OS that we are starting an ISR            */
     OSIntEnter();
+#if (BSP_CFG_INT_PROF_EN == DEF_ENABLED)
+    ts_entry = BSP_IntProfEnter();
+    cycles   = 0u;
+#endif
     CPU_CRITICAL_EXIT();
 
+    OS_TRACE_ISR_BEGIN(src_nbr);                                /* Record which source is being serviced              */
+
     if (src_nbr < BSP_INT_ID_MAX) {
         isr = BSP_IntVectTbl[src_nbr];
         if (isr != (CPU_FNCT_VOID)0) {
+#if (BSP_CFG_INT_PROF_EN == DEF_ENABLED)
+            ts_start = CPU_TS_TmrRd();
+            isr();
+            cycles   = CPU_TS_TmrRd() - ts_start;               /* Incl. nested ISRs, removed by BSP_IntProfExit()    */
+#else
             isr();
+#endif
         }
     }
 
+    OS_TRACE_ISR_END();
+
+#if (BSP_CFG_INT_PROF_EN == DEF_ENABLED)
+    CPU_CRITICAL_ENTER();
+    BSP_IntProfExit(src_nbr, ts_entry, cycles);
+    CPU_CRITICAL_EXIT();
+#endif
+
     OSIntExit();                                                /* Tell the OS that we are leaving the ISR            */
 }
 
+
+/*
+*********************************************************************************************************
+*                                          BSP_IntProfEnter()
+*
+* Description : Account for the entry in an interrupt handler.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Timestamp of the handler's entry (in ts tmr cnts).
+*
+* Caller(s)   : BSP_IntHandler().
+*
+* Note(s)     : (1) MUST be called with interrupts disabled.
+*********************************************************************************************************
+*/
+
+#if (BSP_CFG_INT_PROF_EN == DEF_ENABLED)
+static  CPU_TS_TMR  BSP_IntProfEnter (void)
+{
+    CPU_INT08U  nest;
+
+
+    if (BSP_IntProfNestCtr < DEF_INT_08U_MAX_VAL) {
+        BSP_IntProfNestCtr++;
+    }
+    nest = BSP_IntProfNestCtr;
+    if (nest > BSP_IntProfNestMax) {
+        BSP_IntProfNestMax = nest;
+    }
+    if (nest <= BSP_CFG_INT_PROF_NEST_MAX) {
+        BSP_IntProfNestCycles[nest - 1u] = 0u;                  /* Nothing nested above this level yet.                 */
+    }
+
+    return (CPU_TS_TmrRd());
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                          BSP_IntProfExit()
+*
+* Description : Account for the execution of an interrupt handler.
+*
+* Argument(s) : src_nbr     Interrupt source that was serviced.
+*
+*               ts_entry    Timestamp of the handler's entry, as returned by BSP_IntProfEnter().
+*
+*               cycles      Execution time of the source's ISR, including nested interrupts.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : BSP_IntHandler().
+*
+* Note(s)     : (1) MUST be called with interrupts disabled.
+*
+*               (2) The time spent in nested interrupts, from their entry to their exit of BSP_IntHandler(),
+*                   is removed from the preempted handler's time.  Only the exception stacking/unstacking
+*                   of the nested interrupts remains charged to the preempted handler.
+*********************************************************************************************************
+*/
+
+#if (BSP_CFG_INT_PROF_EN == DEF_ENABLED)
+static  void  BSP_IntProfExit (CPU_INT16U  src_nbr,
+                               CPU_TS_TMR  ts_entry,
+                               CPU_TS_TMR  cycles)
+{
+    BSP_INT_PROF  *p_prof;
+    CPU_TS_TMR     cycles_nested;
+    CPU_INT08U     nest;
+
+
+    nest = BSP_IntProfNestCtr;
+    if ((nest >= 1u) &&
+        (nest <= BSP_CFG_INT_PROF_NEST_MAX)) {                  /* Remove time spent in nested ISRs (see Note #2).      */
+        cycles_nested = BSP_IntProfNestCycles[nest - 1u];
+        if (cycles > cycles_nested) {
+            cycles -= cycles_nested;
+        } else {
+            cycles  = 0u;
+        }
+    }
+
+    if (src_nbr < BSP_INT_ID_MAX) {
+        p_prof = &BSP_IntProfTbl[src_nbr];
+        p_prof->Ctr++;
+        if ((p_prof->Ctr       == 1u) ||
+            (p_prof->CyclesMin >  cycles)) {
+            p_prof->CyclesMin = cycles;
+        }
+        if (p_prof->CyclesMax < cycles) {
+            p_prof->CyclesMax = cycles;
+        }
+        p_prof->CyclesTot += cycles;
+    }
+
+    if (nest >= 1u) {
+        nest--;
+        BSP_IntProfNestCtr = nest;
+    }
+    if ((nest >= 1u) &&
+        (nest <= BSP_CFG_INT_PROF_NEST_MAX)) {                  /* Charge this handler's span to the preempted level.   */
+        BSP_IntProfNestCycles[nest - 1u] += CPU_TS_TmrRd() - ts_entry;
+    }
+}
+#endif
+
@@ -50,7 +50,10 @@
 *********************************************************************************************************
 */
 
+#include  <cpu.h>
+#include  <cpu_core.h>
 #include  <lib_def.h>
+#include  <app_cfg.h>
 
 
 /*
@@ -69,9 +72,29 @@
 /*
 *********************************************************************************************************
 *                                        DEFAULT CONFIGURATION
+*
+* Note(s) : (1) BSP_CFG_INT_PROF_EN enables/disables per-source interrupt profiling in BSP_IntHandler() :
+*
+*               (a) Number of times each source was serviced
+*               (b) Minimum, maximum & total execution time of each source's handler, in CPU timestamp
+*                   timer counts (i.e. DWT CYCCNT cycles)
+*               (c) Maximum interrupt nesting depth reached
+*
+*           (2) BSP_CFG_INT_PROF_NEST_MAX is the deepest nesting level for which execution time is tracked.
+*               Time spent in nested (higher priority) interrupts is removed from the preempted handler's
+*               time so that each source is only charged for its own execution.  The MSP432 NVIC implements
+*               8 priority levels, hence 8 levels suffice.
 *********************************************************************************************************
 */
 
+#ifndef  BSP_CFG_INT_PROF_EN
+#define  BSP_CFG_INT_PROF_EN                    DEF_DISABLED
+#endif
+
+#ifndef  BSP_CFG_INT_PROF_NEST_MAX
+#define  BSP_CFG_INT_PROF_NEST_MAX                       8u
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -138,6 +161,22 @@
 */
 
 
+/*
+*********************************************************************************************************
+*                                              DATA TYPES
+*********************************************************************************************************
+*/
+
+#if (BSP_CFG_INT_PROF_EN == DEF_ENABLED)
+typedef  struct  bsp_int_prof {
+    CPU_INT32U   Ctr;                                           /* Nbr of times the source was serviced.                */
+    CPU_TS_TMR   CyclesMin;                                     /* Min handler exec time (in ts tmr cnts).              */
+    CPU_TS_TMR   CyclesMax;                                     /* Max handler exec time (in ts tmr cnts).              */
+    CPU_INT64U   CyclesTot;                                     /* Total handler exec time (in ts tmr cnts).            */
+} BSP_INT_PROF;
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          GLOBAL VARIABLES
@@ -175,6 +214,15 @@ void  BSP_IntVectSet                       (CPU_INT08U     int_id,
 
 void  BSP_IntHandler                       (CPU_INT16U     src_nbr);
 
+#if (BSP_CFG_INT_PROF_EN == DEF_ENABLED)
+void         BSP_IntProfReset              (void);
+
+CPU_BOOLEAN  BSP_IntProfGet                (CPU_INT08U     int_id,
+                                            BSP_INT_PROF  *p_prof);
+
+CPU_INT08U   BSP_IntProfNestMaxGet         (void);
+#endif
+
 void  BSP_IntHandlerPSS                    (void);
 void  BSP_IntHandlerCS                     (void);
 void  BSP_IntHandlerPCM                    (void);
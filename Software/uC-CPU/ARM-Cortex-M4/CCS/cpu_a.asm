@@ -51,6 +51,9 @@
     .global  CPU_CntTrailZeros
     .global  CPU_RevBits
 
+    .global  CPU_AtomicFetchAdd32
+    .global  CPU_RetAddrGet
+
 
 ;********************************************************************************************************
 ;                                      CODE GENERATION DIRECTIVES
@@ -291,6 +294,69 @@ CPU_RevBits:
     .endasmfunc
 
 
+;********************************************************************************************************
+;                                       CPU_AtomicFetchAdd32()
+;                                        ATOMIC FETCH AND ADD
+;
+; Description : Atomically adds a value to a 32-bit memory location without disabling interrupts.
+;
+; Prototypes  : CPU_INT32U  CPU_AtomicFetchAdd32(CPU_INT32U  *p_val,
+;                                                CPU_INT32U   val);
+;
+; Argument(s) : p_val       Pointer to the 32-bit, word-aligned memory location to update.
+;
+;               val         Value to add.
+;
+; Return(s)   : Value of '*p_val' before the addition.
+;
+; Caller(s)   : Application.
+;
+;               This function is an INTERNAL CPU module function but MAY be called by application function(s).
+;
+; Note(s)     : (1) Implemented with LDREX/STREX.  The exclusive monitor is cleared on every exception entry &
+;                   return, so an interrupting ISR (or a context switch) simply forces a retry.  The function
+;                   MAY therefore be called from both task & ISR context.
+;********************************************************************************************************
+
+    .asmfunc
+CPU_AtomicFetchAdd32:
+        LDREX   R2, [R0]                        ; Load current value & set exclusive monitor
+        ADD     R3, R2, R1                      ; Compute new value
+        STREX   R12, R3, [R0]                   ; Try to store new value
+        CMP     R12, #0                         ; Exclusive access lost (ISR/ctx switch)?
+        BNE     CPU_AtomicFetchAdd32            ; ... yes, retry
+        MOV     R0, R2                          ; Return previous value
+        BX      LR
+    .endasmfunc
+
+
+;********************************************************************************************************
+;                                          CPU_RetAddrGet()
+;                                        GET RETURN ADDRESS
+;
+; Description : Get the address the function returns to, i.e. the address of the code that called it.
+;
+; Prototypes  : CPU_ADDR  CPU_RetAddrGet(void);
+;
+; Argument(s) : none.
+;
+; Return(s)   : Address of the instruction following the call, with the Thumb bit cleared.
+;
+; Caller(s)   : CPU_CRITICAL_ENTER().
+;
+;               This function is an INTERNAL CPU module function but MAY be called by application function(s).
+;
+; Note(s)     : (1) Used to identify the call site of a critical section, see 'cpu_core.c
+;                   CPU_IntDisMeasStartSite()'.
+;********************************************************************************************************
+
+    .asmfunc
+CPU_RetAddrGet:
+        BIC     R0, LR, #1                      ; Return caller's addr, w/o Thumb bit
+        BX      LR
+    .endasmfunc
+
+
 ;********************************************************************************************************
 ;                                     CPU ASSEMBLY PORT FILE END
 ;********************************************************************************************************
@@ -320,10 +320,18 @@ typedef  CPU_INT32U                 CPU_SR;                     /* Defines   CPU
 
 
 #ifdef   CPU_CFG_INT_DIS_MEAS_EN
+#ifdef   CPU_CFG_INT_DIS_MEAS_SITE_NBR
+                                                                        /* Disable interrupts, ...                      */
+                                                                        /* & start interrupts disabled time measurement,*/
+                                                                        /* ... recording the critical section's site.   */
+#define  CPU_CRITICAL_ENTER()  do { CPU_INT_DIS();                                 \
+                                    CPU_IntDisMeasStartSite(CPU_RetAddrGet()); }  while (0)
+#else
                                                                         /* Disable interrupts, ...                      */
                                                                         /* & start interrupts disabled time measurement.*/
 #define  CPU_CRITICAL_ENTER()  do { CPU_INT_DIS();         \
                                     CPU_IntDisMeasStart(); }  while (0)
+#endif
                                                                         /* Stop & measure   interrupts disabled time,   */
                                                                         /* ...  & re-enable interrupts.                 */
 #define  CPU_CRITICAL_EXIT()   do { CPU_IntDisMeasStop();  \
@@ -413,6 +421,11 @@ void        CPU_WaitForExcept(void);
 
 CPU_DATA    CPU_RevBits      (CPU_DATA    val);
 
+CPU_INT32U  CPU_AtomicFetchAdd32(CPU_INT32U  *p_val,
+                                 CPU_INT32U   val);
+
+CPU_ADDR    CPU_RetAddrGet   (void);
+
 void        CPU_BitBandClr   (CPU_ADDR    addr,
                               CPU_INT08U  bit_nbr);
 void        CPU_BitBandSet   (CPU_ADDR    addr,
@@ -157,6 +157,11 @@ static  void        CPU_TS_Init          (void);
 static  void        CPU_IntDisMeasInit   (void);
 
 static  CPU_TS_TMR  CPU_IntDisMeasMaxCalc(CPU_TS_TMR  time_tot_cnts);
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_SITE_NBR
+static  void        CPU_IntDisMeasSiteUpdate(CPU_ADDR    site,
+                                             CPU_TS_TMR  time_cnts);
+#endif
 #endif
 
 
@@ -724,6 +729,9 @@ CPU_TS_TMR  CPU_IntDisMeasMaxCurReset (void)
     time_max_cnts             = CPU_IntDisMeasMaxCurGet();
     CPU_INT_DIS();
     CPU_IntDisMeasMaxCur_cnts = 0u;
+#ifdef  CPU_CFG_INT_DIS_MEAS_SITE_NBR
+    CPU_IntDisMeasMaxCurSite  = 0u;
+#endif
     CPU_INT_EN();
 
     return (time_max_cnts);
@@ -815,6 +823,185 @@ CPU_TS_TMR  CPU_IntDisMeasMaxGet (void)
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                    CPU_IntDisMeasMaxCurSiteGet()
+*
+* Description : Get the site of the current maximum interrupts disabled time.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Address of the critical section that disabled interrupts for the current maximum time,
+*
+*               0, if NO site recorded since the last reset.
+*
+* Caller(s)   : Application.
+*
+*               This function is a CPU module application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) The returned address follows the CPU_CRITICAL_ENTER() of the critical section;
+*                   look it up in the linker map file (or a disassembly) to find the function.
+*
+*               (2) After initialization, 'CPU_IntDisMeasMaxCurSite' MUST ALWAYS be accessed
+*                   exclusively with interrupts disabled -- but NOT with critical sections.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_SITE_NBR
+CPU_ADDR  CPU_IntDisMeasMaxCurSiteGet (void)
+{
+    CPU_ADDR  site;
+    CPU_SR_ALLOC();
+
+
+    CPU_INT_DIS();
+    site = CPU_IntDisMeasMaxCurSite;
+    CPU_INT_EN();
+
+    return (site);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     CPU_IntDisMeasMaxSiteGet()
+*
+* Description : Get the site of the (non-resetable) maximum interrupts disabled time.
+*
+* Argument(s) : none.
+*
+* Return(s)   : Address of the critical section that disabled interrupts for the maximum time,
+*
+*               0, if NO site recorded.
+*
+* Caller(s)   : Application.
+*
+*               This function is a CPU module application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) See 'CPU_IntDisMeasMaxCurSiteGet()  Note #1'.
+*
+*               (2) After initialization, 'CPU_IntDisMeasMaxSite' MUST ALWAYS be accessed
+*                   exclusively with interrupts disabled -- but NOT with critical sections.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_SITE_NBR
+CPU_ADDR  CPU_IntDisMeasMaxSiteGet (void)
+{
+    CPU_ADDR  site;
+    CPU_SR_ALLOC();
+
+
+    CPU_INT_DIS();
+    site = CPU_IntDisMeasMaxSite;
+    CPU_INT_EN();
+
+    return (site);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     CPU_IntDisMeasSiteTblGet()
+*
+* Description : Get the worst interrupts disabled time sites.
+*
+* Argument(s) : p_tbl       Pointer to table that will receive the sites, sorted by decreasing maximum
+*                               interrupts disabled time.
+*
+*               nbr_max     Number of entries available in 'p_tbl'.
+*
+* Return(s)   : Number of sites copied to 'p_tbl'.
+*
+* Caller(s)   : Application.
+*
+*               This function is a CPU module application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) The maximum times returned are compensated for the time measurement overhead, like
+*                   CPU_IntDisMeasMaxGet().
+*
+*               (2) After initialization, 'CPU_IntDisMeasSiteTbl' MUST ALWAYS be accessed exclusively
+*                   with interrupts disabled -- but NOT with critical sections.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_SITE_NBR
+CPU_SIZE_T  CPU_IntDisMeasSiteTblGet (CPU_INT_DIS_MEAS_SITE  *p_tbl,
+                                      CPU_SIZE_T              nbr_max)
+{
+    CPU_INT_DIS_MEAS_SITE  site;
+    CPU_SIZE_T             ix;
+    CPU_SR_ALLOC();
+
+
+    if (p_tbl == (CPU_INT_DIS_MEAS_SITE *)0) {
+        return (0u);
+    }
+
+    if (nbr_max > CPU_CFG_INT_DIS_MEAS_SITE_NBR) {
+        nbr_max = CPU_CFG_INT_DIS_MEAS_SITE_NBR;
+    }
+
+    for (ix = 0u; ix < nbr_max; ix++) {
+        CPU_INT_DIS();                                          /* Copy one entry at a time to keep ints dis'd short.   */
+        site = CPU_IntDisMeasSiteTbl[ix];
+        CPU_INT_EN();
+        if (site.Addr == 0u) {                                  /* Tbl not yet full.                                    */
+            break;
+        }
+        p_tbl[ix].Addr     = site.Addr;
+        p_tbl[ix].Max_cnts = CPU_IntDisMeasMaxCalc(site.Max_cnts);
+    }
+
+    return (ix);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    CPU_IntDisMeasSiteTblReset()
+*
+* Description : Reset the worst interrupts disabled time sites table.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : CPU_IntDisMeasInit(),
+*               Application.
+*
+*               This function is a CPU module application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) After initialization, 'CPU_IntDisMeasSiteTbl' MUST ALWAYS be accessed exclusively
+*                   with interrupts disabled -- but NOT with critical sections.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_SITE_NBR
+void  CPU_IntDisMeasSiteTblReset (void)
+{
+    CPU_SIZE_T  ix;
+    CPU_SR_ALLOC();
+
+
+    CPU_INT_DIS();
+    for (ix = 0u; ix < CPU_CFG_INT_DIS_MEAS_SITE_NBR; ix++) {
+        CPU_IntDisMeasSiteTbl[ix].Addr     = 0u;
+        CPU_IntDisMeasSiteTbl[ix].Max_cnts = 0u;
+    }
+    CPU_IntDisMeasSiteTh_cnts = 0u;
+    CPU_INT_EN();
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                        CPU_IntDisMeasStart()
@@ -846,6 +1033,37 @@ void  CPU_IntDisMeasStart (void)
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                      CPU_IntDisMeasStartSite()
+*
+* Description : Start interrupts disabled time measurement & record the site disabling interrupts.
+*
+* Argument(s) : site        Address of the critical section, as returned by CPU_RetAddrGet().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : CPU_CRITICAL_ENTER().
+*
+*               This function is an INTERNAL CPU module function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : (1) Only the site of the outermost critical section is recorded; nested critical sections
+*                   are accounted to the site that first disabled interrupts.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_SITE_NBR
+void  CPU_IntDisMeasStartSite (CPU_ADDR  site)
+{
+    if (CPU_IntDisNestCtr == 0u) {                                  /* If ints NOT yet dis'd, ...                       */
+        CPU_IntDisMeasSiteCur = site;                               /* ... record site (see Note #1).                   */
+    }
+    CPU_IntDisMeasStart();
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                        CPU_IntDisMeasStop()
@@ -1015,6 +1233,11 @@ void  CPU_IntDisMeasStart (void)
 *                               overhead is performed asynchronously in appropriate API functions.
 *
 *                               See also 'CPU_IntDisMeasMaxCalc()  Note #1b'.
+*
+*               (2) When CPU_CFG_INT_DIS_MEAS_SITE_NBR is #define'd, the site of each new maximum is recorded
+*                   & the worst sites table is updated.  The table is only searched when the measured time
+*                   exceeds the smallest time in the (full) table, so short critical sections add just one
+*                   comparison.  The update itself is NOT included in the measured time.
 *********************************************************************************************************
 */
 
@@ -1033,10 +1256,24 @@ void  CPU_IntDisMeasStop (void)
                                                                     /* Calc max ints dis'd times.                       */
         if (CPU_IntDisMeasMaxCur_cnts < time_ints_disd_cnts) {
             CPU_IntDisMeasMaxCur_cnts = time_ints_disd_cnts;
+#ifdef  CPU_CFG_INT_DIS_MEAS_SITE_NBR
+            CPU_IntDisMeasMaxCurSite  = CPU_IntDisMeasSiteCur;
+#endif
         }
         if (CPU_IntDisMeasMax_cnts    < time_ints_disd_cnts) {
             CPU_IntDisMeasMax_cnts    = time_ints_disd_cnts;
+#ifdef  CPU_CFG_INT_DIS_MEAS_SITE_NBR
+            CPU_IntDisMeasMaxSite     = CPU_IntDisMeasSiteCur;
+#endif
+        }
+#ifdef  CPU_CFG_INT_DIS_MEAS_SITE_NBR
+                                                                    /* Upd worst sites tbl (see Note #2).               */
+        if ((CPU_IntDisMeasSiteTh_cnts < time_ints_disd_cnts) &&
+            (CPU_IntDisMeasSiteCur     != 0u)) {
+            CPU_IntDisMeasSiteUpdate(CPU_IntDisMeasSiteCur, time_ints_disd_cnts);
         }
+        CPU_IntDisMeasSiteCur = 0u;
+#endif
     }
 }
 #endif
@@ -2115,6 +2352,9 @@ void  CPU_StatReset (void)
 {
 #ifdef  CPU_CFG_INT_DIS_MEAS_EN
     CPU_IntDisMeasMax_cnts = 0u;
+#ifdef  CPU_CFG_INT_DIS_MEAS_SITE_NBR
+    CPU_IntDisMeasMaxSite  = 0u;
+#endif
 #endif
 }
 #endif
@@ -2289,7 +2529,16 @@ static  void  CPU_IntDisMeasInit (void)
                                                     /  CPU_CFG_INT_DIS_MEAS_OVRHD_NBR;
     CPU_IntDisMeasMaxCur_cnts =  0u;                            /* Reset max ints dis'd times.                          */
     CPU_IntDisMeasMax_cnts    =  0u;
+#ifdef  CPU_CFG_INT_DIS_MEAS_SITE_NBR
+    CPU_IntDisMeasSiteCur     =  0u;                            /* Reset max ints dis'd sites.                          */
+    CPU_IntDisMeasMaxCurSite  =  0u;
+    CPU_IntDisMeasMaxSite     =  0u;
+#endif
     CPU_INT_EN();
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_SITE_NBR
+    CPU_IntDisMeasSiteTblReset();
+#endif
 }
 #endif
 
@@ -2409,3 +2658,71 @@ static  CPU_TS_TMR  CPU_IntDisMeasMaxCalc (CPU_TS_TMR  time_tot_cnts)
 }
 #endif
 
+
+/*
+*********************************************************************************************************
+*                                     CPU_IntDisMeasSiteUpdate()
+*
+* Description : Update the worst interrupts disabled time sites table.
+*
+* Argument(s) : site        Site that disabled interrupts.
+*
+*               time_cnts   Interrupts disabled time of the site (in CPU timestamp timer counts).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : CPU_IntDisMeasStop().
+*
+* Note(s)     : (1) MUST be called with interrupts disabled.
+*
+*               (2) The table is kept sorted by decreasing maximum time & holds each site at most once :
+*
+*                   (a) A site already in the table moves up if its maximum time increased.
+*
+*                   (b) A new site takes the first free entry or, if the table is full, evicts the last
+*                       (least offending) entry.
+*
+*               (3) Once the table is full, the smallest maximum time in the table becomes the threshold a
+*                   time MUST exceed for CPU_IntDisMeasStop() to call this function.
+*********************************************************************************************************
+*/
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_SITE_NBR
+static  void  CPU_IntDisMeasSiteUpdate (CPU_ADDR    site,
+                                        CPU_TS_TMR  time_cnts)
+{
+    CPU_INT_DIS_MEAS_SITE  *p_tbl;
+    CPU_SIZE_T              ix;
+
+
+    p_tbl = &CPU_IntDisMeasSiteTbl[0];
+    ix    =  0u;
+    while ((ix            <  CPU_CFG_INT_DIS_MEAS_SITE_NBR) &&  /* Srch site's entry or first free entry.              */
+           (p_tbl[ix].Addr != site)                         &&
+           (p_tbl[ix].Addr != 0u)) {
+        ix++;
+    }
+
+    if (ix >= CPU_CFG_INT_DIS_MEAS_SITE_NBR) {                  /* Tbl full, evict last entry (see Note #2b).           */
+        ix = CPU_CFG_INT_DIS_MEAS_SITE_NBR - 1u;
+    } else if ((p_tbl[ix].Addr     == site) &&
+               (p_tbl[ix].Max_cnts >= time_cnts)) {             /* No new max for this site.                            */
+        return;
+    } else {
+        ;
+    }
+
+    while ((ix > 0u) &&                                         /* Shift less offending sites down (see Note #2a).      */
+           (p_tbl[ix - 1u].Max_cnts < time_cnts)) {
+        p_tbl[ix] = p_tbl[ix - 1u];
+        ix--;
+    }
+    p_tbl[ix].Addr     = site;
+    p_tbl[ix].Max_cnts = time_cnts;
+
+    if (p_tbl[CPU_CFG_INT_DIS_MEAS_SITE_NBR - 1u].Addr != 0u) { /* Upd threshold once tbl is full (see Note #3).       */
+        CPU_IntDisMeasSiteTh_cnts = p_tbl[CPU_CFG_INT_DIS_MEAS_SITE_NBR - 1u].Max_cnts;
+    }
+}
+#endif
+
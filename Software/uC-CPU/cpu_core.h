@@ -245,6 +245,21 @@ typedef  CPU_INT32U  CPU_TS_TMR;
 typedef  CPU_INT32U  CPU_TS_TMR_FREQ;
 
 
+/*
+*********************************************************************************************************
+*                         CPU INTERRUPTS DISABLED TIME MEASUREMENT SITE DATA TYPE
+*********************************************************************************************************
+*/
+
+#if (defined(CPU_CFG_INT_DIS_MEAS_EN) && \
+     defined(CPU_CFG_INT_DIS_MEAS_SITE_NBR))
+typedef  struct  cpu_int_dis_meas_site {
+    CPU_ADDR    Addr;                                           /* Site's addr, as ret'd by CPU_RetAddrGet().           */
+    CPU_TS_TMR  Max_cnts;                                       /* Site's max ints dis'd time (in ts tmr cnts).         */
+} CPU_INT_DIS_MEAS_SITE;
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          GLOBAL VARIABLES
@@ -282,6 +297,15 @@ CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasStop_cnts;         /* ...  stop  ti
 CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasOvrhd_cnts;        /* ...        time meas ovrhd.                          */
 CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasMaxCur_cnts;       /* ...     resetable max time dis'd.                    */
 CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasMax_cnts;          /* ... non-resetable max time dis'd.                    */
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_SITE_NBR                           /* Ints dis'd site (see 'cpu_cfg.h' Note #1c) : ...     */
+CPU_CORE_EXT  CPU_ADDR         CPU_IntDisMeasSiteCur;           /* ...     cur                 site.                    */
+CPU_CORE_EXT  CPU_ADDR         CPU_IntDisMeasMaxCurSite;        /* ...     resetable max time  site.                    */
+CPU_CORE_EXT  CPU_ADDR         CPU_IntDisMeasMaxSite;           /* ... non-resetable max time  site.                    */
+CPU_CORE_EXT  CPU_TS_TMR       CPU_IntDisMeasSiteTh_cnts;       /* ... min time to enter worst sites tbl.               */
+                                                                /* ... worst sites tbl, sorted by decreasing max time.  */
+CPU_CORE_EXT  CPU_INT_DIS_MEAS_SITE  CPU_IntDisMeasSiteTbl[CPU_CFG_INT_DIS_MEAS_SITE_NBR];
+#endif
 #endif
 
 
@@ -575,9 +599,24 @@ CPU_TS_TMR       CPU_IntDisMeasMaxCurGet  (void);
 
 CPU_TS_TMR       CPU_IntDisMeasMaxGet     (void);
 
+#ifdef  CPU_CFG_INT_DIS_MEAS_SITE_NBR
+CPU_ADDR         CPU_IntDisMeasMaxCurSiteGet(void);
+
+CPU_ADDR         CPU_IntDisMeasMaxSiteGet (void);
+
+CPU_SIZE_T       CPU_IntDisMeasSiteTblGet (CPU_INT_DIS_MEAS_SITE  *p_tbl,
+                                           CPU_SIZE_T              nbr_max);
+
+void             CPU_IntDisMeasSiteTblReset(void);
+#endif
+
 
 void             CPU_IntDisMeasStart      (void);
 
+#ifdef  CPU_CFG_INT_DIS_MEAS_SITE_NBR
+void             CPU_IntDisMeasStartSite  (CPU_ADDR          site);
+#endif
+
 void             CPU_IntDisMeasStop       (void);
 #endif
 
@@ -1001,6 +1040,15 @@ CPU_INT64U  CPU_TS64_to_uSec(CPU_TS64  ts_cnts);
 
 #endif
 
+
+#ifdef  CPU_CFG_INT_DIS_MEAS_SITE_NBR
+#if     (DEF_CHK_VAL(CPU_CFG_INT_DIS_MEAS_SITE_NBR, 1u, 255u) != DEF_OK)
+#error  "CPU_CFG_INT_DIS_MEAS_SITE_NBR   illegally #define'd in 'cpu_cfg.h' "
+#error  "                                [MUST be  >=   1]"
+#error  "                                [     ||  <= 255]"
+#endif
+#endif
+
 #endif
 
 
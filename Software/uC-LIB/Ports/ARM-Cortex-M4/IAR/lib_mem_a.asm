@@ -0,0 +1,346 @@
+;********************************************************************************************************
+;                                                uC/LIB
+;                                        CUSTOM LIBRARY MODULES
+;
+;                         (c) Copyright 2004-2015; Micrium, Inc.; Weston, FL
+;
+;                  All rights reserved.  Protected by international copyright laws.
+;
+;                  uC/LIB is provided in source form to registered licensees ONLY.  It is
+;                  illegal to distribute this source code to any third party unless you receive
+;                  written permission by an authorized Micrium representative.  Knowledge of
+;                  the source code may NOT be used to develop a similar product.
+;
+;                  Please help us continue to provide the Embedded community with the finest
+;                  software available.  Your honesty is greatly appreciated.
+;
+;                  You can find our product's user manual, API reference, release notes and
+;                  more information at: doc.micrium.com
+;
+;                  You can contact us at: www.micrium.com
+;********************************************************************************************************
+
+;********************************************************************************************************
+;
+;                                     STANDARD MEMORY OPERATIONS
+;
+;                                           ARM-Cortex-M4
+;                                           IAR C Compiler
+;
+; Filename      : lib_mem_a.asm
+; Version       : V1.38.02
+;********************************************************************************************************
+; Note(s)       : (1) Assembly-optimized versions of Mem_Clr(), Mem_Set(), Mem_Copy() & Mem_Cmp(), used
+;                     instead of the C versions in 'lib_mem.c' when LIB_MEM_CFG_OPTIMIZE_ASM_EN is
+;                     DEF_ENABLED in 'lib_cfg.h'.
+;
+;                 (2) The functions rely on the Cortex-M4 support of unaligned LDR/STR (see 'ARMv7-M
+;                     Architecture Reference Manual, Section A3.2'), which MUST NOT be disabled by setting
+;                     CCR.UNALIGN_TRP.  LDM/STM are only used on word-aligned addresses.
+;
+;                 (3) Unlike the C versions, the functions do NOT check for NULL pointers when
+;                     LIB_MEM_CFG_ARG_CHK_EXT_EN is enabled, except Mem_Cmp() which always does.
+;********************************************************************************************************
+
+
+;********************************************************************************************************
+;                                           PUBLIC FUNCTIONS
+;********************************************************************************************************
+
+        PUBLIC  Mem_Clr
+        PUBLIC  Mem_Set
+        PUBLIC  Mem_Copy
+        PUBLIC  Mem_Cmp
+
+
+;********************************************************************************************************
+;                                      CODE GENERATION DIRECTIVES
+;********************************************************************************************************
+
+        RSEG CODE:CODE:NOROOT(2)
+        THUMB
+
+
+;********************************************************************************************************
+;                                               Mem_Clr()
+;                                              CLEAR MEMORY
+;
+; Description : Clears data buffer.
+;
+; Prototypes  : void  Mem_Clr(void  *pmem, CPU_SIZE_T  size);
+;
+; Argument(s) : pmem        Pointer to memory buffer to clear.
+;
+;               size        Number of data buffer octets to clear.
+;
+; Return(s)   : none.
+;
+; Caller(s)   : Application.
+;
+; Note(s)     : (1) Tail-calls Mem_Set() with a 0 fill octet.
+;********************************************************************************************************
+
+Mem_Clr:
+        MOV     R2, R1                          ; Size is the 3rd arg of Mem_Set() ...
+        MOVS    R1, #0                          ; ... & the fill octet 0.
+        B       Mem_Set
+
+
+;********************************************************************************************************
+;                                               Mem_Set()
+;                                              FILL MEMORY
+;
+; Description : Fills data buffer with specified data octet.
+;
+; Prototypes  : void  Mem_Set(void  *pmem, CPU_INT08U  data_val, CPU_SIZE_T  size);
+;
+; Argument(s) : pmem        Pointer to memory buffer to fill with specified data octet.
+;
+;               data_val    Data fill octet value.
+;
+;               size        Number of data buffer octets to fill.
+;
+; Return(s)   : none.
+;
+; Caller(s)   : Application.
+;
+; Note(s)     : (1) Fills 16-octet STM blocks once 'pmem' is word-aligned.
+;********************************************************************************************************
+
+Mem_Set:
+        AND     R1, R1, #0xFF                   ; Replicate data octet in all 4 octets of R1.
+        ORR     R1, R1, R1, LSL #8
+        ORR     R1, R1, R1, LSL #16
+        CMP     R2, #16                         ; Short fill: octets only.
+        BLO     Mem_Set_Octets
+
+Mem_Set_Align:
+        TST     R0, #3                          ; Fill leading octets until 'pmem' is word-aligned.
+        BEQ     Mem_Set_Aligned
+        STRB    R1, [R0], #1
+        SUB     R2, R2, #1
+        B       Mem_Set_Align
+
+Mem_Set_Aligned:
+        PUSH    {R4}
+        MOV     R3,  R1
+        MOV     R4,  R1
+        MOV     R12, R1
+        SUBS    R2, R2, #16
+        BLO     Mem_Set_BlksEnd
+
+Mem_Set_Blk:
+        STM     R0!, {R1, R3, R4, R12}          ; Fill 16 octets.
+        SUBS    R2, R2, #16
+        BHS     Mem_Set_Blk
+
+Mem_Set_BlksEnd:
+        POP     {R4}
+        ADD     R2, R2, #16
+        SUBS    R2, R2, #4                      ; Fill remaining words.
+        BLO     Mem_Set_WordsEnd
+
+Mem_Set_Word:
+        STR     R1, [R0], #4
+        SUBS    R2, R2, #4
+        BHS     Mem_Set_Word
+
+Mem_Set_WordsEnd:
+        ADD     R2, R2, #4
+
+Mem_Set_Octets:
+        CBZ     R2, Mem_Set_End                 ; Fill trailing octets.
+
+Mem_Set_Octet:
+        STRB    R1, [R0], #1
+        SUBS    R2, R2, #1
+        BNE     Mem_Set_Octet
+
+Mem_Set_End:
+        BX      LR
+
+
+;********************************************************************************************************
+;                                               Mem_Copy()
+;                                              COPY MEMORY
+;
+; Description : Copies data octets from one memory buffer to another memory buffer.
+;
+; Prototypes  : void  Mem_Copy(void  *pdest, const  void  *psrc, CPU_SIZE_T  size);
+;
+; Argument(s) : pdest       Pointer to destination memory buffer.
+;
+;               psrc        Pointer to source      memory buffer.
+;
+;               size        Number of octets to copy.
+;
+; Return(s)   : none.
+;
+; Caller(s)   : Application.
+;
+; Note(s)     : (1) Once 'pdest' is word-aligned, copies 32-octet LDM/STM blocks if 'psrc' is also
+;                   word-aligned, 16-octet blocks of unaligned LDRs otherwise (see Note #2 above).
+;
+;               (2) Copies in ascending address order, so overlapping buffers are copied correctly when
+;                   'psrc' is at a higher address than 'pdest' (see 'lib_mem.c  Mem_Copy()  Note #2b').
+;********************************************************************************************************
+
+Mem_Copy:
+        CMP     R2, #16                         ; Short copy: octets only.
+        BLO     Mem_Copy_Octets
+        PUSH    {R4-R9}
+
+Mem_Copy_Align:
+        TST     R0, #3                          ; Copy leading octets until 'pdest' is word-aligned.
+        BEQ     Mem_Copy_Aligned
+        LDRB    R3, [R1], #1
+        STRB    R3, [R0], #1
+        SUB     R2, R2, #1
+        B       Mem_Copy_Align
+
+Mem_Copy_Aligned:
+        TST     R1, #3                          ; 'psrc' also word-aligned?
+        BNE     Mem_Copy_Unaligned
+        SUBS    R2, R2, #32
+        BLO     Mem_Copy_BlksEnd
+
+Mem_Copy_Blk:
+        LDM     R1!, {R3-R9, R12}               ; Copy 32 octets.
+        STM     R0!, {R3-R9, R12}
+        SUBS    R2, R2, #32
+        BHS     Mem_Copy_Blk
+
+Mem_Copy_BlksEnd:
+        ADD     R2, R2, #32
+        B       Mem_Copy_Words
+
+Mem_Copy_Unaligned:
+        SUBS    R2, R2, #16
+        BLO     Mem_Copy_UnalignedEnd
+
+Mem_Copy_UnalignedBlk:
+        LDR     R3, [R1], #4                    ; Copy 16 octets, unaligned loads ...
+        LDR     R4, [R1], #4
+        LDR     R5, [R1], #4
+        LDR     R6, [R1], #4
+        STM     R0!, {R3-R6}                    ; ... aligned store.
+        SUBS    R2, R2, #16
+        BHS     Mem_Copy_UnalignedBlk
+
+Mem_Copy_UnalignedEnd:
+        ADD     R2, R2, #16
+
+Mem_Copy_Words:
+        POP     {R4-R9}
+        SUBS    R2, R2, #4                      ; Copy remaining words.
+        BLO     Mem_Copy_WordsEnd
+
+Mem_Copy_Word:
+        LDR     R3, [R1], #4
+        STR     R3, [R0], #4
+        SUBS    R2, R2, #4
+        BHS     Mem_Copy_Word
+
+Mem_Copy_WordsEnd:
+        ADD     R2, R2, #4
+
+Mem_Copy_Octets:
+        CBZ     R2, Mem_Copy_End                ; Copy trailing octets.
+
+Mem_Copy_Octet:
+        LDRB    R3, [R1], #1
+        STRB    R3, [R0], #1
+        SUBS    R2, R2, #1
+        BNE     Mem_Copy_Octet
+
+Mem_Copy_End:
+        BX      LR
+
+
+;********************************************************************************************************
+;                                               Mem_Cmp()
+;                                             COMPARE MEMORY
+;
+; Description : Verifies that ALL data octets in two memory buffers are identical in sequence.
+;
+; Prototypes  : CPU_BOOLEAN  Mem_Cmp(const  void  *p1_mem, const  void  *p2_mem, CPU_SIZE_T  size);
+;
+; Argument(s) : p1_mem      Pointer to first  memory buffer.
+;
+;               p2_mem      Pointer to second memory buffer.
+;
+;               size        Number of data buffer octets to compare.
+;
+; Return(s)   : DEF_YES, if 'size' number of data octets are identical in both memory buffers.
+;
+;               DEF_NO,  otherwise.
+;
+; Caller(s)   : Application.
+;
+; Note(s)     : (1) Null compares allowed, DEF_YES returned (see 'lib_mem.c  Mem_Cmp()  Note #1').
+;
+;               (2) Compares from the end of the buffers, like the C version (see 'lib_mem.c  Mem_Cmp()
+;                   Note #2'), by words once 'p1_mem' is word-aligned.
+;********************************************************************************************************
+
+Mem_Cmp:
+        CBZ     R2, Mem_Cmp_Yes                 ; Null compare: identical.
+        CMP     R0, #0                          ; NULL ptrs: not identical.
+        BEQ     Mem_Cmp_No
+        CMP     R1, #0
+        BEQ     Mem_Cmp_No
+        ADD     R0, R0, R2                      ; Start at the end of the bufs.
+        ADD     R1, R1, R2
+        CMP     R2, #8                          ; Short compare: octets only.
+        BLO     Mem_Cmp_Octets
+
+Mem_Cmp_Align:
+        TST     R0, #3                          ; Compare trailing octets until 'p1_mem' is word-aligned.
+        BEQ     Mem_Cmp_Aligned
+        LDRB    R3,  [R0, #-1]!
+        LDRB    R12, [R1, #-1]!
+        CMP     R3, R12
+        BNE     Mem_Cmp_No
+        SUB     R2, R2, #1
+        B       Mem_Cmp_Align
+
+Mem_Cmp_Aligned:
+        SUBS    R2, R2, #4
+        BLO     Mem_Cmp_WordsEnd
+
+Mem_Cmp_Word:
+        LDR     R3,  [R0, #-4]!                 ; Compare words, 'p2_mem' may be unaligned.
+        LDR     R12, [R1, #-4]!
+        CMP     R3, R12
+        BNE     Mem_Cmp_No
+        SUBS    R2, R2, #4
+        BHS     Mem_Cmp_Word
+
+Mem_Cmp_WordsEnd:
+        ADDS    R2, R2, #4
+
+Mem_Cmp_Octets:
+        CBZ     R2, Mem_Cmp_Yes                 ; Compare leading octets.
+
+Mem_Cmp_Octet:
+        LDRB    R3,  [R0, #-1]!
+        LDRB    R12, [R1, #-1]!
+        CMP     R3, R12
+        BNE     Mem_Cmp_No
+        SUBS    R2, R2, #1
+        BNE     Mem_Cmp_Octet
+
+Mem_Cmp_Yes:
+        MOVS    R0, #1                          ; DEF_YES.
+        BX      LR
+
+Mem_Cmp_No:
+        MOVS    R0, #0                          ; DEF_NO.
+        BX      LR
+
+
+;********************************************************************************************************
+;                                     LIB MEM ASSEMBLY PORT FILE END
+;********************************************************************************************************
+
+        END
@@ -113,6 +113,34 @@
 */
 
 
+/*
+*********************************************************************************************************
+*                                     ASCII CHARACTER CLASS TABLE
+*
+* Note(s) : (1) Classes of each 7-bit character, see 'lib_ascii.h  ASCII CHARACTER CLASS DEFINES'.
+*********************************************************************************************************
+*/
+
+const  CPU_INT16U  ASCII_ClassTbl[ASCII_CLASS_TBL_SIZE] = {
+    0x0080u, 0x0080u, 0x0080u, 0x0080u, 0x0080u, 0x0080u, 0x0080u, 0x0080u,         /* 0x00 - 0x07  NUL .. BEL          */
+    0x0080u, 0x0098u, 0x0088u, 0x0088u, 0x0088u, 0x0088u, 0x0080u, 0x0080u,         /* 0x08 - 0x0F  BS .. SI            */
+    0x0080u, 0x0080u, 0x0080u, 0x0080u, 0x0080u, 0x0080u, 0x0080u, 0x0080u,         /* 0x10 - 0x17  DLE .. ETB          */
+    0x0080u, 0x0080u, 0x0080u, 0x0080u, 0x0080u, 0x0080u, 0x0080u, 0x0080u,         /* 0x18 - 0x1F  CAN .. US           */
+    0x0118u, 0x0340u, 0x0340u, 0x0340u, 0x0340u, 0x0340u, 0x0340u, 0x0340u,         /* 0x20 - 0x27  ' ' .. '\''         */
+    0x0340u, 0x0340u, 0x0340u, 0x0340u, 0x0340u, 0x0340u, 0x0340u, 0x0340u,         /* 0x28 - 0x2F  '(' .. '/'          */
+    0x0307u, 0x0307u, 0x0307u, 0x0307u, 0x0307u, 0x0307u, 0x0307u, 0x0307u,         /* 0x30 - 0x37  '0' .. '7'          */
+    0x0305u, 0x0305u, 0x0340u, 0x0340u, 0x0340u, 0x0340u, 0x0340u, 0x0340u,         /* 0x38 - 0x3F  '8' .. '?'          */
+    0x0340u, 0x0324u, 0x0324u, 0x0324u, 0x0324u, 0x0324u, 0x0324u, 0x0320u,         /* 0x40 - 0x47  '@' .. 'G'          */
+    0x0320u, 0x0320u, 0x0320u, 0x0320u, 0x0320u, 0x0320u, 0x0320u, 0x0320u,         /* 0x48 - 0x4F  'H' .. 'O'          */
+    0x0320u, 0x0320u, 0x0320u, 0x0320u, 0x0320u, 0x0320u, 0x0320u, 0x0320u,         /* 0x50 - 0x57  'P' .. 'W'          */
+    0x0320u, 0x0320u, 0x0320u, 0x0340u, 0x0340u, 0x0340u, 0x0340u, 0x0340u,         /* 0x58 - 0x5F  'X' .. '_'          */
+    0x0340u, 0x2304u, 0x2304u, 0x2304u, 0x2304u, 0x2304u, 0x2304u, 0x2300u,         /* 0x60 - 0x67  '`' .. 'g'          */
+    0x2300u, 0x2300u, 0x2300u, 0x2300u, 0x2300u, 0x2300u, 0x2300u, 0x2300u,         /* 0x68 - 0x6F  'h' .. 'o'          */
+    0x2300u, 0x2300u, 0x2300u, 0x2300u, 0x2300u, 0x2300u, 0x2300u, 0x2300u,         /* 0x70 - 0x77  'p' .. 'w'          */
+    0x2300u, 0x2300u, 0x2300u, 0x0340u, 0x0340u, 0x0340u, 0x0340u, 0x0080u          /* 0x78 - 0x7F  'x' .. DEL          */
+};
+
+
 /*
 *********************************************************************************************************
 *                                       LOCAL GLOBAL VARIABLES
@@ -646,8 +674,8 @@ CPU_BOOLEAN  ASCII_Cmp (CPU_CHAR  c1,
     CPU_BOOLEAN  cmp;
 
 
-    c1_upper =  ASCII_ToUpper(c1);
-    c2_upper =  ASCII_ToUpper(c2);
+    c1_upper =  ASCII_TO_UPPER(c1);
+    c2_upper =  ASCII_TO_UPPER(c2);
     cmp      = (c1_upper == c2_upper) ? (DEF_YES) : (DEF_NO);
 
     return (cmp);
@@ -372,6 +372,36 @@
 #define  ASCII_CHAR_DEL                                 ASCII_CHAR_DELETE
 
 
+/*
+*********************************************************************************************************
+*                                    ASCII CHARACTER CLASS DEFINES
+*
+* Note(s) : (1) Each ASCII_ClassTbl[] entry is the set of classes of a 7-bit character.
+*
+*           (2) ASCII_CLASS_UPPER & (ASCII_CLASS_LOWER >> 8) are the offset between the uppercase & the
+*               lowercase letters so that ASCII_TO_LOWER() & ASCII_TO_UPPER() need not test the class.
+*********************************************************************************************************
+*/
+
+#define  ASCII_CLASS_TBL_SIZE                            128u   /* 7-bit chars.                                         */
+
+#define  ASCII_CLASS_NONE                             0x0000u
+#define  ASCII_CLASS_DIG                              0x0001u   /* isdigit()                                            */
+#define  ASCII_CLASS_DIG_OCT                          0x0002u
+#define  ASCII_CLASS_DIG_HEX                          0x0004u   /* isxdigit()                                           */
+#define  ASCII_CLASS_SPACE                            0x0008u   /* isspace()                                            */
+#define  ASCII_CLASS_BLANK                            0x0010u   /* isblank()                                            */
+#define  ASCII_CLASS_UPPER                            0x0020u   /* isupper()                  (see Note #2).            */
+#define  ASCII_CLASS_PUNCT                            0x0040u   /* ispunct()                                            */
+#define  ASCII_CLASS_CTRL                             0x0080u   /* iscntrl()                                            */
+#define  ASCII_CLASS_PRINT                            0x0100u   /* isprint()                                            */
+#define  ASCII_CLASS_GRAPH                            0x0200u   /* isgraph()                                            */
+#define  ASCII_CLASS_LOWER                            0x2000u   /* islower()                  (see Note #2).            */
+
+#define  ASCII_CLASS_ALPHA                     (ASCII_CLASS_UPPER | ASCII_CLASS_LOWER)
+#define  ASCII_CLASS_ALPHA_NUM                 (ASCII_CLASS_ALPHA | ASCII_CLASS_DIG  )
+
+
 /*
 *********************************************************************************************************
 *                                             DATA TYPES
@@ -385,6 +415,8 @@
 *********************************************************************************************************
 */
 
+extern  const  CPU_INT16U  ASCII_ClassTbl[ASCII_CLASS_TBL_SIZE];   /* Classes of each 7-bit char.                      */
+
 
 /*
 *********************************************************************************************************
@@ -399,9 +431,21 @@
 * Note(s) : (1) ISO/IEC 9899:TC2, Section 7.4.1.(1) states that "character classification functions ...
 *               return nonzero (true) if and only if the value of the argument 'c' conforms to ... the
 *               description of the function."
+*
+*           (2) (a) Each classification is a single ASCII_ClassTbl[] look-up & mask.
+*
+*               (b) Characters outside the 7-bit character set belong to NO class.
+*
+*               (c) The macros MAY evaluate 'c' more than once & 'c' MUST be a character (i.e. NOT a
+*                   value wider than CPU_CHAR).
 *********************************************************************************************************
 */
 
+#define  ASCII_CLASS_GET(c)            ((((CPU_INT08U)(c)) < ASCII_CLASS_TBL_SIZE) ? ASCII_ClassTbl[(CPU_INT08U)(c)] \
+                                                                            : ASCII_CLASS_NONE)
+
+#define  ASCII_CLASS_IS(c, class)      (((ASCII_CLASS_GET(c) & (class)) != 0u) ? (DEF_YES) : (DEF_NO))
+
 /*
 *********************************************************************************************************
 *                                           ASCII_IS_DIG()
@@ -421,7 +465,7 @@
 *********************************************************************************************************
 */
 
-#define  ASCII_IS_DIG(c)               ((((c) >= ASCII_CHAR_DIG_ZERO) && ((c) <= ASCII_CHAR_DIG_NINE)) ? (DEF_YES) : (DEF_NO))
+#define  ASCII_IS_DIG(c)               ASCII_CLASS_IS((c), ASCII_CLASS_DIG)
 
 
 /*
@@ -442,7 +486,7 @@
 *********************************************************************************************************
 */
 
-#define  ASCII_IS_DIG_OCT(c)          ((((c) >= ASCII_CHAR_DIG_ZERO) && ((c) <= ASCII_CHAR_DIG_SEVEN)) ? (DEF_YES) : (DEF_NO))
+#define  ASCII_IS_DIG_OCT(c)           ASCII_CLASS_IS((c), ASCII_CLASS_DIG_OCT)
 
 
 /*
@@ -464,9 +508,7 @@
 *********************************************************************************************************
 */
 
-#define  ASCII_IS_DIG_HEX(c)          (((((c) >= ASCII_CHAR_DIG_ZERO     ) && ((c) <= ASCII_CHAR_DIG_NINE     )) || \
-                                        (((c) >= ASCII_CHAR_LATIN_UPPER_A) && ((c) <= ASCII_CHAR_LATIN_UPPER_F)) || \
-                                        (((c) >= ASCII_CHAR_LATIN_LOWER_A) && ((c) <= ASCII_CHAR_LATIN_LOWER_F))) ? (DEF_YES) : (DEF_NO))
+#define  ASCII_IS_DIG_HEX(c)           ASCII_CLASS_IS((c), ASCII_CLASS_DIG_HEX)
 
 
 /*
@@ -488,7 +530,7 @@
 *********************************************************************************************************
 */
 
-#define  ASCII_IS_LOWER(c)             ((((c) >= ASCII_CHAR_LATIN_LOWER_A) && ((c) <= ASCII_CHAR_LATIN_LOWER_Z)) ? (DEF_YES) : (DEF_NO))
+#define  ASCII_IS_LOWER(c)             ASCII_CLASS_IS((c), ASCII_CLASS_LOWER)
 
 
 /*
@@ -510,7 +552,7 @@
 *********************************************************************************************************
 */
 
-#define  ASCII_IS_UPPER(c)             ((((c) >= ASCII_CHAR_LATIN_UPPER_A) && ((c) <= ASCII_CHAR_LATIN_UPPER_Z)) ? (DEF_YES) : (DEF_NO))
+#define  ASCII_IS_UPPER(c)             ASCII_CLASS_IS((c), ASCII_CLASS_UPPER)
 
 
 /*
@@ -532,8 +574,7 @@
 *********************************************************************************************************
 */
 
-#define  ASCII_IS_ALPHA(c)             ((((ASCII_IS_UPPER(c)) == DEF_YES) || \
-                                         ((ASCII_IS_LOWER(c)) == DEF_YES)) ? (DEF_YES) : (DEF_NO))
+#define  ASCII_IS_ALPHA(c)             ASCII_CLASS_IS((c), ASCII_CLASS_ALPHA)
 
 
 /*
@@ -555,8 +596,7 @@
 *********************************************************************************************************
 */
 
-#define  ASCII_IS_ALPHA_NUM(c)         ((((ASCII_IS_ALPHA(c)) == DEF_YES) || \
-                                         ((ASCII_IS_DIG  (c)) == DEF_YES)) ? (DEF_YES) : (DEF_NO))
+#define  ASCII_IS_ALPHA_NUM(c)         ASCII_CLASS_IS((c), ASCII_CLASS_ALPHA_NUM)
 
 
 /*
@@ -581,7 +621,7 @@
 *********************************************************************************************************
 */
 
-#define  ASCII_IS_BLANK(c)             ((((c) == ASCII_CHAR_SPACE) || ((c) == ASCII_CHAR_HT)) ? (DEF_YES) : (DEF_NO))
+#define  ASCII_IS_BLANK(c)             ASCII_CLASS_IS((c), ASCII_CLASS_BLANK)
 
 
 /*
@@ -607,9 +647,7 @@
 *********************************************************************************************************
 */
 
-#define  ASCII_IS_SPACE(c)             ((((c) == ASCII_CHAR_SPACE) || ((c) == ASCII_CHAR_CR) || \
-                                         ((c) == ASCII_CHAR_LF   ) || ((c) == ASCII_CHAR_FF) || \
-                                         ((c) == ASCII_CHAR_HT   ) || ((c) == ASCII_CHAR_VT)) ? (DEF_YES) : (DEF_NO))
+#define  ASCII_IS_SPACE(c)             ASCII_CLASS_IS((c), ASCII_CLASS_SPACE)
 
 
 /*
@@ -635,7 +673,7 @@
 *********************************************************************************************************
 */
 
-#define  ASCII_IS_PRINT(c)             ((((c) >= ASCII_CHAR_SPACE) && ((c) <= ASCII_CHAR_TILDE)) ? (DEF_YES) : (DEF_NO))
+#define  ASCII_IS_PRINT(c)             ASCII_CLASS_IS((c), ASCII_CLASS_PRINT)
 
 
 /*
@@ -661,7 +699,7 @@
 *********************************************************************************************************
 */
 
-#define  ASCII_IS_GRAPH(c)             ((((c) >= ASCII_CHAR_EXCLAMATION_MARK) && ((c) <= ASCII_CHAR_TILDE)) ? (DEF_YES) : (DEF_NO))
+#define  ASCII_IS_GRAPH(c)             ASCII_CLASS_IS((c), ASCII_CLASS_GRAPH)
 
 
 /*
@@ -683,10 +721,7 @@
 *********************************************************************************************************
 */
 
-#define  ASCII_IS_PUNCT(c)              ((((c > ASCII_CHAR_SPACE)         && (c < ASCII_CHAR_DIGIT_ZERO))    || \
-                                          ((c > ASCII_CHAR_DIGIT_NINE)    && (c < ASCII_CHAR_LATIN_UPPER_A)) || \
-                                          ((c > ASCII_CHAR_LATIN_UPPER_Z) && (c < ASCII_CHAR_LATIN_LOWER_A)) || \
-                                          ((c > ASCII_CHAR_LATIN_LOWER_Z) && (c < ASCII_CHAR_DELETE))) ? (DEF_YES) : (DEF_NO))
+#define  ASCII_IS_PUNCT(c)             ASCII_CLASS_IS((c), ASCII_CLASS_PUNCT)
 
 
 /*
@@ -712,8 +747,7 @@
 *********************************************************************************************************
 */
 
-#define  ASCII_IS_CTRL(c)             (((((CPU_INT08S)(c) >= ASCII_CHAR_NULL  ) && ((c) <= ASCII_CHAR_IS1)) || \
-                                                                                   ((c) == ASCII_CHAR_DEL))  ? (DEF_YES) : (DEF_NO))
+#define  ASCII_IS_CTRL(c)              ASCII_CLASS_IS((c), ASCII_CLASS_CTRL)
 
 
 /*
@@ -749,7 +783,7 @@
 *********************************************************************************************************
 */
 
-#define  ASCII_TO_LOWER(c)              (((ASCII_IS_UPPER(c)) == DEF_YES) ? ((c) + (ASCII_CHAR_LATIN_LOWER_A - ASCII_CHAR_LATIN_UPPER_A)) : (c))
+#define  ASCII_TO_LOWER(c)             ((CPU_CHAR)((c) +  (ASCII_CLASS_GET(c) & ASCII_CLASS_UPPER)))
 
 
 /*
@@ -779,7 +813,7 @@
 *********************************************************************************************************
 */
 
-#define  ASCII_TO_UPPER(c)              (((ASCII_IS_LOWER(c)) == DEF_YES) ? ((c) - (ASCII_CHAR_LATIN_LOWER_A - ASCII_CHAR_LATIN_UPPER_A)) : (c))
+#define  ASCII_TO_UPPER(c)             ((CPU_CHAR)((c) - ((ASCII_CLASS_GET(c) & ASCII_CLASS_LOWER) >> 8u)))
 
 
 /*
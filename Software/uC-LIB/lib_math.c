@@ -75,9 +75,72 @@
 /*
 *********************************************************************************************************
 *                                            LOCAL DEFINES
+*
+* Note(s) : (1) Math_SinQ15() linearly interpolates between the MATH_SIN_TBL_SIZE + 1 entries of the
+*               quarter-wave Math_SinTbl[] (see 'Math_SinQ15()  Note #1').
+*
+*           (2) The CORDIC functions iterate in Q2.30 so that the intermediate vector, whose length
+*               grows up to 1 / MATH_CORDIC_GAIN_INV, never overflows a CPU_INT32S.
+*
+*               See also 'Math_SinCosQ31()  Note #2' & 'Math_Atan2()  Note #2'.
 *********************************************************************************************************
 */
 
+#define  MATH_SIN_TBL_BITS                                 8u   /* Interpolation intervals per quarter wave (log2).     */
+#define  MATH_SIN_TBL_SIZE                   DEF_BIT(MATH_SIN_TBL_BITS)
+#define  MATH_SIN_FRAC_BITS                  (14u - MATH_SIN_TBL_BITS)
+#define  MATH_SIN_FRAC_MSK                   (DEF_BIT(MATH_SIN_FRAC_BITS) - 1u)
+#define  MATH_SIN_FRAC_RND                   (1 << (MATH_SIN_FRAC_BITS - 1u))
+
+#define  MATH_CORDIC_ITER_MAX                             30u   /* Nbr of iterations for Q31 & MATH_ANGLE32 results.    */
+#define  MATH_CORDIC_ITER_16                              16u   /* Nbr of iterations for       MATH_ANGLE16 results.    */
+#define  MATH_CORDIC_GAIN_INV                      652032874    /* Inverse CORDIC gain, 0.607252935 in Q2.30.           */
+#define  MATH_CORDIC_NORM_BIT                             28u   /* Msb of normalized atan2 vector (see Note #2).        */
+
+#define  MATH_ROTL_32(nbr, bits)             (((nbr) << (bits)) | ((nbr) >> (32u - (bits))))
+
+#define  MATH_RAND_WEYL_INC                       0x9E3779B9u   /* 2^32 / golden ratio.                                 */
+#define  MATH_RAND_HASH_MULT_1                    0x7FEB352Du   /* Math_RandHash() multipliers.                         */
+#define  MATH_RAND_HASH_MULT_2                    0x846CA68Bu
+#define  MATH_RAND_XORO_MULT                      0x9E3779BBu   /* xoroshiro64** output multiplier.                     */
+#define  MATH_RAND_PCG_MULT               0x5851F42D4C957F2DuLL /* PCG32 LCG multiplier.                                */
+
+#define  MATH_RAND_IS_ALIGNED(p)             (((((CPU_ADDR)(p)) & (sizeof(CPU_INT32U) - 1u)) == 0u) ? DEF_YES : DEF_NO)
+
+
+#if (LIB_MATH_CFG_FP_EN == DEF_ENABLED)
+#define  MATH_FP_PI                              3.14159265f
+#define  MATH_FP_PI_2                            1.57079633f
+#define  MATH_FP_PI_4                            0.78539816f
+#define  MATH_FP_2_PI                            0.63661977f    /* 2 / pi.                                              */
+#define  MATH_FP_PI_2_HI                         1.5703125f     /* pi / 2 split in an exact hi part ...                 */
+#define  MATH_FP_PI_2_LO                         4.8382679e-4f  /* ... & a lo part (Cody-Waite reduction).              */
+#define  MATH_FP_TAN_PI_8                        0.41421356f
+
+                                                                /* Taylor coefs of sin() & cos() on [-pi/4, pi/4].      */
+#define  MATH_FP_SIN_C3                         -1.6666667e-1f
+#define  MATH_FP_SIN_C5                          8.3333333e-3f
+#define  MATH_FP_SIN_C7                         -1.9841270e-4f
+#define  MATH_FP_SIN_C9                          2.7557319e-6f
+
+#define  MATH_FP_COS_C2                         -5.0000000e-1f
+#define  MATH_FP_COS_C4                          4.1666667e-2f
+#define  MATH_FP_COS_C6                         -1.3888889e-3f
+#define  MATH_FP_COS_C8                          2.4801587e-5f
+#define  MATH_FP_COS_C10                        -2.7557319e-7f
+
+                                                                /* Taylor coefs of atan() on [-tan(pi/8), tan(pi/8)].   */
+#define  MATH_FP_ATAN_C3                        -3.3333333e-1f
+#define  MATH_FP_ATAN_C5                         2.0000000e-1f
+#define  MATH_FP_ATAN_C7                        -1.4285714e-1f
+#define  MATH_FP_ATAN_C9                         1.1111111e-1f
+#define  MATH_FP_ATAN_C11                       -9.0909091e-2f
+#define  MATH_FP_ATAN_C13                        7.6923077e-2f
+
+#define  MATH_FP_RSQRT_MAGIC                     0x5F375A86u    /* Initial 1 / sqrt() estimate from the FP32 bits.      */
+#define  MATH_FP_RSQRT_ITER                               3u
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -92,6 +155,13 @@
 *********************************************************************************************************
 */
 
+#if (LIB_MATH_CFG_FP_EN == DEF_ENABLED)
+typedef  union  math_fp32_bits {                                /* Bits of a FP32 nbr (see 'Math_Sqrt_32()  Note #1').  */
+    CPU_FP32    Val;
+    CPU_INT32U  Bits;
+} MATH_FP32_BITS;
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -99,6 +169,70 @@
 *********************************************************************************************************
 */
 
+/*
+*********************************************************************************************************
+*                                             SINE TABLE
+*
+* Note(s) : (1) Math_SinTbl[i] = sin((pi / 2) * (i / MATH_SIN_TBL_SIZE)) in Q1.15, for i = 0 .. 256.
+*
+*           (2) sin(pi / 2) is stored as 32768 (i.e. 1.0) so that the last interval interpolates correctly;
+*               Math_SinQ15() saturates it to MATH_Q15_MAX.
+*********************************************************************************************************
+*/
+
+static  const  CPU_INT16U  Math_SinTbl[MATH_SIN_TBL_SIZE + 1u] = {
+        0u,   201u,   402u,   603u,   804u,  1005u,  1206u,  1407u,
+     1608u,  1809u,  2009u,  2210u,  2411u,  2611u,  2811u,  3012u,
+     3212u,  3412u,  3612u,  3812u,  4011u,  4211u,  4410u,  4609u,
+     4808u,  5007u,  5205u,  5404u,  5602u,  5800u,  5998u,  6195u,
+     6393u,  6590u,  6787u,  6983u,  7180u,  7376u,  7571u,  7767u,
+     7962u,  8157u,  8351u,  8546u,  8740u,  8933u,  9127u,  9319u,
+     9512u,  9704u,  9896u, 10088u, 10279u, 10469u, 10660u, 10850u,
+    11039u, 11228u, 11417u, 11605u, 11793u, 11980u, 12167u, 12354u,
+    12540u, 12725u, 12910u, 13095u, 13279u, 13463u, 13646u, 13828u,
+    14010u, 14192u, 14373u, 14553u, 14733u, 14912u, 15091u, 15269u,
+    15447u, 15624u, 15800u, 15976u, 16151u, 16326u, 16500u, 16673u,
+    16846u, 17018u, 17190u, 17361u, 17531u, 17700u, 17869u, 18037u,
+    18205u, 18372u, 18538u, 18703u, 18868u, 19032u, 19195u, 19358u,
+    19520u, 19681u, 19841u, 20001u, 20160u, 20318u, 20475u, 20632u,
+    20788u, 20943u, 21097u, 21251u, 21403u, 21555u, 21706u, 21856u,
+    22006u, 22154u, 22302u, 22449u, 22595u, 22740u, 22884u, 23028u,
+    23170u, 23312u, 23453u, 23593u, 23732u, 23870u, 24008u, 24144u,
+    24279u, 24414u, 24548u, 24680u, 24812u, 24943u, 25073u, 25202u,
+    25330u, 25457u, 25583u, 25708u, 25833u, 25956u, 26078u, 26199u,
+    26320u, 26439u, 26557u, 26674u, 26791u, 26906u, 27020u, 27133u,
+    27246u, 27357u, 27467u, 27576u, 27684u, 27791u, 27897u, 28002u,
+    28106u, 28209u, 28311u, 28411u, 28511u, 28610u, 28707u, 28803u,
+    28899u, 28993u, 29086u, 29178u, 29269u, 29359u, 29448u, 29535u,
+    29622u, 29707u, 29792u, 29875u, 29957u, 30038u, 30118u, 30196u,
+    30274u, 30350u, 30425u, 30499u, 30572u, 30644u, 30715u, 30784u,
+    30853u, 30920u, 30986u, 31050u, 31114u, 31177u, 31238u, 31298u,
+    31357u, 31415u, 31471u, 31527u, 31581u, 31634u, 31686u, 31737u,
+    31786u, 31834u, 31881u, 31927u, 31972u, 32015u, 32058u, 32099u,
+    32138u, 32177u, 32214u, 32251u, 32286u, 32319u, 32352u, 32383u,
+    32413u, 32442u, 32470u, 32496u, 32522u, 32546u, 32568u, 32590u,
+    32610u, 32629u, 32647u, 32664u, 32679u, 32693u, 32706u, 32718u,
+    32729u, 32738u, 32746u, 32753u, 32758u, 32762u, 32766u, 32767u,
+    32768u
+};
+
+
+/*
+*********************************************************************************************************
+*                                         CORDIC ANGLE TABLE
+*
+* Note(s) : (1) Math_CORDIC_AtanTbl[i] = atan(2^-i) as a MATH_ANGLE32 (i.e. in units of 2 pi / 2^32).
+*********************************************************************************************************
+*/
+
+static  const  MATH_ANGLE32  Math_CORDIC_AtanTbl[MATH_CORDIC_ITER_MAX] = {
+     536870912u,  316933406u,  167458907u,   85004756u,   42667331u,   21354465u,
+      10679838u,    5340245u,    2670163u,    1335087u,     667544u,     333772u,
+        166886u,      83443u,      41722u,      20861u,      10430u,       5215u,
+          2608u,       1304u,        652u,        326u,        163u,         81u,
+            41u,         20u,         10u,          5u,          3u,          1u
+};
+
 
 /*
 *********************************************************************************************************
@@ -115,6 +249,21 @@ RAND_NBR  Math_RandSeedCur;                                     /* Cur rand nbr
 *********************************************************************************************************
 */
 
+static  CPU_INT32U    Math_RandHash (CPU_INT32U  nbr);
+
+static  MATH_Q15      Math_SatQ15   (CPU_INT32S  nbr);
+
+static  MATH_Q31      Math_SatQ31   (CPU_INT64S  nbr);
+
+static  MATH_ANGLE32  Math_Atan2    (CPU_INT32S  y,
+                                     CPU_INT32S  x,
+                                     CPU_INT32U  nbr_iter);
+
+#if (LIB_MATH_CFG_FP_EN == DEF_ENABLED)
+static  CPU_FP32      Math_SinCos_32(CPU_FP32    rad,
+                                     CPU_INT32U  quad_off);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -209,6 +358,9 @@ void  Math_RandSetSeed (RAND_NBR  seed)
 *                       always be accessed & updated exclusively in critical sections.
 *
 *                   See also 'Math_RandSeed()  Note #2'.
+*
+*               (3) Math_RandXoro() & Math_RandPCG() are faster, statistically better & need NO critical
+*                   section (see 'lib_math.h  RANDOM NUMBER GENERATOR DATA TYPES  Note #2').
 *********************************************************************************************************
 */
 
@@ -279,3 +431,1599 @@ RAND_NBR  Math_RandSeed (RAND_NBR  seed)
     return (rand_nbr);
 }
 
+
+/*
+*********************************************************************************************************
+*                                         Math_RandXoroInit()
+*
+* Description : Initialize a xoroshiro64** pseudo-random number generator.
+*
+* Argument(s) : p_rand      Pointer to the generator state to initialize.
+*
+*               seed        Seed of the pseudo-random number sequence.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) (a) The two state words are derived from 'seed' with a Weyl sequence & an integer hash
+*                       so that close seeds give unrelated sequences.
+*
+*                   (b) The hash is a bijection; the two state words are therefore different & can NOT
+*                       both be zero (the only state the generator can NOT leave).
+*
+*               (2) Every task (or every other user) SHOULD own its generator state; the generator
+*                   functions do NOT protect the state from concurrent accesses.
+*
+*                   See also 'lib_math.h  RANDOM NUMBER GENERATOR DATA TYPES  Note #2'.
+*********************************************************************************************************
+*/
+
+void  Math_RandXoroInit (MATH_RAND_XORO  *p_rand,
+                         RAND_NBR         seed)
+{
+                                                                /* See Note #1.                                         */
+    p_rand->State[0] = Math_RandHash((CPU_INT32U)seed +       MATH_RAND_WEYL_INC);
+    p_rand->State[1] = Math_RandHash((CPU_INT32U)seed + (2u * MATH_RAND_WEYL_INC));
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Math_RandXoro()
+*
+* Description : Calculate the next pseudo-random number of a xoroshiro64** generator.
+*
+* Argument(s) : p_rand      Pointer to the generator state (see Math_RandXoroInit()).
+*
+* Return(s)   : Next pseudo-random number, in [0, DEF_INT_32U_MAX_VAL].
+*
+* Caller(s)   : Math_RandXoroFill(),
+*               Math_RandXoroBounded(),
+*               Application.
+*
+* Note(s)     : (1) xoroshiro64** (D. Blackman & S. Vigna) has a period of 2^64 - 1, passes the BigCrush
+*                   test suite & uses ONLY 32-bit shifts, rotations, XORs & multiplications.
+*
+*               (2) Re-entrant for different generator states; NO critical section is required.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  Math_RandXoro (MATH_RAND_XORO  *p_rand)
+{
+    CPU_INT32U  s0;
+    CPU_INT32U  s1;
+    CPU_INT32U  rand_nbr;
+
+
+    s0       = p_rand->State[0];
+    s1       = p_rand->State[1];
+    rand_nbr = MATH_ROTL_32(s0 * MATH_RAND_XORO_MULT, 5u) * 5u;
+
+    s1               ^= s0;
+    p_rand->State[0]  = MATH_ROTL_32(s0, 26u) ^ s1 ^ (s1 << 9u);
+    p_rand->State[1]  = MATH_ROTL_32(s1, 13u);
+
+    return (rand_nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         Math_RandXoroFill()
+*
+* Description : Fill a buffer with pseudo-random octets from a xoroshiro64** generator.
+*
+* Argument(s) : p_rand      Pointer to the generator state (see Math_RandXoroInit()).
+*
+*               p_buf       Pointer to the buffer to fill.
+*
+*               size        Number of octets to fill.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The aligned part of the buffer is filled one 32-bit word per pseudo-random number;
+*                   each octet of the unaligned head & the tail uses one pseudo-random number.
+*********************************************************************************************************
+*/
+
+void  Math_RandXoroFill (MATH_RAND_XORO  *p_rand,
+                         void            *p_buf,
+                         CPU_SIZE_T       size)
+{
+    CPU_INT08U  *p_buf_08;
+    CPU_INT32U  *p_buf_32;
+
+
+    p_buf_08 = (CPU_INT08U *)p_buf;                             /* Fill unaligned head ...                              */
+    while ((size > 0u) && (MATH_RAND_IS_ALIGNED(p_buf_08) == DEF_NO)) {
+       *p_buf_08 = (CPU_INT08U)Math_RandXoro(p_rand);
+        p_buf_08++;
+        size--;
+    }
+
+    p_buf_32 = (CPU_INT32U *)p_buf_08;                          /* ... aligned words (see Note #1) ...                  */
+    while (size >= sizeof(CPU_INT32U)) {
+       *p_buf_32 = Math_RandXoro(p_rand);
+        p_buf_32++;
+        size    -= sizeof(CPU_INT32U);
+    }
+
+    p_buf_08 = (CPU_INT08U *)p_buf_32;                          /* ... & tail.                                          */
+    while (size > 0u) {
+       *p_buf_08 = (CPU_INT08U)Math_RandXoro(p_rand);
+        p_buf_08++;
+        size--;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                       Math_RandXoroBounded()
+*
+* Description : Calculate the next pseudo-random number of a xoroshiro64** generator, in a bounded range.
+*
+* Argument(s) : p_rand      Pointer to the generator state (see Math_RandXoroInit()).
+*
+*               bound       Number of values in the range.
+*
+* Return(s)   : Uniformly distributed pseudo-random number, in [0, bound - 1], if 'bound' NOT zero.
+*
+*               0,                                                            otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) (a) The high word of (rand_nbr * bound) is in [0, bound - 1], without a division
+*                       (D. Lemire, "Fast Random Integer Generation in an Interval").
+*
+*                   (b) Unlike (rand_nbr % bound), which favors the lowest values, the products whose low
+*                       word is below (2^32 % bound) are rejected so that every value is equally likely.
+*                       The division that calculates (2^32 % bound) is only required when the low word is
+*                       below 'bound', i.e. with a probability of (bound / 2^32).
+*
+*               (2) A range [min, max] is (min + Math_RandXoroBounded(p_rand, max - min + 1)).
+*********************************************************************************************************
+*/
+
+CPU_INT32U  Math_RandXoroBounded (MATH_RAND_XORO  *p_rand,
+                                  CPU_INT32U       bound)
+{
+    CPU_INT64U  prod;
+    CPU_INT32U  thresh;
+
+
+    prod = (CPU_INT64U)Math_RandXoro(p_rand) * (CPU_INT64U)bound;
+    if ((CPU_INT32U)prod < bound) {                             /* Reject the biased products (see Note #1b).           */
+        thresh = (0u - bound) % bound;
+        while ((CPU_INT32U)prod < thresh) {
+            prod = (CPU_INT64U)Math_RandXoro(p_rand) * (CPU_INT64U)bound;
+        }
+    }
+
+    return ((CPU_INT32U)(prod >> 32u));
+}
+
+
+/*
+*********************************************************************************************************
+*                                          Math_RandPCG_Init()
+*
+* Description : Initialize a PCG32 pseudo-random number generator.
+*
+* Argument(s) : p_rand      Pointer to the generator state to initialize.
+*
+*               seed        Seed of the pseudo-random number sequence.
+*
+*               stream      Sequence selector; generators with different streams give different
+*                               sequences, even with the same seed.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Seeded as the reference implementation (M. O'Neill, 'pcg32_srandom_r()'); so the
+*                   sequences MAY be checked against it.
+*
+*               (2) See 'Math_RandXoroInit()  Note #2'.
+*********************************************************************************************************
+*/
+
+void  Math_RandPCG_Init (MATH_RAND_PCG  *p_rand,
+                         CPU_INT64U      seed,
+                         CPU_INT64U      stream)
+{
+    p_rand->State = 0u;                                         /* See Note #1.                                         */
+    p_rand->Inc   = (stream << 1u) | 1u;                        /* Inc MUST be odd.                                     */
+    (void)Math_RandPCG(p_rand);
+    p_rand->State += seed;
+    (void)Math_RandPCG(p_rand);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Math_RandPCG()
+*
+* Description : Calculate the next pseudo-random number of a PCG32 generator.
+*
+* Argument(s) : p_rand      Pointer to the generator state (see Math_RandPCG_Init()).
+*
+* Return(s)   : Next pseudo-random number, in [0, DEF_INT_32U_MAX_VAL].
+*
+* Caller(s)   : Math_RandPCG_Init(),
+*               Math_RandPCG_Fill(),
+*               Math_RandPCG_Bounded(),
+*               Application.
+*
+* Note(s)     : (1) PCG32 (PCG-XSH-RR, M. O'Neill) advances a 64-bit LCG & outputs a permutation of its
+*                   upper bits : a xorshift followed by a rotation selected by its 5 most significant bits.
+*                   It has a period of 2^64 per stream & passes the BigCrush test suite.
+*
+*               (2) Slower than Math_RandXoro() on 32-bit CPUs (64-bit multiplication), but supports 2^63
+*                   independent streams.
+*
+*               (3) See 'Math_RandXoro()  Note #2'.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  Math_RandPCG (MATH_RAND_PCG  *p_rand)
+{
+    CPU_INT64U  state;
+    CPU_INT32U  xor_shifted;
+    CPU_INT32U  rot;
+    CPU_INT32U  rand_nbr;
+
+
+    state         = p_rand->State;
+    p_rand->State = (state * MATH_RAND_PCG_MULT) + p_rand->Inc;
+
+    xor_shifted = (CPU_INT32U)(((state >> 18u) ^ state) >> 27u);
+    rot         = (CPU_INT32U) (state >> 59u);
+    rand_nbr    = (xor_shifted >> rot) | (xor_shifted << ((0u - rot) & 31u));
+
+    return (rand_nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         Math_RandPCG_Fill()
+*
+* Description : Fill a buffer with pseudo-random octets from a PCG32 generator.
+*
+* Argument(s) : p_rand      Pointer to the generator state (see Math_RandPCG_Init()).
+*
+*               p_buf       Pointer to the buffer to fill.
+*
+*               size        Number of octets to fill.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) See 'Math_RandXoroFill()  Note #1'.
+*********************************************************************************************************
+*/
+
+void  Math_RandPCG_Fill (MATH_RAND_PCG  *p_rand,
+                         void           *p_buf,
+                         CPU_SIZE_T      size)
+{
+    CPU_INT08U  *p_buf_08;
+    CPU_INT32U  *p_buf_32;
+
+
+    p_buf_08 = (CPU_INT08U *)p_buf;                             /* Fill unaligned head ...                              */
+    while ((size > 0u) && (MATH_RAND_IS_ALIGNED(p_buf_08) == DEF_NO)) {
+       *p_buf_08 = (CPU_INT08U)Math_RandPCG(p_rand);
+        p_buf_08++;
+        size--;
+    }
+
+    p_buf_32 = (CPU_INT32U *)p_buf_08;                          /* ... aligned words ...                                */
+    while (size >= sizeof(CPU_INT32U)) {
+       *p_buf_32 = Math_RandPCG(p_rand);
+        p_buf_32++;
+        size    -= sizeof(CPU_INT32U);
+    }
+
+    p_buf_08 = (CPU_INT08U *)p_buf_32;                          /* ... & tail.                                          */
+    while (size > 0u) {
+       *p_buf_08 = (CPU_INT08U)Math_RandPCG(p_rand);
+        p_buf_08++;
+        size--;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                       Math_RandPCG_Bounded()
+*
+* Description : Calculate the next pseudo-random number of a PCG32 generator, in a bounded range.
+*
+* Argument(s) : p_rand      Pointer to the generator state (see Math_RandPCG_Init()).
+*
+*               bound       Number of values in the range.
+*
+* Return(s)   : Uniformly distributed pseudo-random number, in [0, bound - 1], if 'bound' NOT zero.
+*
+*               0,                                                            otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) See 'Math_RandXoroBounded()  Note #1'.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  Math_RandPCG_Bounded (MATH_RAND_PCG  *p_rand,
+                                  CPU_INT32U      bound)
+{
+    CPU_INT64U  prod;
+    CPU_INT32U  thresh;
+
+
+    prod = (CPU_INT64U)Math_RandPCG(p_rand) * (CPU_INT64U)bound;
+    if ((CPU_INT32U)prod < bound) {                             /* Reject the biased products (see Note #1b).           */
+        thresh = (0u - bound) % bound;
+        while ((CPU_INT32U)prod < thresh) {
+            prod = (CPU_INT64U)Math_RandPCG(p_rand) * (CPU_INT64U)bound;
+        }
+    }
+
+    return ((CPU_INT32U)(prod >> 32u));
+}
+
+
+/*
+*********************************************************************************************************
+*                                          Math_AddSatQ15()
+*
+* Description : Add two Q1.15 fractions, saturating the result.
+*
+* Argument(s) : a           First  Q1.15 fraction.
+*
+*               b           Second Q1.15 fraction.
+*
+* Return(s)   : (a + b), saturated to [MATH_Q15_MIN, MATH_Q15_MAX].
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+MATH_Q15  Math_AddSatQ15 (MATH_Q15  a,
+                          MATH_Q15  b)
+{
+    MATH_Q15  sum;
+
+
+    sum = Math_SatQ15((CPU_INT32S)a + (CPU_INT32S)b);
+
+    return (sum);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          Math_AddSatQ31()
+*
+* Description : Add two Q1.31 fractions, saturating the result.
+*
+* Argument(s) : a           First  Q1.31 fraction.
+*
+*               b           Second Q1.31 fraction.
+*
+* Return(s)   : (a + b), saturated to [MATH_Q31_MIN, MATH_Q31_MAX].
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+MATH_Q31  Math_AddSatQ31 (MATH_Q31  a,
+                          MATH_Q31  b)
+{
+    MATH_Q31  sum;
+
+
+    sum = Math_SatQ31((CPU_INT64S)a + (CPU_INT64S)b);
+
+    return (sum);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          Math_SubSatQ15()
+*
+* Description : Subtract two Q1.15 fractions, saturating the result.
+*
+* Argument(s) : a           Q1.15 fraction to subtract from.
+*
+*               b           Q1.15 fraction to subtract.
+*
+* Return(s)   : (a - b), saturated to [MATH_Q15_MIN, MATH_Q15_MAX].
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+MATH_Q15  Math_SubSatQ15 (MATH_Q15  a,
+                          MATH_Q15  b)
+{
+    MATH_Q15  diff;
+
+
+    diff = Math_SatQ15((CPU_INT32S)a - (CPU_INT32S)b);
+
+    return (diff);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          Math_SubSatQ31()
+*
+* Description : Subtract two Q1.31 fractions, saturating the result.
+*
+* Argument(s) : a           Q1.31 fraction to subtract from.
+*
+*               b           Q1.31 fraction to subtract.
+*
+* Return(s)   : (a - b), saturated to [MATH_Q31_MIN, MATH_Q31_MAX].
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+MATH_Q31  Math_SubSatQ31 (MATH_Q31  a,
+                          MATH_Q31  b)
+{
+    MATH_Q31  diff;
+
+
+    diff = Math_SatQ31((CPU_INT64S)a - (CPU_INT64S)b);
+
+    return (diff);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            Math_MulQ15()
+*
+* Description : Multiply two Q1.15 fractions.
+*
+* Argument(s) : a           First  Q1.15 fraction.
+*
+*               b           Second Q1.15 fraction.
+*
+* Return(s)   : (a * b), rounded to nearest & saturated to [MATH_Q15_MIN, MATH_Q15_MAX].
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Only (-1 * -1) saturates.
+*********************************************************************************************************
+*/
+
+MATH_Q15  Math_MulQ15 (MATH_Q15  a,
+                       MATH_Q15  b)
+{
+    CPU_INT32S  prod;
+    MATH_Q15    res;
+
+
+    prod = ((CPU_INT32S)a * (CPU_INT32S)b) + (1 << (MATH_Q15_FRAC_BITS - 1u));
+    res  =   Math_SatQ15(prod >> MATH_Q15_FRAC_BITS);
+
+    return (res);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            Math_MulQ31()
+*
+* Description : Multiply two Q1.31 fractions.
+*
+* Argument(s) : a           First  Q1.31 fraction.
+*
+*               b           Second Q1.31 fraction.
+*
+* Return(s)   : (a * b), rounded to nearest & saturated to [MATH_Q31_MIN, MATH_Q31_MAX].
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Only (-1 * -1) saturates.
+*********************************************************************************************************
+*/
+
+MATH_Q31  Math_MulQ31 (MATH_Q31  a,
+                       MATH_Q31  b)
+{
+    CPU_INT64S  prod;
+    MATH_Q31    res;
+
+
+    prod = ((CPU_INT64S)a * (CPU_INT64S)b) + ((CPU_INT64S)1 << (MATH_Q31_FRAC_BITS - 1u));
+    res  =   Math_SatQ31(prod >> MATH_Q31_FRAC_BITS);
+
+    return (res);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            Math_MacQ15()
+*
+* Description : Multiply two Q1.15 fractions & accumulate the product in a Q1.31 fraction.
+*
+* Argument(s) : acc         Q1.31 accumulator.
+*
+*               a           First  Q1.15 fraction.
+*
+*               b           Second Q1.15 fraction.
+*
+* Return(s)   : (acc + (a * b)), saturated to [MATH_Q31_MIN, MATH_Q31_MAX].
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The Q2.30 product of two Q1.15 fractions is converted to Q1.31 in a 64-bit integer &
+*                   added to the accumulator there, so it is exact, even for -1 * -1 (+1.0, one LSB
+*                   more than MATH_Q31_MAX).  ONLY the sum is saturated; so NO precision is lost until
+*                   the accumulator is converted back to Q1.15 (see 'lib_math.h  MATH_Q31_TO_Q15()').
+*********************************************************************************************************
+*/
+
+MATH_Q31  Math_MacQ15 (MATH_Q31  acc,
+                       MATH_Q15  a,
+                       MATH_Q15  b)
+{
+    CPU_INT64S  prod;
+    MATH_Q31    res;
+
+
+    prod = (CPU_INT64S)((CPU_INT32S)a * (CPU_INT32S)b) * 2;     /* Q2.30 to Q1.31 (see Note #1).                        */
+    res  =  Math_SatQ31((CPU_INT64S)acc + prod);
+
+    return (res);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            Math_MacQ31()
+*
+* Description : Multiply two Q1.31 fractions & accumulate the product in a Q1.31 fraction.
+*
+* Argument(s) : acc         Q1.31 accumulator.
+*
+*               a           First  Q1.31 fraction.
+*
+*               b           Second Q1.31 fraction.
+*
+* Return(s)   : (acc + (a * b)), with the product rounded to nearest & the sum saturated to
+*                   [MATH_Q31_MIN, MATH_Q31_MAX].
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+MATH_Q31  Math_MacQ31 (MATH_Q31  acc,
+                       MATH_Q31  a,
+                       MATH_Q31  b)
+{
+    CPU_INT64S  prod;
+    MATH_Q31    res;
+
+
+    prod = ((CPU_INT64S)a * (CPU_INT64S)b) + ((CPU_INT64S)1 << (MATH_Q31_FRAC_BITS - 1u));
+    res  =   Math_SatQ31((CPU_INT64S)acc + (prod >> MATH_Q31_FRAC_BITS));
+
+    return (res);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         Math_Recip_Int32U()
+*
+* Description : Calculate the reciprocal of an integer, scaled by 2^32.
+*
+* Argument(s) : nbr         Integer to calculate the reciprocal of.
+*
+* Return(s)   : floor(2^32 / nbr), saturated to DEF_INT_32U_MAX_VAL, if 'nbr' NOT zero.
+*
+*               0,                                                    otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The reciprocal replaces repeated divisions by the same divisor (e.g. the distance
+*                   between the wheels, or a calibration span) by multiplications; see
+*                   Math_DivRecip_Int32U().
+*
+*               (2) floor(2^32 / nbr) = floor((2^32 - 1) / nbr), plus one if 'nbr' divides 2^32 exactly;
+*                   so that ONLY a single 32-bit division is required.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  Math_Recip_Int32U (CPU_INT32U  nbr)
+{
+    CPU_INT32U  recip;
+
+
+    if (nbr < 2u) {                                             /* 1 / 0 & 2^32 / 1 do NOT fit : saturate.              */
+        recip = (nbr == 0u) ? 0u : DEF_INT_32U_MAX_VAL;
+        return (recip);
+    }
+
+    recip = DEF_INT_32U_MAX_VAL / nbr;                          /* See Note #2.                                         */
+    if ((DEF_INT_32U_MAX_VAL - (recip * nbr)) == (nbr - 1u)) {
+        recip++;
+    }
+
+    return (recip);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Math_DivRecip_Int32U()
+*
+* Description : Divide an integer using the reciprocal of the divisor.
+*
+* Argument(s) : nbr         Integer to divide.
+*
+*               div         Divisor; MUST NOT be zero.
+*
+*               recip       Reciprocal of 'div', as returned by Math_Recip_Int32U(div).
+*
+* Return(s)   : floor(nbr / div).
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The high word of (nbr * recip) is floor(nbr / div) OR one less; a single multiply &
+*                   compare corrects it.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  Math_DivRecip_Int32U (CPU_INT32U  nbr,
+                                  CPU_INT32U  div,
+                                  CPU_INT32U  recip)
+{
+    CPU_INT32U  quot;
+
+
+    quot = (CPU_INT32U)(((CPU_INT64U)nbr * (CPU_INT64U)recip) >> 32u);
+    if ((nbr - (quot * div)) >= div) {                          /* See Note #1.                                         */
+        quot++;
+    }
+
+    return (quot);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         Math_Sqrt_Int32U()
+*
+* Description : Calculate the integer square root of a 32-bit integer.
+*
+* Argument(s) : nbr         Integer to calculate the square root of.
+*
+* Return(s)   : floor(sqrt(nbr)).
+*
+* Caller(s)   : Math_SqrtQ15(),
+*               Application.
+*
+* Note(s)     : (1) Calculated one result bit per iteration (digit-by-digit method), starting from the
+*                   most significant bit set in 'nbr'.
+*********************************************************************************************************
+*/
+
+CPU_INT16U  Math_Sqrt_Int32U (CPU_INT32U  nbr)
+{
+    CPU_INT32U  rem;
+    CPU_INT32U  root;
+    CPU_INT32U  bit;
+
+
+    if (nbr == 0u) {
+        return (0u);
+    }
+
+    rem  = nbr;
+    root = 0u;
+    bit  = DEF_BIT((31u - CPU_CntLeadZeros32(nbr)) & ~1u);      /* Highest power of 4 <= nbr.                           */
+    while (bit != 0u) {
+        if (rem >= (root + bit)) {
+            rem  -=  root + bit;
+            root  = (root >> 1u) + bit;
+        } else {
+            root >>= 1u;
+        }
+        bit >>= 2u;
+    }
+
+    return ((CPU_INT16U)root);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         Math_Sqrt_Int64U()
+*
+* Description : Calculate the integer square root of a 64-bit integer.
+*
+* Argument(s) : nbr         Integer to calculate the square root of.
+*
+* Return(s)   : floor(sqrt(nbr)).
+*
+* Caller(s)   : Math_SqrtQ31(),
+*               Math_Hypot_Int32S(),
+*               Application.
+*
+* Note(s)     : (1) See 'Math_Sqrt_Int32U()  Note #1'.
+*
+*               (2) Integers less than 2^32 are handed to Math_Sqrt_Int32U(), which is faster.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  Math_Sqrt_Int64U (CPU_INT64U  nbr)
+{
+    CPU_INT64U  rem;
+    CPU_INT64U  root;
+    CPU_INT64U  bit;
+    CPU_INT32U  nbr_hi;
+
+
+    nbr_hi = (CPU_INT32U)(nbr >> 32u);
+    if (nbr_hi == 0u) {                                         /* See Note #2.                                         */
+        return ((CPU_INT32U)Math_Sqrt_Int32U((CPU_INT32U)nbr));
+    }
+
+    rem  = nbr;
+    root = 0u;
+    bit  = (CPU_INT64U)1u << ((63u - CPU_CntLeadZeros32(nbr_hi)) & ~1u);
+    while (bit != 0u) {
+        if (rem >= (root + bit)) {
+            rem  -=  root + bit;
+            root  = (root >> 1u) + bit;
+        } else {
+            root >>= 1u;
+        }
+        bit >>= 2u;
+    }
+
+    return ((CPU_INT32U)root);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Math_SqrtQ15()
+*
+* Description : Calculate the square root of a Q1.15 fraction.
+*
+* Argument(s) : nbr         Q1.15 fraction to calculate the square root of.
+*
+* Return(s)   : sqrt(nbr), truncated, if 'nbr' is positive.
+*
+*               0,                    otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) sqrt(nbr / 2^15) * 2^15 = sqrt(nbr * 2^15).
+*********************************************************************************************************
+*/
+
+MATH_Q15  Math_SqrtQ15 (MATH_Q15  nbr)
+{
+    MATH_Q15  root;
+
+
+    if (nbr <= 0) {
+        return (0);
+    }
+
+                                                                /* See Note #1.                                         */
+    root = (MATH_Q15)Math_Sqrt_Int32U((CPU_INT32U)nbr << MATH_Q15_FRAC_BITS);
+
+    return (root);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Math_SqrtQ31()
+*
+* Description : Calculate the square root of a Q1.31 fraction.
+*
+* Argument(s) : nbr         Q1.31 fraction to calculate the square root of.
+*
+* Return(s)   : sqrt(nbr), truncated, if 'nbr' is positive.
+*
+*               0,                    otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) sqrt(nbr / 2^31) * 2^31 = sqrt(nbr * 2^31).
+*********************************************************************************************************
+*/
+
+MATH_Q31  Math_SqrtQ31 (MATH_Q31  nbr)
+{
+    MATH_Q31  root;
+
+
+    if (nbr <= 0) {
+        return (0);
+    }
+
+                                                                /* See Note #1.                                         */
+    root = (MATH_Q31)Math_Sqrt_Int64U((CPU_INT64U)nbr << MATH_Q31_FRAC_BITS);
+
+    return (root);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         Math_Hypot_Int32S()
+*
+* Description : Calculate the length of a vector.
+*
+* Argument(s) : x           X component of the vector.
+*
+*               y           Y component of the vector.
+*
+* Return(s)   : floor(sqrt(x^2 + y^2)).
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The sum of the squares is calculated exactly in 64 bits; the result does NOT overflow
+*                   for ANY 'x' & 'y'.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  Math_Hypot_Int32S (CPU_INT32S  x,
+                               CPU_INT32S  y)
+{
+    CPU_INT32U  x_abs;
+    CPU_INT32U  y_abs;
+    CPU_INT32U  len;
+
+
+    x_abs = (x < 0) ? (0u - (CPU_INT32U)x) : (CPU_INT32U)x;
+    y_abs = (y < 0) ? (0u - (CPU_INT32U)y) : (CPU_INT32U)y;
+    len   =  Math_Sqrt_Int64U(((CPU_INT64U)x_abs * (CPU_INT64U)x_abs) +
+                              ((CPU_INT64U)y_abs * (CPU_INT64U)y_abs));
+
+    return (len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            Math_SinQ15()
+*
+* Description : Calculate the sine of a binary angle.
+*
+* Argument(s) : angle       Angle, in units of 2 pi / 2^16 (see 'lib_math.h  FIXED-POINT MATH DEFINES
+*                               Note #2').
+*
+* Return(s)   : sin(angle), in Q1.15.
+*
+* Caller(s)   : Math_CosQ15(),
+*               Application.
+*
+* Note(s)     : (1) (a) The two most significant bits of 'angle' select the quarter wave; the next
+*                       MATH_SIN_TBL_BITS select the Math_SinTbl[] interval, which is linearly interpolated
+*                       by the remaining MATH_SIN_FRAC_BITS.
+*
+*                   (b) The 2nd & 4th quarter waves read the table backwards; the 3rd & 4th are negated.
+*
+*               (2) The error is less than 1.001 LSB (3.1e-5).
+*********************************************************************************************************
+*/
+
+MATH_Q15  Math_SinQ15 (MATH_ANGLE16  angle)
+{
+    CPU_INT32U  ix;
+    CPU_INT32S  frac;
+    CPU_INT32S  val;
+    CPU_INT32S  val_next;
+
+
+    ix   = ((CPU_INT32U)angle & (MATH_ANGLE16_PI_2 - 1u)) >> MATH_SIN_FRAC_BITS;
+    frac =  (CPU_INT32S)((CPU_INT32U)angle & MATH_SIN_FRAC_MSK);
+
+    if ((angle & MATH_ANGLE16_PI_2) == 0u) {                    /* Rising  quarter wave (see Note #1b).                 */
+        val      = (CPU_INT32S)Math_SinTbl[ix];
+        val_next = (CPU_INT32S)Math_SinTbl[ix + 1u];
+    } else {                                                    /* Falling quarter wave.                                */
+        val      = (CPU_INT32S)Math_SinTbl[MATH_SIN_TBL_SIZE - ix];
+        val_next = (CPU_INT32S)Math_SinTbl[MATH_SIN_TBL_SIZE - ix - 1u];
+    }
+    val += (((val_next - val) * frac) + MATH_SIN_FRAC_RND) >> MATH_SIN_FRAC_BITS;
+
+    if (val > MATH_Q15_MAX) {                                   /* Sat sin(pi / 2).                                     */
+        val = MATH_Q15_MAX;
+    }
+    if ((angle & MATH_ANGLE16_PI) != 0u) {                      /* Negative half wave.                                  */
+        val = -val;
+    }
+
+    return ((MATH_Q15)val);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            Math_CosQ15()
+*
+* Description : Calculate the cosine of a binary angle.
+*
+* Argument(s) : angle       Angle, in units of 2 pi / 2^16 (see 'lib_math.h  FIXED-POINT MATH DEFINES
+*                               Note #2').
+*
+* Return(s)   : cos(angle), in Q1.15.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) cos(angle) = sin(angle + pi / 2).
+*********************************************************************************************************
+*/
+
+MATH_Q15  Math_CosQ15 (MATH_ANGLE16  angle)
+{
+    MATH_Q15  val;
+
+
+    val = Math_SinQ15((MATH_ANGLE16)(angle + MATH_ANGLE16_PI_2));
+
+    return (val);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          Math_SinCosQ31()
+*
+* Description : Calculate both the sine & the cosine of a binary angle.
+*
+* Argument(s) : angle       Angle, in units of 2 pi / 2^32 (see 'lib_math.h  FIXED-POINT MATH DEFINES
+*                               Note #2').
+*
+*               p_sin       Pointer to a variable that will receive the sine   of 'angle', in Q1.31
+*                               (optional, may be NULL).
+*
+*               p_cos       Pointer to a variable that will receive the cosine of 'angle', in Q1.31
+*                               (optional, may be NULL).
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Math_SinQ31(),
+*               Math_CosQ31(),
+*               Application.
+*
+* Note(s)     : (1) Calculated with MATH_CORDIC_ITER_MAX iterations of CORDIC in rotation mode, using
+*                   ONLY shifts, additions & Math_CORDIC_AtanTbl[].  Both results cost the same as one.
+*
+*               (2) (a) CORDIC converges for angles within about +/- 99 degrees; angles in [pi/2, 3pi/2)
+*                       are rotated by pi & the results negated.
+*
+*                   (b) The vector starts at MATH_CORDIC_GAIN_INV so that it ends with unit length.
+*
+*               (3) The error is at most 1.91e-8 (41.1 LSB), dominated by the truncation of the shifts; the
+*                   bound was measured over all 2^32 angles & is reached near 0x82349E05.
+*********************************************************************************************************
+*/
+
+void  Math_SinCosQ31 (MATH_ANGLE32   angle,
+                      MATH_Q31      *p_sin,
+                      MATH_Q31      *p_cos)
+{
+    CPU_INT32S   x;
+    CPU_INT32S   y;
+    CPU_INT32S   x_prev;
+    CPU_INT32S   z;
+    CPU_INT32U   i;
+    CPU_BOOLEAN  neg;
+
+
+    neg = DEF_NO;
+                                                                /* Rotate by pi (see Note #2a).                         */
+    if (((angle + MATH_ANGLE32_PI_2) & MATH_ANGLE32_PI) != 0u) {
+        angle ^= MATH_ANGLE32_PI;
+        neg    = DEF_YES;
+    }
+
+    x = MATH_CORDIC_GAIN_INV;                                   /* See Note #2b.                                        */
+    y = 0;
+    z = (CPU_INT32S)angle;
+    for (i = 0u; i < MATH_CORDIC_ITER_MAX; i++) {
+        x_prev = x;
+        if (z >= 0) {
+            x -= y      >> i;
+            y += x_prev >> i;
+            z -= (CPU_INT32S)Math_CORDIC_AtanTbl[i];
+        } else {
+            x += y      >> i;
+            y -= x_prev >> i;
+            z += (CPU_INT32S)Math_CORDIC_AtanTbl[i];
+        }
+    }
+
+    if (neg == DEF_YES) {
+        x = -x;
+        y = -y;
+    }
+
+    if (p_sin != (MATH_Q31 *)0) {                               /* Q2.30 to Q1.31.                                      */
+       *p_sin = Math_SatQ31((CPU_INT64S)y * 2);
+    }
+    if (p_cos != (MATH_Q31 *)0) {
+       *p_cos = Math_SatQ31((CPU_INT64S)x * 2);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                            Math_SinQ31()
+*
+* Description : Calculate the sine of a binary angle.
+*
+* Argument(s) : angle       Angle, in units of 2 pi / 2^32.
+*
+* Return(s)   : sin(angle), in Q1.31.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) See 'Math_SinCosQ31()  Note #3'.
+*********************************************************************************************************
+*/
+
+MATH_Q31  Math_SinQ31 (MATH_ANGLE32  angle)
+{
+    MATH_Q31  val;
+
+
+    Math_SinCosQ31(angle, &val, (MATH_Q31 *)0);
+
+    return (val);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            Math_CosQ31()
+*
+* Description : Calculate the cosine of a binary angle.
+*
+* Argument(s) : angle       Angle, in units of 2 pi / 2^32.
+*
+* Return(s)   : cos(angle), in Q1.31.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) See 'Math_SinCosQ31()  Note #3'.
+*********************************************************************************************************
+*/
+
+MATH_Q31  Math_CosQ31 (MATH_ANGLE32  angle)
+{
+    MATH_Q31  val;
+
+
+    Math_SinCosQ31(angle, (MATH_Q31 *)0, &val);
+
+    return (val);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Math_Atan2_Angle16()
+*
+* Description : Calculate the angle of a vector.
+*
+* Argument(s) : y           Y component of the vector.
+*
+*               x           X component of the vector.
+*
+* Return(s)   : atan2(y, x), in units of 2 pi / 2^16, if the vector is NOT null.
+*
+*               0,                                    otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Calculated with MATH_CORDIC_ITER_16 iterations; the error is at most 1 LSB (96 urad).
+*
+*                   See also 'Math_Atan2()'.
+*********************************************************************************************************
+*/
+
+MATH_ANGLE16  Math_Atan2_Angle16 (CPU_INT32S  y,
+                                  CPU_INT32S  x)
+{
+    MATH_ANGLE32  angle;
+
+
+    angle = Math_Atan2(y, x, MATH_CORDIC_ITER_16);
+
+    return ((MATH_ANGLE16)((angle + DEF_BIT_15) >> 16u));       /* Round to MATH_ANGLE16.                               */
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Math_Atan2_Angle32()
+*
+* Description : Calculate the angle of a vector.
+*
+* Argument(s) : y           Y component of the vector.
+*
+*               x           X component of the vector.
+*
+* Return(s)   : atan2(y, x), in units of 2 pi / 2^32, if the vector is NOT null.
+*
+*               0,                                    otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Calculated with MATH_CORDIC_ITER_MAX iterations; the error is at most 3.2e-8 rad (22 LSB).
+*
+*                   See also 'Math_Atan2()'.
+*********************************************************************************************************
+*/
+
+MATH_ANGLE32  Math_Atan2_Angle32 (CPU_INT32S  y,
+                                  CPU_INT32S  x)
+{
+    MATH_ANGLE32  angle;
+
+
+    angle = Math_Atan2(y, x, MATH_CORDIC_ITER_MAX);
+
+    return (angle);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            Math_Sin_32()
+*
+* Description : Calculate the sine of a floating point angle.
+*
+* Argument(s) : rad         Angle, in radians.
+*
+* Return(s)   : sin(rad).
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) See 'Math_SinCos_32()  Note #2'.
+*********************************************************************************************************
+*/
+
+#if (LIB_MATH_CFG_FP_EN == DEF_ENABLED)
+CPU_FP32  Math_Sin_32 (CPU_FP32  rad)
+{
+    CPU_FP32  val;
+
+
+    val = Math_SinCos_32(rad, 0u);
+
+    return (val);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                            Math_Cos_32()
+*
+* Description : Calculate the cosine of a floating point angle.
+*
+* Argument(s) : rad         Angle, in radians.
+*
+* Return(s)   : cos(rad).
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) See 'Math_SinCos_32()  Note #2'.
+*********************************************************************************************************
+*/
+
+#if (LIB_MATH_CFG_FP_EN == DEF_ENABLED)
+CPU_FP32  Math_Cos_32 (CPU_FP32  rad)
+{
+    CPU_FP32  val;
+
+
+    val = Math_SinCos_32(rad, 1u);
+
+    return (val);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           Math_Atan2_32()
+*
+* Description : Calculate the angle of a floating point vector.
+*
+* Argument(s) : y           Y component of the vector.
+*
+*               x           X component of the vector.
+*
+* Return(s)   : atan2(y, x), in radians in [-pi, pi], if the vector is NOT null.
+*
+*               0,                                    otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The ratio of the smaller to the larger component, in [0, 1], is reduced to
+*                   [-tan(pi/8), tan(pi/8)] with atan(t) = pi/4 + atan((t - 1) / (t + 1)); the polynomial
+*                   is then accurate to 1.2e-7.
+*
+*               (2) The error is at most 4e-7 rad.
+*********************************************************************************************************
+*/
+
+#if (LIB_MATH_CFG_FP_EN == DEF_ENABLED)
+CPU_FP32  Math_Atan2_32 (CPU_FP32  y,
+                         CPU_FP32  x)
+{
+    CPU_FP32     x_abs;
+    CPU_FP32     y_abs;
+    CPU_FP32     t;
+    CPU_FP32     t2;
+    CPU_FP32     angle;
+    CPU_FP32     angle_off;
+    CPU_BOOLEAN  swap;
+
+
+    x_abs = (x < 0.0f) ? -x : x;
+    y_abs = (y < 0.0f) ? -y : y;
+    if ((x_abs == 0.0f) && (y_abs == 0.0f)) {
+        return (0.0f);
+    }
+
+    swap = (y_abs > x_abs) ? DEF_YES : DEF_NO;                  /* Ratio in [0, 1].                                     */
+    t    = (swap  == DEF_YES) ? (x_abs / y_abs) : (y_abs / x_abs);
+
+    angle_off = 0.0f;
+    if (t > MATH_FP_TAN_PI_8) {                                 /* See Note #1.                                         */
+        t         = (t - 1.0f) / (t + 1.0f);
+        angle_off =  MATH_FP_PI_4;
+    }
+
+    t2    = t * t;
+    angle = angle_off + (t + (t * t2 * (MATH_FP_ATAN_C3  + t2 *
+                                       (MATH_FP_ATAN_C5  + t2 *
+                                       (MATH_FP_ATAN_C7  + t2 *
+                                       (MATH_FP_ATAN_C9  + t2 *
+                                       (MATH_FP_ATAN_C11 + t2 *
+                                        MATH_FP_ATAN_C13)))))));
+
+    if (swap == DEF_YES) {                                      /* Unfold to the quadrant of (x, y).                    */
+        angle = MATH_FP_PI_2 - angle;
+    }
+    if (x < 0.0f) {
+        angle = MATH_FP_PI - angle;
+    }
+    if (y < 0.0f) {
+        angle = -angle;
+    }
+
+    return (angle);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                           Math_Sqrt_32()
+*
+* Description : Calculate the square root of a floating point number.
+*
+* Argument(s) : nbr         Number to calculate the square root of.
+*
+* Return(s)   : sqrt(nbr), if 'nbr' is positive.
+*
+*               0,         otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) 1 / sqrt(nbr) is estimated from the bits of the FP32 'nbr' (halving the exponent) to
+*                   within 3.5%, refined by MATH_FP_RSQRT_ITER Newton-Raphson iterations & multiplied
+*                   by 'nbr'.
+*
+*               (2) The relative error is at most 3e-7.  Infinite & NaN numbers are NOT supported.
+*********************************************************************************************************
+*/
+
+#if (LIB_MATH_CFG_FP_EN == DEF_ENABLED)
+CPU_FP32  Math_Sqrt_32 (CPU_FP32  nbr)
+{
+    MATH_FP32_BITS  bits;
+    CPU_FP32        rsqrt;
+    CPU_FP32        nbr_half;
+    CPU_INT32U      i;
+
+
+    if (nbr <= 0.0f) {
+        return (0.0f);
+    }
+
+    bits.Val  = nbr;                                            /* See Note #1.                                         */
+    bits.Bits = MATH_FP_RSQRT_MAGIC - (bits.Bits >> 1u);
+    rsqrt     = bits.Val;
+    nbr_half  = 0.5f * nbr;
+    for (i = 0u; i < MATH_FP_RSQRT_ITER; i++) {
+        rsqrt *= 1.5f - (nbr_half * rsqrt * rsqrt);
+    }
+
+    return (nbr * rsqrt);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          Math_RandHash()
+*
+* Description : Hash an integer.
+*
+* Argument(s) : nbr         Integer to hash.
+*
+* Return(s)   : Hash of 'nbr'.
+*
+* Caller(s)   : Math_RandXoroInit().
+*
+* Note(s)     : (1) The hash (C. Wellons, 'lowbias32') is a bijection of the 32-bit integers in which every
+*                   bit of 'nbr' changes about half the bits of the hash.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  Math_RandHash (CPU_INT32U  nbr)
+{
+    nbr ^= nbr >> 16u;
+    nbr *= MATH_RAND_HASH_MULT_1;
+    nbr ^= nbr >> 15u;
+    nbr *= MATH_RAND_HASH_MULT_2;
+    nbr ^= nbr >> 16u;
+
+    return (nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Math_SatQ15()
+*
+* Description : Saturate an integer to the Q1.15 range.
+*
+* Argument(s) : nbr         Integer to saturate.
+*
+* Return(s)   : 'nbr', saturated to [MATH_Q15_MIN, MATH_Q15_MAX].
+*
+* Caller(s)   : various.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  MATH_Q15  Math_SatQ15 (CPU_INT32S  nbr)
+{
+    if (nbr > MATH_Q15_MAX) {
+        nbr = MATH_Q15_MAX;
+    } else if (nbr < MATH_Q15_MIN) {
+        nbr = MATH_Q15_MIN;
+    }
+
+    return ((MATH_Q15)nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Math_SatQ31()
+*
+* Description : Saturate an integer to the Q1.31 range.
+*
+* Argument(s) : nbr         Integer to saturate.
+*
+* Return(s)   : 'nbr', saturated to [MATH_Q31_MIN, MATH_Q31_MAX].
+*
+* Caller(s)   : various.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  MATH_Q31  Math_SatQ31 (CPU_INT64S  nbr)
+{
+    if (nbr > MATH_Q31_MAX) {
+        nbr = MATH_Q31_MAX;
+    } else if (nbr < MATH_Q31_MIN) {
+        nbr = MATH_Q31_MIN;
+    }
+
+    return ((MATH_Q31)nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            Math_Atan2()
+*
+* Description : Calculate the angle of a vector with CORDIC.
+*
+* Argument(s) : y           Y component of the vector.
+*
+*               x           X component of the vector.
+*
+*               nbr_iter    Number of CORDIC iterations, at most MATH_CORDIC_ITER_MAX.
+*
+* Return(s)   : atan2(y, x), in units of 2 pi / 2^32, if the vector is NOT null.
+*
+*               0,                                    otherwise.
+*
+* Caller(s)   : Math_Atan2_Angle16(),
+*               Math_Atan2_Angle32().
+*
+* Note(s)     : (1) The angle of (|x|, |y|), in [0, pi/2], is calculated by CORDIC in vectoring mode,
+*                   which rotates the vector onto the X axis & sums the rotations; it is then unfolded
+*                   to the quadrant of (x, y).
+*
+*               (2) The vector is first scaled so that its larger component's most significant bit is
+*                   MATH_CORDIC_NORM_BIT : small vectors keep their precision & the CORDIC gain cannot
+*                   overflow.
+*********************************************************************************************************
+*/
+
+static  MATH_ANGLE32  Math_Atan2 (CPU_INT32S  y,
+                                  CPU_INT32S  x,
+                                  CPU_INT32U  nbr_iter)
+{
+    CPU_INT32U    x_abs;
+    CPU_INT32U    y_abs;
+    CPU_INT32U    max;
+    CPU_INT32U    shift;
+    CPU_INT32S    x_rot;
+    CPU_INT32S    y_rot;
+    CPU_INT32S    x_prev;
+    CPU_INT32U    i;
+    MATH_ANGLE32  angle;
+
+
+    x_abs = (x < 0) ? (0u - (CPU_INT32U)x) : (CPU_INT32U)x;
+    y_abs = (y < 0) ? (0u - (CPU_INT32U)y) : (CPU_INT32U)y;
+    max   = (x_abs > y_abs) ? x_abs : y_abs;
+    if (max == 0u) {
+        return (0u);
+    }
+
+    shift = CPU_CntLeadZeros32(max);                            /* Scale the vector (see Note #2).                      */
+    if (shift >= (31u - MATH_CORDIC_NORM_BIT)) {
+        shift -= (31u - MATH_CORDIC_NORM_BIT);
+        x_abs <<= shift;
+        y_abs <<= shift;
+    } else {
+        shift  = (31u - MATH_CORDIC_NORM_BIT) - shift;
+        x_abs >>= shift;
+        y_abs >>= shift;
+    }
+
+    x_rot = (CPU_INT32S)x_abs;                                  /* Rotate onto the X axis (see Note #1).                */
+    y_rot = (CPU_INT32S)y_abs;
+    angle =  0u;
+    for (i = 0u; (i < nbr_iter) && (y_rot != 0); i++) {
+        x_prev = x_rot;
+        if (y_rot > 0) {
+            x_rot += y_rot  >> i;
+            y_rot -= x_prev >> i;
+            angle += Math_CORDIC_AtanTbl[i];
+        } else {
+            x_rot -= y_rot  >> i;
+            y_rot += x_prev >> i;
+            angle -= Math_CORDIC_AtanTbl[i];
+        }
+    }
+
+    if (x < 0) {                                                /* Unfold to the quadrant of (x, y).                    */
+        angle = MATH_ANGLE32_PI - angle;
+    }
+    if (y < 0) {
+        angle = 0u - angle;
+    }
+
+    return (angle);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          Math_SinCos_32()
+*
+* Description : Calculate the sine or the cosine of a floating point angle.
+*
+* Argument(s) : rad         Angle, in radians.
+*
+*               quad_off    Number of quarter waves to advance 'rad' by :
+*
+*                               0       Calculate the sine.
+*                               1       Calculate the cosine.
+*
+* Return(s)   : sin(rad + (quad_off * pi / 2)).
+*
+* Caller(s)   : Math_Sin_32(),
+*               Math_Cos_32().
+*
+* Note(s)     : (1) 'rad' is reduced to [-pi/4, pi/4] by subtracting the nearest multiple of pi/2, split
+*                   in two parts so that the subtraction is exact; the quadrant then selects the sine or
+*                   the cosine polynomial & its sign.
+*
+*               (2) The error is at most 2e-7 for |rad| < 2^10; the reduction loses precision as 'rad'
+*                   grows, so accumulated angles SHOULD be wrapped to [-pi, pi].
+*********************************************************************************************************
+*/
+
+#if (LIB_MATH_CFG_FP_EN == DEF_ENABLED)
+static  CPU_FP32  Math_SinCos_32 (CPU_FP32    rad,
+                                  CPU_INT32U  quad_off)
+{
+    CPU_INT32S  quad;
+    CPU_FP32    r;
+    CPU_FP32    r2;
+    CPU_FP32    val;
+
+
+    quad = (CPU_INT32S)((rad * MATH_FP_2_PI) + ((rad < 0.0f) ? -0.5f : 0.5f));
+    r    = (rad - ((CPU_FP32)quad * MATH_FP_PI_2_HI)) - ((CPU_FP32)quad * MATH_FP_PI_2_LO);
+    r2   =  r * r;
+
+    quad_off += (CPU_INT32U)quad;
+    if ((quad_off & 1u) == 0u) {                                /* sin(r).                                              */
+        val = r + (r * r2 * (MATH_FP_SIN_C3 + r2 *
+                            (MATH_FP_SIN_C5 + r2 *
+                            (MATH_FP_SIN_C7 + r2 *
+                             MATH_FP_SIN_C9))));
+    } else {                                                    /* cos(r).                                              */
+        val = 1.0f + (r2 * (MATH_FP_COS_C2 + r2 *
+                           (MATH_FP_COS_C4 + r2 *
+                           (MATH_FP_COS_C6 + r2 *
+                           (MATH_FP_COS_C8 + r2 *
+                            MATH_FP_COS_C10)))));
+    }
+    if ((quad_off & 2u) != 0u) {
+        val = -val;
+    }
+
+    return (val);
+}
+#endif
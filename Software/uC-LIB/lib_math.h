@@ -111,6 +111,8 @@
 
 #include  <lib_def.h>
 
+#include  <lib_cfg.h>
+
 
 /*
 *********************************************************************************************************
@@ -125,6 +127,32 @@
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                        DEFAULT CONFIGURATION
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                  MATH FLOATING POINT CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MATH_CFG_FP_EN to enable/disable the single-precision floating point math
+*               functions.
+*
+*           (2) These functions use ONLY CPU_FP32 arithmetic, intended for CPUs with a single-precision
+*               FPU (e.g. Cortex-M4F).  They do NOT call the compiler's (double-precision) math library.
+*********************************************************************************************************
+*/
+
+                                                                /* Configure floating point feature(s) [see Note #1] :  */
+#ifndef  LIB_MATH_CFG_FP_EN
+#define  LIB_MATH_CFG_FP_EN                     DEF_DISABLED
+                                                                /*   DEF_DISABLED     Floating point functions DISABLED */
+                                                                /*   DEF_ENABLED      Floating point functions ENABLED  */
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                               DEFINES
@@ -172,6 +200,42 @@
 #define  RAND_LCG_PARAM_B                              12345u   /* See Note #1b1A3.                                     */
 
 
+/*
+*********************************************************************************************************
+*                                       FIXED-POINT MATH DEFINES
+*
+* Note(s) : (1) Fixed-point fractions are two's-complement signed integers :
+*
+*               (a) MATH_Q15        Q1.15 : nbr / 2^15, in [-1, 1 - 2^-15]
+*               (b) MATH_Q31        Q1.31 : nbr / 2^31, in [-1, 1 - 2^-31]
+*
+*           (2) (a) Angles are binary angles; unsigned integers whose full range is one turn :
+*
+*                   (1) MATH_ANGLE16        2^16 == 2 pi rad; 1 LSB ~= 96 urad
+*                   (2) MATH_ANGLE32        2^32 == 2 pi rad; 1 LSB ~= 1.5 nrad
+*
+*               (b) Binary angles wrap modulo one turn with ordinary unsigned arithmetic; so headings MAY
+*                   be accumulated & subtracted without range checks.  Casting a binary angle to the signed
+*                   integer of the same size gives the angle in [-pi, pi).
+*
+*           (3) The floating point functions take & return angles in radians.
+*********************************************************************************************************
+*/
+
+#define  MATH_Q15_FRAC_BITS                               15u
+#define  MATH_Q31_FRAC_BITS                               31u
+
+#define  MATH_Q15_MAX                         ((MATH_Q15)DEF_INT_16S_MAX_VAL)
+#define  MATH_Q15_MIN                         ((MATH_Q15)DEF_INT_16S_MIN_VAL)
+#define  MATH_Q31_MAX                         ((MATH_Q31)DEF_INT_32S_MAX_VAL)
+#define  MATH_Q31_MIN                         ((MATH_Q31)DEF_INT_32S_MIN_VAL)
+
+#define  MATH_ANGLE16_PI                              0x8000u
+#define  MATH_ANGLE16_PI_2                            0x4000u
+#define  MATH_ANGLE32_PI                          0x80000000u
+#define  MATH_ANGLE32_PI_2                        0x40000000u
+
+
 /*
 *********************************************************************************************************
 *                                             DATA TYPES
@@ -187,6 +251,43 @@
 typedef  CPU_INT32U  RAND_NBR;
 
 
+/*
+*********************************************************************************************************
+*                                 RANDOM NUMBER GENERATOR DATA TYPES
+*
+* Note(s) : (1) States of the Math_RandXoro*() (xoroshiro64**) & Math_RandPCG_*() (PCG32) generators.
+*
+*           (2) Unlike Math_Rand(), which updates a global seed in a critical section, these generators
+*               keep their state in an object owned by the caller; so each task SHOULD own a generator
+*               & NO interrupts are disabled to draw a pseudo-random number.
+*********************************************************************************************************
+*/
+
+typedef  struct  math_rand_xoro {
+    CPU_INT32U  State[2];                                       /* MUST NOT be all zero (see Math_RandXoroInit()).      */
+} MATH_RAND_XORO;
+
+typedef  struct  math_rand_pcg {
+    CPU_INT64U  State;                                          /* LCG state.                                           */
+    CPU_INT64U  Inc;                                            /* LCG increment, selects the stream; MUST be odd.      */
+} MATH_RAND_PCG;
+
+
+/*
+*********************************************************************************************************
+*                                     FIXED-POINT MATH DATA TYPES
+*
+* Note(s) : (1) See 'FIXED-POINT MATH DEFINES  Note #1 & #2'.
+*********************************************************************************************************
+*/
+
+typedef  CPU_INT16S  MATH_Q15;
+typedef  CPU_INT32S  MATH_Q31;
+
+typedef  CPU_INT16U  MATH_ANGLE16;
+typedef  CPU_INT32U  MATH_ANGLE32;
+
+
 /*
 *********************************************************************************************************
 *                                          GLOBAL VARIABLES
@@ -263,6 +364,69 @@ typedef  CPU_INT32U  RAND_NBR;
 #define  MATH_ROUND_INC_UP(nbr, inc)                       (((nbr) + ((inc) - 1)) / (inc) * (inc))
 
 
+/*
+*********************************************************************************************************
+*                                  MATH_Q15_FROM_FP() / MATH_Q31_FROM_FP()
+*
+* Description : Convert a floating point constant to a fixed-point fraction.
+*
+* Argument(s) : nbr           Floating point constant, in [-1, 1).
+*
+* Return(s)   : 'nbr', truncated to Q1.15 / Q1.31.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Intended for constant expressions ONLY, which are evaluated by the compiler; NO floating
+*                   point code is generated.
+*
+*               (2) 'nbr' is NOT range-checked; 1.0 does NOT fit.
+*********************************************************************************************************
+*/
+
+#define  MATH_Q15_FROM_FP(nbr)                             ((MATH_Q15)((nbr) * 32768.0))
+#define  MATH_Q31_FROM_FP(nbr)                             ((MATH_Q31)((nbr) * 2147483648.0))
+
+
+/*
+*********************************************************************************************************
+*                                  MATH_Q15_TO_Q31() / MATH_Q31_TO_Q15()
+*
+* Description : Convert between the fixed-point fraction formats.
+*
+* Argument(s) : nbr           Fixed-point fraction to convert.
+*
+* Return(s)   : 'nbr', converted (& truncated, from Q1.31 to Q1.15).
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#define  MATH_Q15_TO_Q31(nbr)                              ((MATH_Q31)(nbr) * 65536)
+#define  MATH_Q31_TO_Q15(nbr)                              ((MATH_Q15)((MATH_Q31)(nbr) >> 16))
+
+
+/*
+*********************************************************************************************************
+*                              MATH_ANGLE16_FROM_DEG() / MATH_ANGLE32_FROM_DEG()
+*
+* Description : Convert a constant angle in degrees to a binary angle.
+*
+* Argument(s) : deg           Angle constant, in degrees in [-180, 180].
+*
+* Return(s)   : 'deg', truncated to a MATH_ANGLE16 / MATH_ANGLE32.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) See 'MATH_Q15_FROM_FP()  Note #1'.
+*********************************************************************************************************
+*/
+
+#define  MATH_ANGLE16_FROM_DEG(deg)                        ((MATH_ANGLE16)(CPU_INT32S)((deg) * (65536.0      / 360.0)))
+#define  MATH_ANGLE32_FROM_DEG(deg)                        ((MATH_ANGLE32)(CPU_INT64S)((deg) * (4294967296.0 / 360.0)))
+
+
 /*
 *********************************************************************************************************
 *                                         FUNCTION PROTOTYPES
@@ -278,6 +442,107 @@ RAND_NBR  Math_Rand       (void);
 
 RAND_NBR  Math_RandSeed   (RAND_NBR  seed);
 
+                                                                /* ------------------- PRNG FNCTS --------------------- */
+void          Math_RandXoroInit   (MATH_RAND_XORO  *p_rand,
+                                   RAND_NBR         seed);
+
+CPU_INT32U    Math_RandXoro       (MATH_RAND_XORO  *p_rand);
+
+void          Math_RandXoroFill   (MATH_RAND_XORO  *p_rand,
+                                   void            *p_buf,
+                                   CPU_SIZE_T       size);
+
+CPU_INT32U    Math_RandXoroBounded(MATH_RAND_XORO  *p_rand,
+                                   CPU_INT32U       bound);
+
+void          Math_RandPCG_Init   (MATH_RAND_PCG   *p_rand,
+                                   CPU_INT64U       seed,
+                                   CPU_INT64U       stream);
+
+CPU_INT32U    Math_RandPCG        (MATH_RAND_PCG   *p_rand);
+
+void          Math_RandPCG_Fill   (MATH_RAND_PCG   *p_rand,
+                                   void            *p_buf,
+                                   CPU_SIZE_T       size);
+
+CPU_INT32U    Math_RandPCG_Bounded(MATH_RAND_PCG   *p_rand,
+                                   CPU_INT32U       bound);
+
+                                                                /* ----------------- FIXED-POINT FNCTS ---------------- */
+MATH_Q15      Math_AddSatQ15      (MATH_Q15       a,
+                                   MATH_Q15       b);
+
+MATH_Q31      Math_AddSatQ31      (MATH_Q31       a,
+                                   MATH_Q31       b);
+
+MATH_Q15      Math_SubSatQ15      (MATH_Q15       a,
+                                   MATH_Q15       b);
+
+MATH_Q31      Math_SubSatQ31      (MATH_Q31       a,
+                                   MATH_Q31       b);
+
+MATH_Q15      Math_MulQ15         (MATH_Q15       a,
+                                   MATH_Q15       b);
+
+MATH_Q31      Math_MulQ31         (MATH_Q31       a,
+                                   MATH_Q31       b);
+
+MATH_Q31      Math_MacQ15         (MATH_Q31       acc,
+                                   MATH_Q15       a,
+                                   MATH_Q15       b);
+
+MATH_Q31      Math_MacQ31         (MATH_Q31       acc,
+                                   MATH_Q31       a,
+                                   MATH_Q31       b);
+
+CPU_INT32U    Math_Recip_Int32U   (CPU_INT32U     nbr);
+
+CPU_INT32U    Math_DivRecip_Int32U(CPU_INT32U     nbr,
+                                   CPU_INT32U     div,
+                                   CPU_INT32U     recip);
+
+                                                                /* -------------------- SQRT FNCTS -------------------- */
+CPU_INT16U    Math_Sqrt_Int32U    (CPU_INT32U     nbr);
+
+CPU_INT32U    Math_Sqrt_Int64U    (CPU_INT64U     nbr);
+
+MATH_Q15      Math_SqrtQ15        (MATH_Q15       nbr);
+
+MATH_Q31      Math_SqrtQ31        (MATH_Q31       nbr);
+
+CPU_INT32U    Math_Hypot_Int32S   (CPU_INT32S     x,
+                                   CPU_INT32S     y);
+
+                                                                /* -------------------- TRIG FNCTS -------------------- */
+MATH_Q15      Math_SinQ15         (MATH_ANGLE16   angle);
+
+MATH_Q15      Math_CosQ15         (MATH_ANGLE16   angle);
+
+void          Math_SinCosQ31      (MATH_ANGLE32   angle,
+                                   MATH_Q31      *p_sin,
+                                   MATH_Q31      *p_cos);
+
+MATH_Q31      Math_SinQ31         (MATH_ANGLE32   angle);
+
+MATH_Q31      Math_CosQ31         (MATH_ANGLE32   angle);
+
+MATH_ANGLE16  Math_Atan2_Angle16  (CPU_INT32S     y,
+                                   CPU_INT32S     x);
+
+MATH_ANGLE32  Math_Atan2_Angle32  (CPU_INT32S     y,
+                                   CPU_INT32S     x);
+
+#if (LIB_MATH_CFG_FP_EN == DEF_ENABLED)                         /* ----------------- FLOATING POINT FNCTS ------------- */
+CPU_FP32      Math_Sin_32         (CPU_FP32       rad);
+
+CPU_FP32      Math_Cos_32         (CPU_FP32       rad);
+
+CPU_FP32      Math_Atan2_32       (CPU_FP32       y,
+                                   CPU_FP32       x);
+
+CPU_FP32      Math_Sqrt_32        (CPU_FP32       nbr);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -285,6 +550,13 @@ RAND_NBR  Math_RandSeed   (RAND_NBR  seed);
 *********************************************************************************************************
 */
 
+#if    ((LIB_MATH_CFG_FP_EN != DEF_DISABLED) && \
+        (LIB_MATH_CFG_FP_EN != DEF_ENABLED ))
+#error  "LIB_MATH_CFG_FP_EN              illegally #define'd in 'lib_cfg.h'"
+#error  "                                [MUST be  DEF_DISABLED]           "
+#error  "                                [     ||  DEF_ENABLED ]           "
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -69,9 +69,43 @@
 /*
 *********************************************************************************************************
 *                                            LOCAL DEFINES
+*
+* Note(s) : (1) Variable-size memory pool free lists are indexed by first level (power of 2 of the block
+*               size) & second level (1 of MEM_VAR_POOL_SL_NBR linear ranges within that power of 2).
+*               Sizes below MEM_VAR_POOL_SIZE_SMALL are all mapped linearly in the first level 0.
+*
+*           (2) Block sizes are multiples of MEM_VAR_POOL_ALIGN, which leaves the two lowest bits of the
+*               size field free to hold the block flags.
 *********************************************************************************************************
 */
 
+#if (LIB_MEM_CFG_VAR_POOL_EN == DEF_ENABLED)
+#define  MEM_VAR_POOL_SL_NBR_LOG2                          4u   /* See Note #1.                                         */
+#define  MEM_VAR_POOL_SL_NBR                     (1u << MEM_VAR_POOL_SL_NBR_LOG2)
+#define  MEM_VAR_POOL_FL_SHIFT                   (MEM_VAR_POOL_SL_NBR_LOG2 + 2u)
+#define  MEM_VAR_POOL_SIZE_SMALL                 (1u << MEM_VAR_POOL_FL_SHIFT)
+
+#define  MEM_VAR_POOL_ALIGN                       sizeof(void *)
+
+#define  MEM_VAR_POOL_BLK_FLAG_FREE               DEF_BIT_00    /* See Note #2.                                         */
+#define  MEM_VAR_POOL_BLK_FLAG_PREV_FREE          DEF_BIT_01
+#define  MEM_VAR_POOL_BLK_FLAGS                  (MEM_VAR_POOL_BLK_FLAG_FREE | MEM_VAR_POOL_BLK_FLAG_PREV_FREE)
+
+                                                                /* Offset of blk data from start of blk hdr.            */
+#define  MEM_VAR_POOL_BLK_HDR_SIZE               (sizeof(MEM_VAR_POOL_BLK) - (2u * sizeof(MEM_VAR_POOL_BLK *)))
+                                                                /* Overhead of alloc'd blk (see 'MEM_VAR_POOL_BLK').    */
+#define  MEM_VAR_POOL_BLK_OVERHEAD               (MEM_VAR_POOL_BLK_HDR_SIZE - sizeof(MEM_VAR_POOL_BLK *))
+                                                                /* Min blk size able to hold free blk links.            */
+#define  MEM_VAR_POOL_BLK_SIZE_MIN               (sizeof(MEM_VAR_POOL_BLK)  -  sizeof(MEM_VAR_POOL_BLK *))
+
+#define  MEM_VAR_POOL_BLK_SIZE(p_blk)            ((p_blk)->Size & ~((CPU_SIZE_T)MEM_VAR_POOL_BLK_FLAGS))
+#define  MEM_VAR_POOL_BLK_NEXT(p_blk)            ((MEM_VAR_POOL_BLK *)((CPU_INT08U *)(p_blk)                + \
+                                                                       MEM_VAR_POOL_BLK_OVERHEAD            + \
+                                                                       MEM_VAR_POOL_BLK_SIZE(p_blk)))
+
+#define  MEM_VAR_POOL_FLS(size)                  ((DEF_INT_CPU_NBR_BITS - 1u) - CPU_CntLeadZeros((CPU_DATA)(size)))
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -86,6 +120,29 @@
 *********************************************************************************************************
 */
 
+/*
+*********************************************************************************************************
+*                               VARIABLE-SIZE MEMORY POOL BLOCK DATA TYPE
+*
+* Note(s) : (1) 'PrevPhysPtr' is stored in the last word of the previous physical block & is only written
+*               when that block is free. An allocated block thus only costs its 'Size' word.
+*
+*           (2) 'NextFreePtr' & 'PrevFreePtr' are stored in the block data & are only valid when the block
+*               is free. The block data starts at 'NextFreePtr'.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_VAR_POOL_EN == DEF_ENABLED)
+typedef  struct  mem_var_pool_blk  MEM_VAR_POOL_BLK;
+
+struct  mem_var_pool_blk {                                      /* ------------- VAR-SIZE MEM POOL BLK HDR ------------ */
+    MEM_VAR_POOL_BLK  *PrevPhysPtr;                             /* Ptr to prev phys blk (see Note #1).                  */
+    CPU_SIZE_T         Size;                                    /* Blk data size, in octets, & blk flags.               */
+    MEM_VAR_POOL_BLK  *NextFreePtr;                             /* Ptr to next free blk in list (see Note #2).          */
+    MEM_VAR_POOL_BLK  *PrevFreePtr;                             /* Ptr to prev free blk in list.                        */
+};
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -111,6 +168,11 @@ MEM_SEG      Mem_SegHeap;                                       /* Heap mem seg.
 
 MEM_SEG     *Mem_SegHeadPtr;                                    /* Ptr to head of seg list.                             */
 
+#if ((LIB_MEM_CFG_VAR_POOL_EN == DEF_ENABLED) && \
+     (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED))
+MEM_VAR_POOL  *Mem_VarPoolHeadPtr;                              /* Ptr to head of var-size mem pool list.               */
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -168,6 +230,17 @@ static  CPU_BOOLEAN   Mem_PoolBlkIsValidAddr   (       MEM_POOL      *p_pool,
                                                        void          *p_mem);
 #endif
 
+#if (LIB_MEM_CFG_VAR_POOL_EN == DEF_ENABLED)
+static  CPU_SIZE_T    Mem_VarPoolMapInsert     (       CPU_SIZE_T     size,
+                                                       CPU_SIZE_T    *p_sl);
+
+static  void          Mem_VarPoolBlkInsert     (       MEM_VAR_POOL  *p_pool,
+                                                       void          *p_blk);
+
+static  void          Mem_VarPoolBlkRemove     (       MEM_VAR_POOL  *p_pool,
+                                                       void          *p_blk);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -212,6 +285,11 @@ void  Mem_Init (void)
                                                                 /* ------------------ INIT SEG LIST ------------------- */
     Mem_SegHeadPtr = DEF_NULL;
 
+#if ((LIB_MEM_CFG_VAR_POOL_EN == DEF_ENABLED) && \
+     (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED))
+    Mem_VarPoolHeadPtr = DEF_NULL;                              /* Init var-size mem pool list.                         */
+#endif
+
 #if (LIB_MEM_CFG_HEAP_SIZE > 0u)
     {
         LIB_ERR   err;
@@ -261,6 +339,7 @@ void  Mem_Init (void)
 *********************************************************************************************************
 */
 
+#if (LIB_MEM_CFG_OPTIMIZE_ASM_EN != DEF_ENABLED)
 void  Mem_Clr (void        *pmem,
                CPU_SIZE_T   size)
 {
@@ -268,6 +347,7 @@ void  Mem_Clr (void        *pmem,
             0u,                                                 /* See Note #2.                                         */
             size);
 }
+#endif
 
 
 /*
@@ -302,6 +382,7 @@ void  Mem_Clr (void        *pmem,
 *********************************************************************************************************
 */
 
+#if (LIB_MEM_CFG_OPTIMIZE_ASM_EN != DEF_ENABLED)
 void  Mem_Set (void        *pmem,
                CPU_INT08U   data_val,
                CPU_SIZE_T   size)
@@ -356,6 +437,7 @@ void  Mem_Set (void        *pmem,
         size_rem   -= sizeof(CPU_INT08U);
     }
 }
+#endif
 
 
 /*
@@ -645,6 +727,7 @@ void  Mem_Move (       void        *pdest,
 *********************************************************************************************************
 */
 
+#if (LIB_MEM_CFG_OPTIMIZE_ASM_EN != DEF_ENABLED)
 CPU_BOOLEAN  Mem_Cmp (const  void        *p1_mem,
                       const  void        *p2_mem,
                              CPU_SIZE_T   size)
@@ -731,6 +814,7 @@ CPU_BOOLEAN  Mem_Cmp (const  void        *p1_mem,
 
     return (mem_cmp);
 }
+#endif
 
 
 /*
@@ -2171,6 +2255,458 @@ CPU_SIZE_T  Mem_DynPoolBlkNbrAvailGet (MEM_DYN_POOL  *p_pool,
 }
 
 
+/*
+*********************************************************************************************************
+*                                         Mem_VarPoolCreate()
+*
+* Description : Creates a variable-size memory pool, from which blocks of any size can be allocated & freed
+*               in constant time.
+*
+* Argument(s) : p_name          Pointer to pool name.
+*
+*               p_pool          Pointer to pool data.
+*
+*               p_seg           Pointer to segment from which to allocate memory. Will allocate from
+*                               general-purpose heap if null.
+*
+*               pool_size       Size of pool region, in bytes, including block headers. See Note #1.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   LIB_MEM_ERR_NONE                Operation was successful.
+*                                   LIB_MEM_ERR_NULL_PTR            Pool data pointer NULL.
+*                                   LIB_MEM_ERR_INVALID_MEM_SIZE    Invalid pool size specified.
+*
+*                                   -------------------RETURNED BY Mem_SegAllocInternal()-------------------
+*                                   LIB_MEM_ERR_INVALID_MEM_ALIGN   Invalid memory block alignment requested.
+*                                   LIB_MEM_ERR_INVALID_MEM_SIZE    Invalid memory block size specified.
+*                                   LIB_MEM_ERR_NULL_PTR            Error or segment data pointer NULL.
+*                                   LIB_MEM_ERR_SEG_OVF             Allocation would overflow memory segment.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The free lists tables are allocated from the segment in addition to 'pool_size'. Their
+*                   size grows with the base-2 logarithm of 'pool_size' (see 'lib_mem.h  VARIABLE-SIZE
+*                   MEMORY POOL DATA TYPE  Note #2').
+*
+*               (2) The pool region starts with a single free block & ends with a zero-size sentinel block
+*                   that is never freed, so that merging never needs to check for the pool boundaries.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_VAR_POOL_EN == DEF_ENABLED)
+void  Mem_VarPoolCreate (const  CPU_CHAR      *p_name,
+                                MEM_VAR_POOL  *p_pool,
+                                MEM_SEG       *p_seg,
+                                CPU_SIZE_T     pool_size,
+                                LIB_ERR       *p_err)
+{
+    CPU_INT08U        *p_mem;
+    MEM_VAR_POOL_BLK  *p_blk;
+    MEM_VAR_POOL_BLK  *p_blk_end;
+    CPU_SIZE_T         blk_size;
+    CPU_SIZE_T         tbl_size;
+    CPU_SIZE_T         fl_nbr;
+    CPU_SIZE_T         sl;
+    CPU_SIZE_T         i;
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    CPU_SR_ALLOC();
+#endif
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_pool == DEF_NULL) {                                   /* Chk for NULL pool data ptr.                          */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    if (p_seg == DEF_NULL) {                                    /* Alloc from heap if p_seg is null.                    */
+#if (LIB_MEM_CFG_HEAP_SIZE > 0u)
+        p_seg = &Mem_SegHeap;
+#else
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+#endif
+    }
+
+    pool_size &= ~((CPU_SIZE_T)MEM_VAR_POOL_ALIGN - 1u);        /* Trunc pool size to blk align.                        */
+    if (pool_size < (MEM_VAR_POOL_BLK_HDR_SIZE +                /* Chk that pool can hold at least one blk.             */
+                     MEM_VAR_POOL_BLK_OVERHEAD +
+                     MEM_VAR_POOL_BLK_SIZE_MIN)) {
+       *p_err = LIB_MEM_ERR_INVALID_MEM_SIZE;
+        return;
+    }
+                                                                /* Size of first free blk, excluding sentinel blk.      */
+    blk_size = pool_size - MEM_VAR_POOL_BLK_HDR_SIZE - MEM_VAR_POOL_BLK_OVERHEAD;
+    fl_nbr   = Mem_VarPoolMapInsert(blk_size, &sl) + 1u;
+    if (fl_nbr >= DEF_INT_CPU_NBR_BITS) {                       /* Chk that first lvl fits in bitmap.                   */
+       *p_err = LIB_MEM_ERR_INVALID_MEM_SIZE;
+        return;
+    }
+
+                                                                /* ------------- ALLOC TBLS & POOL REGION ------------- */
+    tbl_size = (fl_nbr * MEM_VAR_POOL_SL_NBR * sizeof(void *))  +
+               (fl_nbr * sizeof(CPU_DATA));
+    tbl_size =  MATH_ROUND_INC_UP_PWR2(tbl_size, MEM_VAR_POOL_ALIGN);
+
+    p_mem = (CPU_INT08U *)Mem_SegAllocInternal(p_name,
+                                               p_seg,
+                                               tbl_size + pool_size,
+                                               MEM_VAR_POOL_ALIGN,
+                                               LIB_MEM_PADDING_ALIGN_NONE,
+                                               DEF_NULL,
+                                               p_err);
+    if (*p_err != LIB_MEM_ERR_NONE) {
+        return;
+    }
+
+                                                                /* ----------------- CREATE POOL DATA ----------------- */
+    p_pool->BlkFreeTbl   = (void **)p_mem;
+    p_pool->SL_BitmapTbl = (CPU_DATA *)(p_mem + (fl_nbr * MEM_VAR_POOL_SL_NBR * sizeof(void *)));
+    p_pool->FL_Bitmap    =  0u;
+    p_pool->FL_Nbr       =  fl_nbr;
+
+    for (i = 0u; i < (fl_nbr * MEM_VAR_POOL_SL_NBR); i++) {
+        p_pool->BlkFreeTbl[i] = DEF_NULL;
+    }
+    for (i = 0u; i < fl_nbr; i++) {
+        p_pool->SL_BitmapTbl[i] = 0u;
+    }
+
+    p_blk                  = (MEM_VAR_POOL_BLK *)(p_mem + tbl_size);
+    p_blk->Size            =  blk_size | MEM_VAR_POOL_BLK_FLAG_FREE;
+    p_blk_end              =  MEM_VAR_POOL_BLK_NEXT(p_blk);     /* Create sentinel blk (see Note #2).                   */
+    p_blk_end->PrevPhysPtr =  p_blk;
+    p_blk_end->Size        =  MEM_VAR_POOL_BLK_FLAG_PREV_FREE;
+
+    p_pool->PoolSegPtr     = p_seg;
+    p_pool->PoolAddrStart  = p_blk;
+    p_pool->PoolAddrEnd    = p_blk_end;
+    p_pool->SizeTot        = blk_size + MEM_VAR_POOL_BLK_OVERHEAD;
+    p_pool->SizeUsed       = 0u;
+    p_pool->SizeUsedMax    = 0u;
+    p_pool->BlkAllocCnt    = 0u;
+
+    Mem_VarPoolBlkInsert(p_pool, p_blk);
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    p_pool->NamePtr = p_name;
+
+    CPU_CRITICAL_ENTER();                                       /* Add pool to list, for Mem_OutputUsage().             */
+    p_pool->NextPtr    = Mem_VarPoolHeadPtr;
+    Mem_VarPoolHeadPtr = p_pool;
+    CPU_CRITICAL_EXIT();
+#endif
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         Mem_VarPoolBlkGet()
+*
+* Description : Gets a memory block of specified size from a variable-size memory pool.
+*
+* Argument(s) : p_pool  Pointer to pool data.
+*
+*               size    Size of memory block, in bytes.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           LIB_MEM_ERR_NONE                Operation was successful.
+*                           LIB_MEM_ERR_NULL_PTR            Pool data pointer NULL.
+*                           LIB_MEM_ERR_INVALID_MEM_SIZE    Invalid memory block size specified.
+*                           LIB_MEM_ERR_POOL_EMPTY          No free block big enough in pool.
+*
+* Return(s)   : Pointer to memory block, if successful. Block is aligned on a pointer size boundary.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The requested size is rounded up to the next free list boundary, so that any block
+*                   found in the first non-empty list at or above that boundary is big enough. This makes the
+*                   search constant-time but may fail for a size very close to the largest free block.
+*
+*               (2) The unused end of the block found is split off & returned to the free lists, if big
+*                   enough to hold a block.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_VAR_POOL_EN == DEF_ENABLED)
+void  *Mem_VarPoolBlkGet (MEM_VAR_POOL  *p_pool,
+                          CPU_SIZE_T     size,
+                          LIB_ERR       *p_err)
+{
+    MEM_VAR_POOL_BLK  *p_blk;
+    MEM_VAR_POOL_BLK  *p_blk_rem;
+    CPU_SIZE_T         blk_size;
+    CPU_SIZE_T         fl;
+    CPU_SIZE_T         sl;
+    CPU_DATA           map;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if (p_pool == DEF_NULL) {                                   /* Chk for NULL pool data ptr.                          */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return (DEF_NULL);
+    }
+
+    if (size < 1u) {                                            /* Chk for inv blk size.                                */
+       *p_err = LIB_MEM_ERR_INVALID_MEM_SIZE;
+        return (DEF_NULL);
+    }
+#endif
+
+    if (size > p_pool->SizeTot) {                               /* Prevent ovf when rounding size up.                   */
+       *p_err = LIB_MEM_ERR_POOL_EMPTY;
+        return (DEF_NULL);
+    }
+
+    size = MATH_ROUND_INC_UP_PWR2(size, MEM_VAR_POOL_ALIGN);
+    size = DEF_MAX(size, MEM_VAR_POOL_BLK_SIZE_MIN);
+
+    blk_size = size;                                            /* Round size up to next free list (see Note #1).       */
+    if (blk_size >= MEM_VAR_POOL_SIZE_SMALL) {
+        blk_size += ((CPU_SIZE_T)1u << (MEM_VAR_POOL_FLS(blk_size) - MEM_VAR_POOL_SL_NBR_LOG2)) - 1u;
+    }
+    fl = Mem_VarPoolMapInsert(blk_size, &sl);
+
+                                                                /* ------------- FIND SUITABLE FREE BLK --------------- */
+    p_blk = DEF_NULL;
+    CPU_CRITICAL_ENTER();
+    if (fl < p_pool->FL_Nbr) {
+        map = p_pool->SL_BitmapTbl[fl] & (DEF_INT_CPU_U_MAX_VAL << sl);
+        if (map == 0u) {                                        /* If no list big enough at this first lvl ...          */
+                                                                /* ... take smallest list at a higher first lvl.        */
+            map = p_pool->FL_Bitmap & (DEF_INT_CPU_U_MAX_VAL << (fl + 1u));
+            if (map != 0u) {
+                fl  = CPU_CntTrailZeros(map);
+                map = p_pool->SL_BitmapTbl[fl];
+            }
+        }
+        if (map != 0u) {
+            sl    = CPU_CntTrailZeros(map);
+            p_blk = (MEM_VAR_POOL_BLK *)p_pool->BlkFreeTbl[(fl * MEM_VAR_POOL_SL_NBR) + sl];
+        }
+    }
+
+    if (p_blk == DEF_NULL) {
+        CPU_CRITICAL_EXIT();
+       *p_err = LIB_MEM_ERR_POOL_EMPTY;
+        return (DEF_NULL);
+    }
+
+    Mem_VarPoolBlkRemove(p_pool, p_blk);
+
+                                                                /* ------------- SPLIT BLK (see Note #2) -------------- */
+    blk_size = MEM_VAR_POOL_BLK_SIZE(p_blk);
+    if (blk_size >= (size + MEM_VAR_POOL_BLK_OVERHEAD + MEM_VAR_POOL_BLK_SIZE_MIN)) {
+        p_blk_rem       = (MEM_VAR_POOL_BLK *)((CPU_INT08U *)p_blk + MEM_VAR_POOL_BLK_OVERHEAD + size);
+        p_blk_rem->Size = (blk_size - size - MEM_VAR_POOL_BLK_OVERHEAD) | MEM_VAR_POOL_BLK_FLAG_FREE;
+        p_blk->Size     =  size;                                /* Prev phys blk of a free blk is never free.           */
+
+        MEM_VAR_POOL_BLK_NEXT(p_blk_rem)->PrevPhysPtr = p_blk_rem;
+        Mem_VarPoolBlkInsert(p_pool, p_blk_rem);
+    } else {
+        DEF_BIT_CLR(MEM_VAR_POOL_BLK_NEXT(p_blk)->Size, (CPU_SIZE_T)MEM_VAR_POOL_BLK_FLAG_PREV_FREE);
+        DEF_BIT_CLR(p_blk->Size,                        (CPU_SIZE_T)MEM_VAR_POOL_BLK_FLAG_FREE);
+    }
+
+    p_pool->SizeUsed += MEM_VAR_POOL_BLK_SIZE(p_blk) + MEM_VAR_POOL_BLK_OVERHEAD;
+    if (p_pool->SizeUsed > p_pool->SizeUsedMax) {
+        p_pool->SizeUsedMax = p_pool->SizeUsed;
+    }
+    p_pool->BlkAllocCnt++;
+    CPU_CRITICAL_EXIT();
+
+   *p_err = LIB_MEM_ERR_NONE;
+
+    return ((void *)((CPU_INT08U *)p_blk + MEM_VAR_POOL_BLK_HDR_SIZE));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_VarPoolBlkFree()
+*
+* Description : Frees memory block to its variable-size memory pool, merging it with adjacent free blocks.
+*
+* Argument(s) : p_pool  Pointer to pool data.
+*
+*               p_blk   Pointer to first byte of memory block, as returned by Mem_VarPoolBlkGet().
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           LIB_MEM_ERR_NONE                        Operation was successful.
+*                           LIB_MEM_ERR_NULL_PTR                    'p_pool' or 'p_blk' pointer passed is NULL.
+*                           LIB_MEM_ERR_INVALID_BLK_ADDR            Block not in pool.
+*                           LIB_MEM_ERR_INVALID_BLK_ADDR_IN_POOL    Block already free.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_VAR_POOL_EN == DEF_ENABLED)
+void  Mem_VarPoolBlkFree (MEM_VAR_POOL  *p_pool,
+                          void          *p_blk,
+                          LIB_ERR       *p_err)
+{
+    MEM_VAR_POOL_BLK  *p_blk_free;
+    MEM_VAR_POOL_BLK  *p_blk_phys;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(;);
+    }
+
+    if (p_pool == DEF_NULL) {                                   /* Chk for NULL pool data ptr.                          */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+
+    if (p_blk == DEF_NULL) {
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+
+    if (((CPU_INT08U *)p_blk <  (CPU_INT08U *)p_pool->PoolAddrStart) ||
+        ((CPU_INT08U *)p_blk >= (CPU_INT08U *)p_pool->PoolAddrEnd)   ||
+        (((CPU_ADDR)p_blk & (MEM_VAR_POOL_ALIGN - 1u)) != 0u)) {
+       *p_err = LIB_MEM_ERR_INVALID_BLK_ADDR;
+        return;
+    }
+#endif
+
+    p_blk_free = (MEM_VAR_POOL_BLK *)((CPU_INT08U *)p_blk - MEM_VAR_POOL_BLK_HDR_SIZE);
+
+    CPU_CRITICAL_ENTER();
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (DEF_BIT_IS_SET(p_blk_free->Size, MEM_VAR_POOL_BLK_FLAG_FREE) == DEF_YES) {
+        CPU_CRITICAL_EXIT();
+       *p_err = LIB_MEM_ERR_INVALID_BLK_ADDR_IN_POOL;
+        return;
+    }
+#endif
+
+    p_pool->SizeUsed -= MEM_VAR_POOL_BLK_SIZE(p_blk_free) + MEM_VAR_POOL_BLK_OVERHEAD;
+    p_pool->BlkAllocCnt--;
+
+                                                                /* ---------------- MERGE ADJACENT BLKS --------------- */
+    if (DEF_BIT_IS_SET(p_blk_free->Size, MEM_VAR_POOL_BLK_FLAG_PREV_FREE) == DEF_YES) {
+        p_blk_phys = p_blk_free->PrevPhysPtr;                   /* Merge with prev phys blk.                            */
+        Mem_VarPoolBlkRemove(p_pool, p_blk_phys);
+        p_blk_phys->Size += MEM_VAR_POOL_BLK_SIZE(p_blk_free) + MEM_VAR_POOL_BLK_OVERHEAD;
+        p_blk_free        = p_blk_phys;
+    }
+
+    p_blk_phys = MEM_VAR_POOL_BLK_NEXT(p_blk_free);
+    if (DEF_BIT_IS_SET(p_blk_phys->Size, MEM_VAR_POOL_BLK_FLAG_FREE) == DEF_YES) {
+        Mem_VarPoolBlkRemove(p_pool, p_blk_phys);               /* Merge with next phys blk.                            */
+        p_blk_free->Size += MEM_VAR_POOL_BLK_SIZE(p_blk_phys) + MEM_VAR_POOL_BLK_OVERHEAD;
+        p_blk_phys        = MEM_VAR_POOL_BLK_NEXT(p_blk_free);
+    }
+
+    DEF_BIT_SET(p_blk_free->Size, MEM_VAR_POOL_BLK_FLAG_FREE);
+    DEF_BIT_SET(p_blk_phys->Size, MEM_VAR_POOL_BLK_FLAG_PREV_FREE);
+    p_blk_phys->PrevPhysPtr = p_blk_free;
+
+    Mem_VarPoolBlkInsert(p_pool, p_blk_free);
+    CPU_CRITICAL_EXIT();
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       Mem_VarPoolRemSizeGet()
+*
+* Description : Gets free size & usage statistics of a variable-size memory pool.
+*
+* Argument(s) : p_pool  Pointer to pool data.
+*
+*               p_info  Pointer to structure that will receive further pool usage info. Can be DEF_NULL.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           LIB_MEM_ERR_NONE                Operation was successful.
+*                           LIB_MEM_ERR_NULL_PTR            'p_pool' pointer passed is NULL.
+*
+* Return(s)   : Free size of pool, in bytes, including block headers. This is the sum of the free blocks,
+*               the largest block that can be allocated may be smaller.
+*
+* Caller(s)   : Application,
+*               Mem_OutputUsage().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_VAR_POOL_EN == DEF_ENABLED)
+CPU_SIZE_T  Mem_VarPoolRemSizeGet (MEM_VAR_POOL       *p_pool,
+                                   MEM_VAR_POOL_INFO  *p_info,
+                                   LIB_ERR            *p_err)
+{
+    CPU_SIZE_T  size_used;
+    CPU_SIZE_T  size_used_max;
+    CPU_SIZE_T  blk_alloc_cnt;
+    CPU_SR_ALLOC();
+
+
+#if (LIB_MEM_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {                                    /* Chk for NULL err ptr.                                */
+        CPU_SW_EXCEPTION(0);
+    }
+
+    if (p_pool == DEF_NULL) {                                   /* Chk for NULL pool data ptr.                          */
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return (0u);
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    size_used     = p_pool->SizeUsed;
+    size_used_max = p_pool->SizeUsedMax;
+    blk_alloc_cnt = p_pool->BlkAllocCnt;
+    CPU_CRITICAL_EXIT();
+
+    if (p_info != DEF_NULL) {
+        p_info->TotalSize   = p_pool->SizeTot;
+        p_info->UsedSize    = size_used;
+        p_info->UsedSizeMax = size_used_max;
+        p_info->BlkAllocCnt = blk_alloc_cnt;
+    }
+
+   *p_err = LIB_MEM_ERR_NONE;
+
+    return (p_pool->SizeTot - size_used);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                           Mem_OutputUsage()
@@ -2203,7 +2739,7 @@ CPU_SIZE_T  Mem_DynPoolBlkNbrAvailGet (MEM_DYN_POOL  *p_pool,
 void  Mem_OutputUsage(void     (*out_fnct) (CPU_CHAR *),
                       LIB_ERR   *p_err)
 {
-    CPU_CHAR   str[DEF_INT_32U_NBR_DIG_MAX];
+    CPU_CHAR   str[DEF_INT_32U_NBR_DIG_MAX + 1u];
     MEM_SEG   *p_seg;
     CPU_SR_ALLOC();
 
@@ -2283,6 +2819,53 @@ void  Mem_OutputUsage(void     (*out_fnct) (CPU_CHAR *),
             p_alloc = p_alloc->NextPtr;
         }
 
+#if (LIB_MEM_CFG_VAR_POOL_EN == DEF_ENABLED)
+        {
+            MEM_VAR_POOL  *p_var_pool;
+            CPU_SIZE_T     var_pool_rem_size;
+
+
+            p_var_pool = Mem_VarPoolHeadPtr;                    /* Output var-size mem pools alloc'd from seg.          */
+            while (p_var_pool != DEF_NULL) {
+                if (p_var_pool->PoolSegPtr == p_seg) {
+                    var_pool_rem_size = Mem_VarPoolRemSizeGet(p_var_pool, DEF_NULL, p_err);
+                    if (*p_err != LIB_MEM_ERR_NONE) {
+                        CPU_CRITICAL_EXIT();
+                        return;
+                    }
+
+                    out_fnct((CPU_CHAR *)"| -> Pool | ");
+
+                    (void)Str_FmtNbr_Int32U(p_var_pool->SizeTot,
+                                            10u,
+                                            DEF_NBR_BASE_DEC,
+                                            ' ',
+                                            DEF_NO,
+                                            DEF_YES,
+                                           &str[0u]);
+
+                    out_fnct(str);
+                    out_fnct((CPU_CHAR *)" | ");
+
+                    (void)Str_FmtNbr_Int32U(var_pool_rem_size,
+                                            10u,
+                                            DEF_NBR_BASE_DEC,
+                                            ' ',
+                                            DEF_NO,
+                                            DEF_YES,
+                                           &str[0u]);
+
+                    out_fnct(str);
+                    out_fnct((CPU_CHAR *)" | ");
+                    out_fnct((p_var_pool->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_var_pool->NamePtr : (CPU_CHAR *)"Unknown");
+                    out_fnct((CPU_CHAR *)"\r\n");
+                }
+
+                p_var_pool = p_var_pool->NextPtr;
+            }
+        }
+#endif
+
         p_seg = p_seg->NextPtr;
     }
     CPU_CRITICAL_EXIT();
@@ -2850,3 +3433,152 @@ static  CPU_BOOLEAN  Mem_PoolBlkIsValidAddr (MEM_POOL  *p_pool,
     }
 }
 #endif
+
+
+/*
+*********************************************************************************************************
+*                                       Mem_VarPoolMapInsert()
+*
+* Description : Computes the free list indexes of a variable-size memory pool block.
+*
+* Argument(s) : size    Block size, in bytes.
+*
+*               p_sl    Pointer to variable that will receive the second level index.
+*
+* Return(s)   : First level index.
+*
+* Caller(s)   : Mem_VarPoolCreate(),
+*               Mem_VarPoolBlkGet(),
+*               Mem_VarPoolBlkInsert(),
+*               Mem_VarPoolBlkRemove().
+*
+* Note(s)     : (1) See 'LOCAL DEFINES  Note #1'.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_VAR_POOL_EN == DEF_ENABLED)
+static  CPU_SIZE_T  Mem_VarPoolMapInsert (CPU_SIZE_T   size,
+                                          CPU_SIZE_T  *p_sl)
+{
+    CPU_SIZE_T  fl;
+
+
+    if (size < MEM_VAR_POOL_SIZE_SMALL) {                       /* Small sizes are mapped linearly in first lvl 0.      */
+        fl    = 0u;
+       *p_sl  = size / (MEM_VAR_POOL_SIZE_SMALL / MEM_VAR_POOL_SL_NBR);
+    } else {
+        fl    = MEM_VAR_POOL_FLS(size);
+       *p_sl  = (size >> (fl - MEM_VAR_POOL_SL_NBR_LOG2)) ^ MEM_VAR_POOL_SL_NBR;
+        fl   -= (MEM_VAR_POOL_FL_SHIFT - 1u);
+    }
+
+    return (fl);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       Mem_VarPoolBlkInsert()
+*
+* Description : Inserts a free block at the head of its variable-size memory pool free list.
+*
+* Argument(s) : p_pool  Pointer to pool data.
+*               ------  Argument validated by caller.
+*
+*               p_blk   Pointer to block header.
+*               -----   Argument validated by caller.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_VarPoolCreate(),
+*               Mem_VarPoolBlkGet(),
+*               Mem_VarPoolBlkFree().
+*
+* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION, once the pool is in use.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_VAR_POOL_EN == DEF_ENABLED)
+static  void  Mem_VarPoolBlkInsert (MEM_VAR_POOL  *p_pool,
+                                    void          *p_blk)
+{
+    MEM_VAR_POOL_BLK  *p_blk_free;
+    MEM_VAR_POOL_BLK  *p_blk_head;
+    CPU_SIZE_T         fl;
+    CPU_SIZE_T         sl;
+    CPU_SIZE_T         ix;
+
+
+    p_blk_free = (MEM_VAR_POOL_BLK *)p_blk;
+    fl         =  Mem_VarPoolMapInsert(MEM_VAR_POOL_BLK_SIZE(p_blk_free), &sl);
+    ix         = (fl * MEM_VAR_POOL_SL_NBR) + sl;
+    p_blk_head = (MEM_VAR_POOL_BLK *)p_pool->BlkFreeTbl[ix];
+
+    p_blk_free->NextFreePtr = p_blk_head;
+    p_blk_free->PrevFreePtr = DEF_NULL;
+    if (p_blk_head != DEF_NULL) {
+        p_blk_head->PrevFreePtr = p_blk_free;
+    }
+    p_pool->BlkFreeTbl[ix] = p_blk_free;
+
+    DEF_BIT_SET(p_pool->FL_Bitmap,        (CPU_DATA)DEF_BIT(fl));
+    DEF_BIT_SET(p_pool->SL_BitmapTbl[fl], (CPU_DATA)DEF_BIT(sl));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       Mem_VarPoolBlkRemove()
+*
+* Description : Removes a free block from its variable-size memory pool free list.
+*
+* Argument(s) : p_pool  Pointer to pool data.
+*               ------  Argument validated by caller.
+*
+*               p_blk   Pointer to block header.
+*               -----   Argument validated by caller.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Mem_VarPoolBlkGet(),
+*               Mem_VarPoolBlkFree().
+*
+* Note(s)     : (1) This function MUST be called within a CRITICAL_SECTION.
+*
+*               (2) The block size MUST NOT have changed since the block was inserted.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_VAR_POOL_EN == DEF_ENABLED)
+static  void  Mem_VarPoolBlkRemove (MEM_VAR_POOL  *p_pool,
+                                    void          *p_blk)
+{
+    MEM_VAR_POOL_BLK  *p_blk_free;
+    CPU_SIZE_T         fl;
+    CPU_SIZE_T         sl;
+    CPU_SIZE_T         ix;
+
+
+    p_blk_free = (MEM_VAR_POOL_BLK *)p_blk;
+    fl         =  Mem_VarPoolMapInsert(MEM_VAR_POOL_BLK_SIZE(p_blk_free), &sl);
+    ix         = (fl * MEM_VAR_POOL_SL_NBR) + sl;
+
+    if (p_blk_free->NextFreePtr != DEF_NULL) {
+        p_blk_free->NextFreePtr->PrevFreePtr = p_blk_free->PrevFreePtr;
+    }
+
+    if (p_blk_free->PrevFreePtr != DEF_NULL) {
+        p_blk_free->PrevFreePtr->NextFreePtr = p_blk_free->NextFreePtr;
+    } else {                                                    /* Blk is list head.                                    */
+        p_pool->BlkFreeTbl[ix] = p_blk_free->NextFreePtr;
+        if (p_blk_free->NextFreePtr == DEF_NULL) {              /* Clr bitmaps if list is now empty.                    */
+            DEF_BIT_CLR(p_pool->SL_BitmapTbl[fl], (CPU_DATA)DEF_BIT(sl));
+            if (p_pool->SL_BitmapTbl[fl] == 0u) {
+                DEF_BIT_CLR(p_pool->FL_Bitmap, (CPU_DATA)DEF_BIT(fl));
+            }
+        }
+    }
+}
+#endif
@@ -173,6 +173,10 @@
 *
 * Note(s) : (1) Configure LIB_MEM_CFG_OPTIMIZE_ASM_EN to enable/disable assembly-optimized memory
 *               functions.
+*
+*               (a) Mem_Clr(), Mem_Set(), Mem_Copy() & Mem_Cmp() are then provided by the port file
+*                   '\<Custom Library Directory>\Ports\<cpu>\<compiler>\lib_mem_a.*', which MUST be
+*                   built with the project.
 *********************************************************************************************************
 */
 
@@ -212,6 +216,20 @@
 #endif
 
 
+/*
+*********************************************************************************************************
+*                             VARIABLE-SIZE MEMORY POOL CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_MEM_CFG_VAR_POOL_EN to enable/disable the variable-size memory pool functions
+*               (see 'VARIABLE-SIZE MEMORY POOL DATA TYPE').
+*********************************************************************************************************
+*/
+
+#ifndef  LIB_MEM_CFG_VAR_POOL_EN
+#define  LIB_MEM_CFG_VAR_POOL_EN         DEF_DISABLED
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                             DATA TYPES
@@ -371,6 +389,67 @@ typedef  struct  mem_dyn_pool {                                 /* -------------
 } MEM_DYN_POOL;
 
 
+/*
+*********************************************************************************************************
+*                                 VARIABLE-SIZE MEMORY POOL DATA TYPE
+*
+* Note(s) : (1) Variable-size memory pools are Two-Level Segregated Fit (TLSF) allocators built over a
+*               single region taken from a memory segment. Blocks of any size can be allocated & freed in
+*               any order, both in constant time :
+*
+*               (a) Free blocks are kept in segregated free lists. The first level splits sizes in powers
+*                   of 2 & the second level splits each power of 2 in 16 linear ranges. A bitmap of the
+*                   non-empty lists at each level allows finding a suitable free block with two
+*                   count-leading/trailing-zeros operations, without searching the lists.
+*
+*               (b) Each block is preceded by a one-word header holding its size. Physically adjacent
+*                   free blocks are merged as soon as a block is freed, which bounds fragmentation.
+*
+*                   /------------------------------------------------------------------------\
+*                   |Hdr| Blk in use  |Hdr|   Free blk (NextFreePtr, PrevFreePtr)   |Hdr| ... |Hdr|
+*                   \------------------------------------------------------------------------/
+*                     ^                 ^                                                    ^
+*                     |                 |                                                    |
+*                   First blk           Linked in list [fl][sl] matching its size      Sentinel (size 0)
+*
+*           (2) The free list tables are sized from the pool size & allocated from the memory segment
+*               along with the pool region, at pool creation.
+*********************************************************************************************************
+*/
+
+#if (LIB_MEM_CFG_VAR_POOL_EN == DEF_ENABLED)
+typedef  struct  mem_var_pool  MEM_VAR_POOL;
+
+struct  mem_var_pool {                                          /* -------------- VAR-SIZE MEM POOL DATA -------------- */
+           MEM_SEG        *PoolSegPtr;                          /* Mem seg from which pool region is alloc'd.           */
+           void           *PoolAddrStart;                       /* Ptr to start of pool region.                         */
+           void           *PoolAddrEnd;                         /* Ptr to end   of pool region (sentinel blk).          */
+
+           CPU_DATA        FL_Bitmap;                           /* Bitmap of non-empty first  lvl free lists.           */
+           CPU_DATA       *SL_BitmapTbl;                        /* Tbl of bitmaps of non-empty second lvl free lists.   */
+           void          **BlkFreeTbl;                          /* Tbl of free lists heads, [FL_Nbr][16].               */
+           CPU_SIZE_T      FL_Nbr;                              /* Nbr of first lvl free lists.                         */
+
+           CPU_SIZE_T      SizeTot;                             /* Tot size avail for blks, incl hdrs, in octets.       */
+           CPU_SIZE_T      SizeUsed;                            /* Size used by alloc'd blks, incl hdrs, in octets.     */
+           CPU_SIZE_T      SizeUsedMax;                         /* Peak used size, in octets.                           */
+           CPU_SIZE_T      BlkAllocCnt;                         /* Cnt of alloc'd blks.                                 */
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    const  CPU_CHAR       *NamePtr;                             /* Ptr to mem pool name.                                */
+           MEM_VAR_POOL   *NextPtr;                             /* Ptr to next var-size mem pool.                       */
+#endif
+};
+
+typedef  struct  mem_var_pool_info {                            /* -------------- VAR-SIZE MEM POOL INFO -------------- */
+    CPU_SIZE_T  TotalSize;                                      /* Tot size avail for blks, incl hdrs, in octets.       */
+    CPU_SIZE_T  UsedSize;                                       /* Size used by alloc'd blks, incl hdrs, in octets.     */
+    CPU_SIZE_T  UsedSizeMax;                                    /* Peak used size, in octets.                           */
+    CPU_SIZE_T  BlkAllocCnt;                                    /* Cnt of alloc'd blks.                                 */
+} MEM_VAR_POOL_INFO;
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          GLOBAL VARIABLES
@@ -1327,6 +1406,27 @@ void               Mem_DynPoolBlkFree       (       MEM_DYN_POOL      *p_pool,
 CPU_SIZE_T         Mem_DynPoolBlkNbrAvailGet(       MEM_DYN_POOL      *p_pool,
                                                     LIB_ERR           *p_err);
 
+                                                                /* ----------- VARIABLE-SIZE MEM POOL FNCTS ----------- */
+#if (LIB_MEM_CFG_VAR_POOL_EN == DEF_ENABLED)
+void               Mem_VarPoolCreate        (const  CPU_CHAR          *p_name,
+                                                    MEM_VAR_POOL      *p_pool,
+                                                    MEM_SEG           *p_seg,
+                                                    CPU_SIZE_T         pool_size,
+                                                    LIB_ERR           *p_err);
+
+void              *Mem_VarPoolBlkGet        (       MEM_VAR_POOL      *p_pool,
+                                                    CPU_SIZE_T         size,
+                                                    LIB_ERR           *p_err);
+
+void               Mem_VarPoolBlkFree       (       MEM_VAR_POOL      *p_pool,
+                                                    void              *p_blk,
+                                                    LIB_ERR           *p_err);
+
+CPU_SIZE_T         Mem_VarPoolRemSizeGet    (       MEM_VAR_POOL      *p_pool,
+                                                    MEM_VAR_POOL_INFO *p_info,
+                                                    LIB_ERR           *p_err);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -1388,6 +1488,14 @@ CPU_SIZE_T         Mem_DynPoolBlkNbrAvailGet(       MEM_DYN_POOL      *p_pool,
 #endif
 
 
+#if    ((LIB_MEM_CFG_VAR_POOL_EN != DEF_DISABLED) && \
+        (LIB_MEM_CFG_VAR_POOL_EN != DEF_ENABLED ))
+#error  "LIB_MEM_CFG_VAR_POOL_EN      illegally #define'd in 'lib_cfg.h'"
+#error  "                             [MUST be  DEF_DISABLED]           "
+#error  "                             [     ||  DEF_ENABLED ]           "
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                    LIBRARY CONFIGURATION ERRORS
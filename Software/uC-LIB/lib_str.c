@@ -71,6 +71,8 @@
 #define    MICRIUM_SOURCE
 #define    LIB_STR_MODULE
 #include  <lib_str.h>
+#include  <lib_mem.h>
+#include  <stdarg.h>                                            /* Only for Str_FmtLite()'s va_list.                    */
 
 
 /*
@@ -79,6 +81,54 @@
 *********************************************************************************************************
 */
 
+#define  STR_FMT_NBR_BUF_LEN                              22u   /* Largest Str_FmtFixPt_Int32S() str + NUL.             */
+
+
+/*
+*********************************************************************************************************
+*                                       WORD-AT-A-TIME DEFINES
+*
+* Note(s) : (1) (a) STR_WORD_HAS_NUL() is non-zero if any octet of a word is zero :
+*
+*                       (word - 0x0101...01) & ~word & 0x8080...80
+*
+*                   Subtracting 1 from an octet sets its sign bit if the octet was 0x00 or greater than
+*                   0x80; '& ~word' discards the latter.  A borrow from a zero octet may only set sign
+*                   bits of more-significant octets, so the test is exact as to whether the word has
+*                   a zero octet but NOT as to which one; the octets are then re-checked one at a time.
+*
+*                   (b) A word XOR'd with STR_WORD_FROM_CHAR(c) has a zero octet where the word has 'c'.
+*
+*               (2) Words are read from addresses aligned to sizeof(CPU_ALIGN) only & so never cross a
+*                   word boundary (see also 'lib_str.h  STRING WORD-AT-A-TIME CONFIGURATION  Note #1b').
+*
+*               (3) Reading a CPU_CHAR array through a CPU_ALIGN lvalue breaks the C strict aliasing
+*                   rules.  STR_WORD_RD() reads through a type declared 'may_alias' with compilers that
+*                   support it (GCC & clang-based, e.g. TI Arm Clang), & copies the word with Mem_Copy()
+*                   otherwise.
+*********************************************************************************************************
+*/
+
+#define  STR_WORD_SIZE                          (sizeof(CPU_ALIGN))
+#define  STR_WORD_ALIGN_MSK                     (STR_WORD_SIZE - 1u)
+#define  STR_WORD_ONES                          ((CPU_ALIGN)DEF_INT_CPU_U_MAX_VAL / (CPU_ALIGN)DEF_OCTET_MASK)
+#define  STR_WORD_HIGHS                         (STR_WORD_ONES * (CPU_ALIGN)DEF_BIT_07)
+
+#define  STR_WORD_FROM_CHAR(c)                  (STR_WORD_ONES * (CPU_ALIGN)(CPU_INT08U)(c))
+#define  STR_WORD_HAS_NUL(word)                 ((((word) - STR_WORD_ONES) & ~(word)) & STR_WORD_HIGHS)
+
+#define  STR_IS_WORD_ALIGNED(p)                 ((((CPU_ADDR)(p)) & STR_WORD_ALIGN_MSK) == 0u)
+
+#if (defined(__GNUC__) || defined(__clang__))                   /* See Note #3.                                         */
+typedef  CPU_ALIGN  STR_WORD  __attribute__((__may_alias__));
+#define  STR_WORD_RD(word, p)                   ((word) = *(const STR_WORD *)(const void *)(p))
+#else
+#define  STR_WORD_RD(word, p)                   Mem_Copy((void *)&(word), (const void *)(p), STR_WORD_SIZE)
+#endif
+
+#define  STR_SRCH_SHIFT_TBL_SIZE                          32u   /* Str_Str_N() shift tbl size (see Str_Str_N() Note #4).*/
+#define  STR_SRCH_SHIFT_TBL_MSK                 (STR_SRCH_SHIFT_TBL_SIZE - 1u)
+
 
 /*
 *********************************************************************************************************
@@ -140,6 +190,31 @@ static  const  CPU_INT32U  Str_MultOvfThTbl_Int32U[] = {
    (CPU_INT32U)(DEF_INT_32U_MAX_VAL / 36u)          /* 32-bit mult ovf th for base 36.  */
 };
 
+static  const  CPU_INT32U  Str_Pow10Tbl_Int32U[] = {
+             1u,
+            10u,
+           100u,
+          1000u,
+         10000u,
+        100000u,
+       1000000u,
+      10000000u,
+     100000000u,
+    1000000000u
+};
+
+static  const  CPU_CHAR  Str_DecDigPairTbl[] =                  /* Two-dig dec strs "00" to "99".                       */
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
 
 /*
 *********************************************************************************************************
@@ -169,6 +244,21 @@ static  CPU_INT32U   Str_ParseNbr_Int32(const  CPU_CHAR      *pstr,
                                                CPU_BOOLEAN    nbr_signed,
                                                CPU_BOOLEAN   *pnbr_neg);
 
+static  CPU_CHAR    *Str_FmtDec        (       CPU_INT32U     nbr,
+                                               CPU_INT08U     nbr_dig_min,
+                                               CPU_CHAR      *pstr);
+
+static  CPU_CHAR    *Str_FmtHex        (       CPU_INT32U     nbr,
+                                               CPU_BOOLEAN    lower_case,
+                                               CPU_CHAR      *pstr);
+
+static  CPU_SIZE_T   Str_FmtLiteCopy   (       CPU_CHAR      *pstr,
+                                               CPU_SIZE_T     len,
+                                               CPU_SIZE_T     len_max,
+                                        const  CPU_CHAR      *psrc,
+                                               CPU_SIZE_T     len_src,
+                                               CPU_CHAR       fill_char);
+
 
 /*
 *********************************************************************************************************
@@ -272,6 +362,10 @@ CPU_SIZE_T  Str_Len (const  CPU_CHAR  *pstr)
 *
 *                   (c) 'len_max' number of characters searched.
 *                       (1) 'len_max' number of characters does NOT include the terminating NULL character.
+*
+*               (4) If LIB_STR_CFG_WORD_EN is DEF_ENABLED, the string is searched one word at a time
+*                   once its pointer is word-aligned (see 'lib_str.h  STRING WORD-AT-A-TIME
+*                   CONFIGURATION').
 *********************************************************************************************************
 */
 
@@ -280,10 +374,34 @@ CPU_SIZE_T  Str_Len_N (const  CPU_CHAR    *pstr,
 {
     const  CPU_CHAR    *pstr_len;
            CPU_SIZE_T   len;
+#if (LIB_STR_CFG_WORD_EN == DEF_ENABLED)
+           CPU_ALIGN    word;
+#endif
 
 
     pstr_len = pstr;
     len      = 0u;
+
+#if (LIB_STR_CFG_WORD_EN == DEF_ENABLED)                        /* See Note #4.                                         */
+    while ((!STR_IS_WORD_ALIGNED(pstr_len))            &&       /* Calc len of unaligned head ...                       */
+           ( pstr_len != (const CPU_CHAR *)  0 )      &&
+           (*pstr_len != (      CPU_CHAR  )'\0')      &&
+           ( len      <  (      CPU_SIZE_T)len_max)) {
+        pstr_len++;
+        len++;
+    }
+    while (( pstr_len      != (const CPU_CHAR *)0) &&           /* ... & of whole words until a NULL char.              */
+           ((len_max - len) >= STR_WORD_SIZE)       &&
+             STR_IS_WORD_ALIGNED(pstr_len)) {
+        STR_WORD_RD(word, pstr_len);
+        if (STR_WORD_HAS_NUL(word) != 0u) {
+            break;
+        }
+        pstr_len += STR_WORD_SIZE;
+        len      += STR_WORD_SIZE;
+    }
+#endif
+
     while (( pstr_len != (const CPU_CHAR *)  0 ) &&             /* Calc str len until NULL ptr (see Note #3a) ...       */
            (*pstr_len != (      CPU_CHAR  )'\0') &&             /* ... or NULL char found      (see Note #3b) ...       */
            ( len      <  (      CPU_SIZE_T)len_max)) {          /* ... or max nbr chars srch'd (see Note #3c).          */
@@ -851,6 +969,11 @@ CPU_INT16S  Str_Cmp (const  CPU_CHAR  *p1_str,
 *
 *               (4) Since 16-bit signed arithmetic is performed to calculate a non-identical comparison
 *                   return value, 'CPU_CHAR' native data type size MUST be 8-bit.
+*
+*               (5) If LIB_STR_CFG_WORD_EN is DEF_ENABLED & both strings have the same alignment, the
+*                   strings are compared one word at a time once their pointers are word-aligned, until
+*                   a word differs or has a NULL character; the characters of that word are then
+*                   compared one at a time (see 'lib_str.h  STRING WORD-AT-A-TIME CONFIGURATION').
 *********************************************************************************************************
 */
 
@@ -864,6 +987,10 @@ CPU_INT16S  Str_Cmp_N (const  CPU_CHAR    *p1_str,
     const  CPU_CHAR    *p2_str_cmp_next;
            CPU_INT16S   cmp_val;
            CPU_SIZE_T   cmp_len;
+#if (LIB_STR_CFG_WORD_EN == DEF_ENABLED)
+           CPU_ALIGN    word;
+           CPU_ALIGN    word_2;
+#endif
 
 
     if (len_max < 1) {                                          /* If cmp len = 0,        rtn 0       (see Note #3d1A). */
@@ -891,6 +1018,41 @@ CPU_INT16S  Str_Cmp_N (const  CPU_CHAR    *p1_str,
     p2_str_cmp_next++;
     cmp_len         = 0u;
 
+#if (LIB_STR_CFG_WORD_EN == DEF_ENABLED)                        /* See Note #5.                                         */
+    if ((((CPU_ADDR)p1_str ^ (CPU_ADDR)p2_str) & STR_WORD_ALIGN_MSK) == 0u) {
+        while ((!STR_IS_WORD_ALIGNED(p1_str_cmp))         &&    /* Cmp unaligned head ...                               */
+               (*p1_str_cmp      == *p2_str_cmp)            &&
+               (*p1_str_cmp      != (      CPU_CHAR  )'\0') &&
+               ( p1_str_cmp_next != (const CPU_CHAR *)  0 ) &&
+               ( p2_str_cmp_next != (const CPU_CHAR *)  0 ) &&
+               ( cmp_len         <  (      CPU_SIZE_T)len_max)) {
+            p1_str_cmp++;
+            p2_str_cmp++;
+            p1_str_cmp_next++;
+            p2_str_cmp_next++;
+            cmp_len++;
+        }
+                                                                /* ... & whole words, stopping before the last ...      */
+                                                                /* ... word below the NULL addr (see Note #3a2).        */
+        while (((len_max - cmp_len)          >= STR_WORD_SIZE)       &&
+                 STR_IS_WORD_ALIGNED(p1_str_cmp)                          &&
+               ((p1_str_cmp + STR_WORD_SIZE) != (const CPU_CHAR *)0) &&
+               ((p2_str_cmp + STR_WORD_SIZE) != (const CPU_CHAR *)0)) {
+            STR_WORD_RD(word,   p1_str_cmp);
+            STR_WORD_RD(word_2, p2_str_cmp);
+            if ((word != word_2) ||
+                (STR_WORD_HAS_NUL(word) != 0u)) {
+                break;
+            }
+            p1_str_cmp      += STR_WORD_SIZE;
+            p2_str_cmp      += STR_WORD_SIZE;
+            p1_str_cmp_next += STR_WORD_SIZE;
+            p2_str_cmp_next += STR_WORD_SIZE;
+            cmp_len         += STR_WORD_SIZE;
+        }
+    }
+#endif
+
     while ((*p1_str_cmp      == *p2_str_cmp)            &&      /* Cmp strs until non-matching chars (see Note #3c) ... */
            (*p1_str_cmp      != (      CPU_CHAR  )'\0') &&      /* ... or NULL chars                 (see Note #3b) ... */
            ( p1_str_cmp_next != (const CPU_CHAR *)  0 ) &&      /* ... or NULL ptr(s) found          (see Note #3a2).   */
@@ -1151,12 +1313,12 @@ CPU_INT16S  Str_CmpIgnoreCase_N (const  CPU_CHAR    *p1_str,
         if (p2_str == (const CPU_CHAR *)0) {
             return (0);                                         /* If BOTH str ptrs NULL, rtn 0       (see Note #3a1A). */
         }
-        char_2  =  ASCII_ToLower(*p2_str);
+        char_2  =  ASCII_TO_LOWER(*p2_str);
         cmp_val = (CPU_INT16S)((CPU_INT16S)0 - (CPU_INT16S)char_2);
         return (cmp_val);                                       /* If p1_str NULL, rtn neg p2_str val (see Note #3a1B1).*/
     }
     if (p2_str == (const CPU_CHAR *)0) {
-        char_1  =  ASCII_ToLower(*p1_str);
+        char_1  =  ASCII_TO_LOWER(*p1_str);
         cmp_val = (CPU_INT16S)char_1;
         return (cmp_val);                                       /* If p2_str NULL, rtn pos p1_str val (see Note #3a1B2).*/
     }
@@ -1168,8 +1330,8 @@ CPU_INT16S  Str_CmpIgnoreCase_N (const  CPU_CHAR    *p1_str,
     p2_str_cmp_next = p2_str_cmp;
     p1_str_cmp_next++;
     p2_str_cmp_next++;
-    char_1          = ASCII_ToLower(*p1_str_cmp);
-    char_2          = ASCII_ToLower(*p2_str_cmp);
+    char_1          = ASCII_TO_LOWER(*p1_str_cmp);
+    char_2          = ASCII_TO_LOWER(*p2_str_cmp);
     cmp_len         = 0u;
 
     while (( char_1          ==  char_2)                &&      /* Cmp strs until non-matching chars (see Note #3c) ... */
@@ -1182,8 +1344,8 @@ CPU_INT16S  Str_CmpIgnoreCase_N (const  CPU_CHAR    *p1_str,
         p1_str_cmp_next++;
         p2_str_cmp_next++;
         cmp_len++;
-        char_1 = ASCII_ToLower(*p1_str_cmp);
-        char_2 = ASCII_ToLower(*p2_str_cmp);
+        char_1 = ASCII_TO_LOWER(*p1_str_cmp);
+        char_2 = ASCII_TO_LOWER(*p2_str_cmp);
     }
 
 
@@ -1203,12 +1365,12 @@ CPU_INT16S  Str_CmpIgnoreCase_N (const  CPU_CHAR    *p1_str,
             if (p2_str_cmp_next == (const CPU_CHAR *)0) {       /* If BOTH next str ptrs NULL, ...                      */
                 cmp_val = (CPU_INT16S)0;                        /* ... rtn 0                       (see Note #3a2A).    */
             } else {                                            /* If p1_str_cmp_next NULL, ...                         */
-                char_2  =  ASCII_ToLower(*p2_str_cmp_next);
+                char_2  =  ASCII_TO_LOWER(*p2_str_cmp_next);
                                                                 /* ... rtn neg p2_str_cmp_next val (see Note #3a2B1).   */
                 cmp_val = (CPU_INT16S)((CPU_INT16S)0 - (CPU_INT16S)char_2);
             }
         } else {                                                /* If p2_str_cmp_next NULL, ...                         */
-            char_1  =  ASCII_ToLower(*p1_str_cmp_next);
+            char_1  =  ASCII_TO_LOWER(*p1_str_cmp_next);
             cmp_val = (CPU_INT16S)char_1;                       /* ... rtn pos p1_str_cmp_next val (see Note #3a2B2).   */
         }
     }
@@ -1347,6 +1509,10 @@ CPU_CHAR  *Str_Char (const  CPU_CHAR  *pstr,
 *                           of characters; NULL pointer returned.
 *                       (2) 'len_max' number of characters MAY include terminating NULL character
 *                           (see Note #2a2).
+*
+*               (4) If LIB_STR_CFG_WORD_EN is DEF_ENABLED, the string is searched one word at a time
+*                   once its pointer is word-aligned, skipping words without a NULL or search character
+*                   (see 'lib_str.h  STRING WORD-AT-A-TIME CONFIGURATION').
 *********************************************************************************************************
 */
 
@@ -1356,6 +1522,10 @@ CPU_CHAR  *Str_Char_N (const  CPU_CHAR    *pstr,
 {
     const  CPU_CHAR    *pstr_char;
            CPU_SIZE_T   len_srch;
+#if (LIB_STR_CFG_WORD_EN == DEF_ENABLED)
+           CPU_ALIGN    word;
+           CPU_ALIGN    word_srch;
+#endif
 
 
     if (pstr == (const CPU_CHAR *)0) {                          /* Rtn NULL if srch str ptr NULL (see Note #3a1).       */
@@ -1370,6 +1540,30 @@ CPU_CHAR  *Str_Char_N (const  CPU_CHAR    *pstr,
     pstr_char = pstr;
     len_srch  = 0u;
 
+#if (LIB_STR_CFG_WORD_EN == DEF_ENABLED)                        /* See Note #4.                                         */
+    while ((!STR_IS_WORD_ALIGNED(pstr_char))           &&       /* Srch unaligned head ...                              */
+           ( pstr_char != (const CPU_CHAR *)  0 )      &&
+           (*pstr_char != (      CPU_CHAR  )'\0')      &&
+           (*pstr_char != (      CPU_CHAR  )srch_char) &&
+           ( len_srch  <  (      CPU_SIZE_T)len_max)) {
+        pstr_char++;
+        len_srch++;
+    }
+
+    word_srch = STR_WORD_FROM_CHAR(srch_char);
+    while (( pstr_char           != (const CPU_CHAR *)0) &&     /* ... & whole words w/o NULL or srch char.             */
+           ((len_max - len_srch) >= STR_WORD_SIZE)       &&
+             STR_IS_WORD_ALIGNED(pstr_char)) {
+        STR_WORD_RD(word, pstr_char);
+        if ((STR_WORD_HAS_NUL(word)             != 0u) ||
+            (STR_WORD_HAS_NUL(word ^ word_srch) != 0u)) {
+            break;
+        }
+        pstr_char += STR_WORD_SIZE;
+        len_srch  += STR_WORD_SIZE;
+    }
+#endif
+
     while (( pstr_char != (const CPU_CHAR *)  0 )      &&       /* Srch str until NULL ptr     [see Note #3b]  ...      */
            (*pstr_char != (      CPU_CHAR  )'\0')      &&       /* ... or NULL char            (see Note #3c)  ...      */
            (*pstr_char != (      CPU_CHAR  )srch_char) &&       /* ... or srch char found      (see Note #3d); ...      */
@@ -1841,11 +2035,24 @@ CPU_CHAR  *Str_Str (const  CPU_CHAR  *pstr,
 *
 *                   (f) Search string found.
 *                       (1) Return pointer to first occurrence of search string in string (see Note #2b1A).
-*                       (2) Search string found via Str_Cmp_N().
+*                       (2) Search string found via a Horspool search (see Note #4).
 *
 *                   (g) 'len_max' number of characters searched.
 *                       (1) 'len_max' number of characters does NOT include terminating NULL character
 *                           (see Note #2a2).
+*
+*               (4) (a) A single-character search string is searched with Str_Char_N().
+*
+*                   (b) Longer search strings are searched with the Boyer-Moore-Horspool algorithm :
+*                       the string character aligned with the last search string character selects
+*                       how far the search string may be shifted without skipping an occurrence, i.e.
+*                       the distance from the last occurrence of that character in the search string
+*                       (excluding its last character) to the search string's end, or the search
+*                       string length if none.
+*
+*                   (c) To limit stack usage, the shift table is indexed by the low 5 bits of the
+*                       characters; characters sharing a table entry share the smallest of their shifts,
+*                       which is still safe.  Shifts are limited to DEF_INT_08U_MAX_VAL.
 *********************************************************************************************************
 */
 
@@ -1858,8 +2065,11 @@ CPU_CHAR  *Str_Str_N (const  CPU_CHAR    *pstr,
            CPU_SIZE_T    len_max_srch;
            CPU_SIZE_T    srch_len;
            CPU_SIZE_T    srch_ix;
-           CPU_BOOLEAN   srch_done;
-           CPU_INT16S    srch_cmp;
+           CPU_SIZE_T    cmp_ix;
+           CPU_SIZE_T    shift;
+           CPU_INT08U    shift_tbl[STR_SRCH_SHIFT_TBL_SIZE];
+           CPU_CHAR      char_last;
+           CPU_CHAR      char_cur;
     const  CPU_CHAR     *pstr_str;
     const  CPU_CHAR     *pstr_srch_ix;
 
@@ -1898,22 +2108,44 @@ CPU_CHAR  *Str_Str_N (const  CPU_CHAR    *pstr,
         return ((CPU_CHAR *)0);
     }
 
-    srch_len  = str_len - str_len_srch;                         /* Calc srch len (see Note #3e2).                       */
-    srch_ix   = 0u;
-
-    do {
-        pstr_srch_ix = (const CPU_CHAR *)(pstr + srch_ix);
-        srch_cmp     =  Str_Cmp_N(pstr_srch_ix, pstr_srch, str_len_srch);
-        srch_done    = (srch_cmp == 0) ? DEF_YES : DEF_NO;
-        srch_ix++;
-    } while ((srch_done == DEF_NO) && (srch_ix <= srch_len));
+    if (str_len_srch == 1u) {                                   /* Srch single char (see Note #4a).                     */
+        pstr_srch_ix = Str_Char_N(pstr, str_len, *pstr_srch);
+        return ((CPU_CHAR *)pstr_srch_ix);
+    }
 
+                                                                /* ------------ BUILD SHIFT TBL (see Note #4) --------- */
+    shift = DEF_MIN(str_len_srch, DEF_INT_08U_MAX_VAL);
+    for (cmp_ix = 0u; cmp_ix < STR_SRCH_SHIFT_TBL_SIZE; cmp_ix++) {
+        shift_tbl[cmp_ix] = (CPU_INT08U)shift;
+    }
+    for (cmp_ix = 0u; cmp_ix < (str_len_srch - 1u); cmp_ix++) {
+        shift = DEF_MIN((str_len_srch - 1u) - cmp_ix, DEF_INT_08U_MAX_VAL);
+        shift_tbl[(CPU_INT08U)pstr_srch[cmp_ix] & STR_SRCH_SHIFT_TBL_MSK] = (CPU_INT08U)shift;
+    }
 
-    if (srch_cmp != 0) {                                        /* Rtn NULL if srch str NOT found (see Note #3e2).      */
-        return ((CPU_CHAR *)0);
+                                                                /* -------------------- SRCH STR ---------------------- */
+    srch_len  = str_len - str_len_srch;                         /* Calc srch len (see Note #3e2).                       */
+    srch_ix   = 0u;
+    char_last = pstr_srch[str_len_srch - 1u];
+
+    while (srch_ix <= srch_len) {
+        pstr_srch_ix = pstr + srch_ix;
+        char_cur     = pstr_srch_ix[str_len_srch - 1u];
+        if (char_cur == char_last) {                            /* If last chars match, ...                             */
+            cmp_ix = 0u;                                        /* ... cmp the others.                                  */
+            while ((cmp_ix < (str_len_srch - 1u)) &&
+                   (pstr_srch_ix[cmp_ix] == pstr_srch[cmp_ix])) {
+                cmp_ix++;
+            }
+            if (cmp_ix == (str_len_srch - 1u)) {
+                return ((CPU_CHAR *)pstr_srch_ix);              /* Rtn ptr to found srch str (see Note #3f1).           */
+            }
+        }
+        srch_ix += shift_tbl[(CPU_INT08U)char_cur & STR_SRCH_SHIFT_TBL_MSK];
     }
 
-    return ((CPU_CHAR *)pstr_srch_ix);                          /* Else rtn ptr to found srch str (see Note #3f1).      */
+
+    return ((CPU_CHAR *)0);                                     /* Rtn NULL if srch str NOT found (see Note #3e2).      */
 }
 
 
@@ -2614,12 +2846,12 @@ CPU_CHAR  *Str_FmtNbr_32 (CPU_FP32      nbr,
     }
 
     if (lead_char != (CPU_CHAR)'\0') {
-        print_char =  ASCII_IsPrint(lead_char);
+        print_char =  ASCII_IS_PRINT(lead_char);
         if (print_char != DEF_YES) {                            /* If lead char non-printable  (see Note #3a1), ...     */
             fmt_invalid = DEF_YES;                              /* ... fmt invalid str         (see Note #6d).          */
 
         } else if (lead_char != '0') {                          /* Chk lead char for non-0 dig.                         */
-            lead_char_dig = ASCII_IsDig(lead_char);
+            lead_char_dig = ASCII_IS_DIG(lead_char);
             if (lead_char_dig == DEF_YES) {                     /* If  lead char     non-0 dig (see Note #3a2A), ...    */
                 fmt_invalid = DEF_YES;                          /* ... fmt invalid str         (see Note #6d).          */
             }
@@ -2780,6 +3012,438 @@ CPU_CHAR  *Str_FmtNbr_32 (CPU_FP32      nbr,
 }
 #endif
 
+/*
+*********************************************************************************************************
+*                                         Str_FmtDec_Int32U()
+*
+* Description : Format 32-bit unsigned integer into a decimal character string, with as many digits as
+*                   needed & no leading characters.
+*
+* Argument(s) : nbr         Number to format.
+*
+*               pstr        Pointer to character array to return formatted number string (see Note #1).
+*
+* Return(s)   : Pointer to the terminating NULL character of the formatted string, if NO error(s)
+*                   (see Note #2).
+*
+*               Pointer to NULL,                                                  otherwise.
+*
+* Caller(s)   : Application,
+*               Str_FmtLite().
+*
+* Note(s)     : (1) (a) Format buffer size NOT validated; buffer overruns MUST be prevented by caller.
+*
+*                   (b) To prevent character buffer overrun :
+*
+*                           Character array size MUST be  >=  (DEF_INT_32U_NBR_DIG_MAX +
+*                                                              1 'NUL' terminator)        characters
+*
+*               (2) The returned pointer allows further fields to be appended to the string without
+*                   searching for its end.
+*
+*               (3) Unlike Str_FmtNbr_Int32U(), digits are formatted two at a time from a table of
+*                   the 100 two-digit decimal strings, halving the number of divisions.
+*********************************************************************************************************
+*/
+
+CPU_CHAR  *Str_FmtDec_Int32U (CPU_INT32U   nbr,
+                              CPU_CHAR    *pstr)
+{
+    CPU_CHAR  *pstr_end;
+
+
+    if (pstr == (CPU_CHAR *)0) {                                /* Rtn NULL if str ptr NULL.                            */
+        return ((CPU_CHAR *)0);
+    }
+
+    pstr_end = Str_FmtDec(nbr, 1u, pstr);
+
+    return (pstr_end);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         Str_FmtDec_Int32S()
+*
+* Description : Format 32-bit signed integer into a decimal character string, with as many digits as
+*                   needed & no leading characters.
+*
+* Argument(s) : nbr         Number to format.
+*
+*               pstr        Pointer to character array to return formatted number string (see Note #1).
+*
+* Return(s)   : Pointer to the terminating NULL character of the formatted string, if NO error(s).
+*
+*               Pointer to NULL,                                                  otherwise.
+*
+* Caller(s)   : Application,
+*               Str_FmtLite().
+*
+* Note(s)     : (1) (a) Format buffer size NOT validated; buffer overruns MUST be prevented by caller.
+*
+*                   (b) To prevent character buffer overrun :
+*
+*                           Character array size MUST be  >=  (1 negative sign           +
+*                                                              DEF_INT_32U_NBR_DIG_MAX +
+*                                                              1 'NUL' terminator)        characters
+*
+*               (2) See also 'Str_FmtDec_Int32U()  Notes #2 & #3'.
+*********************************************************************************************************
+*/
+
+CPU_CHAR  *Str_FmtDec_Int32S (CPU_INT32S   nbr,
+                              CPU_CHAR    *pstr)
+{
+    CPU_CHAR    *pstr_end;
+    CPU_INT32U   nbr_abs;
+
+
+    if (pstr == (CPU_CHAR *)0) {                                /* Rtn NULL if str ptr NULL.                            */
+        return ((CPU_CHAR *)0);
+    }
+
+    if (nbr < 0) {                                              /* If nbr neg, ...                                      */
+       *pstr++  = (CPU_CHAR)'-';                                /* ... fmt neg sign ...                                 */
+        nbr_abs = (CPU_INT32U)0u - (CPU_INT32U)nbr;             /* ... & abs val (DEF_INT_32S_MIN_VAL incl'd).          */
+    } else {
+        nbr_abs = (CPU_INT32U)nbr;
+    }
+
+    pstr_end = Str_FmtDec(nbr_abs, 1u, pstr);
+
+    return (pstr_end);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Str_FmtFixPt_Int32S()
+*
+* Description : Format 32-bit signed fixed-point number into a decimal character string.
+*
+* Argument(s) : nbr             Fixed-point number to format, in Qm.n format (i.e. the real value is
+*                                   'nbr' / 2^'nbr_frac_bits').
+*
+*               nbr_frac_bits   Number of fractional bits ('n') of 'nbr' (see Note #2a) :
+*
+*                                   15      Q15 / Q16.15
+*                                   31      Q31
+*
+*               nbr_dp          Number of decimal point digits to format (see Note #2b).
+*
+*               pstr            Pointer to character array to return formatted number string (see Note #3).
+*
+* Return(s)   : Pointer to the terminating NULL character of the formatted string, if NO error(s).
+*
+*               Pointer to NULL,                                                  otherwise.
+*
+* Caller(s)   : Application,
+*               Str_FmtLite().
+*
+* Note(s)     : (1) The number is formatted with integer operations only, unlike Str_FmtNbr_32() :
+*
+*                   (a) The integer part is the number's absolute value shifted right by 'nbr_frac_bits'.
+*
+*                   (b) The fractional part is scaled by 10^'nbr_dp' in 64 bits & rounded to the
+*                       nearest last digit; a carry out of the fractional digits increments the
+*                       integer part.
+*
+*                           Example :
+*
+*                               nbr           = -11469       (-0.35 in Q15)
+*                               nbr_frac_bits =  15
+*                               nbr_dp        =   3
+*
+*                               pstr          = "-0.350"
+*
+*                   (c) A negative number that rounds to zero is formatted without a negative sign.
+*
+*               (2) (a) 'nbr_frac_bits' MUST be less than or equal to 31.
+*
+*                   (b) 'nbr_dp' MUST be less than or equal to 9.  If 'nbr_dp' is zero, the number is
+*                       rounded to an integer & NO decimal point is formatted.
+*
+*               (3) (a) Format buffer size NOT validated; buffer overruns MUST be prevented by caller.
+*
+*                   (b) To prevent character buffer overrun :
+*
+*                           Character array size MUST be  >=  (1 negative sign           +
+*                                                              DEF_INT_32U_NBR_DIG_MAX +
+*                                                              1 decimal point           +
+*                                                              'nbr_dp'                  +
+*                                                              1 'NUL' terminator)        characters
+*********************************************************************************************************
+*/
+
+CPU_CHAR  *Str_FmtFixPt_Int32S (CPU_INT32S   nbr,
+                                CPU_INT08U   nbr_frac_bits,
+                                CPU_INT08U   nbr_dp,
+                                CPU_CHAR    *pstr)
+{
+    CPU_CHAR    *pstr_end;
+    CPU_INT32U   nbr_abs;
+    CPU_INT32U   nbr_int;
+    CPU_INT32U   nbr_frac;
+    CPU_INT32U   dp_scale;
+    CPU_INT64U   nbr_frac_dec;
+
+
+    if (pstr == (CPU_CHAR *)0) {                                /* Rtn NULL if str ptr NULL.                            */
+        return ((CPU_CHAR *)0);
+    }
+    if ((nbr_frac_bits > 31u) ||                                /* Rtn NULL if invalid fmt (see Note #2).               */
+        (nbr_dp        >  9u)) {
+        return ((CPU_CHAR *)0);
+    }
+
+    if (nbr < 0) {
+        nbr_abs = (CPU_INT32U)0u - (CPU_INT32U)nbr;
+    } else {
+        nbr_abs = (CPU_INT32U)nbr;
+    }
+
+    nbr_int      =   nbr_abs >> nbr_frac_bits;                  /* See Note #1a.                                        */
+    nbr_frac     =   nbr_abs & (((CPU_INT32U)1u << nbr_frac_bits) - 1u);
+    dp_scale     =   Str_Pow10Tbl_Int32U[nbr_dp];
+                                                                /* See Note #1b.                                        */
+    nbr_frac_dec =  (CPU_INT64U)nbr_frac * dp_scale;
+    if (nbr_frac_bits > 0u) {
+        nbr_frac_dec += (CPU_INT64U)1u << (nbr_frac_bits - 1u);
+    }
+    nbr_frac_dec >>= nbr_frac_bits;
+    if (nbr_frac_dec >= dp_scale) {
+        nbr_frac_dec -= dp_scale;
+        nbr_int++;
+    }
+
+    if ((nbr < 0) &&                                            /* See Note #1c.                                        */
+       ((nbr_int      != 0u) ||
+        (nbr_frac_dec != 0u))) {
+       *pstr++ = (CPU_CHAR)'-';
+    }
+
+    pstr_end = Str_FmtDec(nbr_int, 1u, pstr);
+    if (nbr_dp > 0u) {
+       *pstr_end++ = (CPU_CHAR)'.';
+        pstr_end   =  Str_FmtDec((CPU_INT32U)nbr_frac_dec, nbr_dp, pstr_end);
+    }
+
+    return (pstr_end);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            Str_FmtLite()
+*
+* Description : Format a string from a format string & arguments, like a reduced snprintf().
+*
+* Argument(s) : pstr        Pointer to character array to return formatted string.
+*
+*               len_max     Size of the character array, including the terminating NULL character
+*                               (see Note #3).
+*
+*               pfmt        Pointer to format string (see Note #1).
+*
+*               ...         Arguments of the conversion specifications (see Note #2).
+*
+* Return(s)   : Number of characters formatted, NOT including the terminating NULL character.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Conversion specifications are :
+*
+*                       %[-][0][width][.prec]conversion
+*
+*                   where
+*                           '-'         Pad on the right instead of the left.
+*                           '0'         Pad on the left with '0' (after any negative sign).
+*                           width       Minimum number of characters of the conversion.
+*                           prec        Number of decimal point digits of a 'Q' conversion.
+*
+*                   & conversion is one of :
+*
+*                           d, i        CPU_INT32S     in decimal.
+*                           u           CPU_INT32U     in decimal.
+*                           x, X        CPU_INT32U     in hexadecimal, lower / upper case.
+*                           c           CPU_CHAR.
+*                           s           Pointer to a NULL-terminated string.
+*                           Q<n>        CPU_INT32S     Qm.n fixed-point number, e.g. "%.3Q15"
+*                                                          (see Str_FmtFixPt_Int32S()).
+*                           %           A '%' character.
+*
+*                   Length modifiers & floating-point conversions are NOT supported; an unsupported
+*                   conversion character is formatted as is.
+*
+*               (2) Integer arguments are read as 32-bit integers; arguments of other sizes MUST be
+*                   cast.
+*
+*               (3) The formatted string is truncated to ('len_max' - 1) characters &, if 'len_max'
+*                   is NOT zero, is always NULL-terminated.
+*
+*               (4) No heap or floating-point operations are used & the stack usage is bounded, so
+*                   this function may be called from any task with a modest stack.
+*********************************************************************************************************
+*/
+
+CPU_SIZE_T  Str_FmtLite (       CPU_CHAR    *pstr,
+                                CPU_SIZE_T   len_max,
+                         const  CPU_CHAR    *pfmt,
+                                ...)
+{
+    va_list            args;
+    CPU_CHAR           nbr_buf[STR_FMT_NBR_BUF_LEN];
+    const  CPU_CHAR   *psrc;
+    CPU_CHAR          *psrc_end;
+    CPU_SIZE_T         len;
+    CPU_SIZE_T         len_src;
+    CPU_SIZE_T         width;
+    CPU_INT08U         prec;
+    CPU_INT08U         frac_bits;
+    CPU_CHAR           pad_char;
+    CPU_BOOLEAN        pad_right;
+
+
+    if ((pstr    == (CPU_CHAR *)0) ||                           /* Rtn if no str to fmt into.                           */
+        (len_max ==  0u)) {
+        return (0u);
+    }
+    if (pfmt == (const CPU_CHAR *)0) {
+       *pstr = (CPU_CHAR)'\0';
+        return (0u);
+    }
+
+    len = 0u;
+    va_start(args, pfmt);
+
+    while (*pfmt != (CPU_CHAR)'\0') {
+        if (*pfmt != (CPU_CHAR)'%') {                           /* Copy chars up to next conversion spec.               */
+            psrc = pfmt;
+            while ((*pfmt != (CPU_CHAR)'\0') &&
+                   (*pfmt != (CPU_CHAR)'%' )) {
+                pfmt++;
+            }
+            len = Str_FmtLiteCopy(pstr, len, len_max, psrc, (CPU_SIZE_T)(pfmt - psrc), (CPU_CHAR)'\0');
+            continue;
+        }
+        pfmt++;
+                                                                /* ------------- PARSE CONVERSION SPEC ---------------- */
+        pad_right = DEF_NO;
+        pad_char  = (CPU_CHAR)' ';
+        if (*pfmt == (CPU_CHAR)'-') {
+            pad_right = DEF_YES;
+            pfmt++;
+        }
+        if (*pfmt == (CPU_CHAR)'0') {
+            pad_char  = (CPU_CHAR)'0';
+            pfmt++;
+        }
+        width = 0u;
+        while (ASCII_IS_DIG(*pfmt) == DEF_YES) {
+            width = (width * 10u) + (CPU_SIZE_T)(*pfmt - '0');
+            pfmt++;
+        }
+        prec = 0u;
+        if (*pfmt == (CPU_CHAR)'.') {
+            pfmt++;
+            while (ASCII_IS_DIG(*pfmt) == DEF_YES) {
+                prec = (CPU_INT08U)((prec * 10u) + (CPU_INT08U)(*pfmt - '0'));
+                pfmt++;
+            }
+        }
+
+                                                                /* ------------------ FMT CONVERSION ------------------ */
+        psrc     = nbr_buf;
+        psrc_end = nbr_buf;
+        switch (*pfmt) {
+            case 'd':
+            case 'i':
+                 psrc_end = Str_FmtDec_Int32S(va_arg(args, CPU_INT32S), nbr_buf);
+                 break;
+
+
+            case 'u':
+                 psrc_end = Str_FmtDec(va_arg(args, CPU_INT32U), 1u, nbr_buf);
+                 break;
+
+
+            case 'x':
+            case 'X':
+                 psrc_end = Str_FmtHex(va_arg(args, CPU_INT32U), (*pfmt == 'x') ? DEF_YES : DEF_NO, nbr_buf);
+                 break;
+
+
+            case 'c':
+                 nbr_buf[0] = (CPU_CHAR)va_arg(args, CPU_INT32S);
+                 psrc_end   = &nbr_buf[1];
+                 break;
+
+
+            case 's':
+                 psrc = va_arg(args, const CPU_CHAR *);
+                 if (psrc == (const CPU_CHAR *)0) {
+                     psrc = (const CPU_CHAR *)"(null)";
+                 }
+                 psrc_end = (CPU_CHAR *)psrc + Str_Len(psrc);
+                 break;
+
+
+            case 'Q':
+                 frac_bits = 0u;
+                 while (ASCII_IS_DIG(pfmt[1]) == DEF_YES) {     /* Parse nbr of frac bits.                              */
+                     pfmt++;
+                     frac_bits = (CPU_INT08U)((frac_bits * 10u) + (CPU_INT08U)(*pfmt - '0'));
+                 }
+                 psrc_end = Str_FmtFixPt_Int32S(va_arg(args, CPU_INT32S), frac_bits, prec, nbr_buf);
+                 if (psrc_end == (CPU_CHAR *)0) {               /* Fmt nothing for invalid fixed-point fmt.             */
+                     psrc_end = nbr_buf;
+                 }
+                 break;
+
+
+            case '\0':                                          /* Fmt str ends within conversion spec.                 */
+                 pfmt--;
+                 break;
+
+
+            case '%':
+            default:
+                 nbr_buf[0] = *pfmt;
+                 psrc_end   = &nbr_buf[1];
+                 break;
+        }
+        pfmt++;
+
+                                                                /* --------------- PAD & COPY CONVERSION -------------- */
+        len_src = (CPU_SIZE_T)(psrc_end - psrc);
+        if (len_src >= width) {
+            len = Str_FmtLiteCopy(pstr, len, len_max, psrc, len_src, (CPU_CHAR)'\0');
+
+        } else if (pad_right == DEF_YES) {
+            len = Str_FmtLiteCopy(pstr, len, len_max,  psrc,               len_src,         (CPU_CHAR)'\0');
+            len = Str_FmtLiteCopy(pstr, len, len_max, (const CPU_CHAR *)0, width - len_src, (CPU_CHAR)' ');
+
+        } else {
+            if ((pad_char == (CPU_CHAR)'0') &&                  /* Zero pad after neg sign.                             */
+                (*psrc    == (CPU_CHAR)'-')) {
+                len = Str_FmtLiteCopy(pstr, len, len_max, psrc, 1u, (CPU_CHAR)'\0');
+                psrc++;
+                len_src--;
+                width--;
+            }
+            len = Str_FmtLiteCopy(pstr, len, len_max, (const CPU_CHAR *)0, width - len_src,  pad_char);
+            len = Str_FmtLiteCopy(pstr, len, len_max,  psrc,               len_src,         (CPU_CHAR)'\0');
+        }
+    }
+
+    va_end(args);
+
+    pstr[len] = (CPU_CHAR)'\0';                                 /* See Note #3.                                         */
+
+    return (len);
+}
+
 
 /*
 *********************************************************************************************************
@@ -3217,6 +3881,141 @@ CPU_INT32S  Str_ParseNbr_Int32S (const  CPU_CHAR     *pstr,
     return (nbr);
 }
 
+/*
+*********************************************************************************************************
+*                                      Str_ParseNbrList_Int32S()
+*
+* Description : Parse a list of comma-separated 32-bit signed decimal integers from string.
+*
+* Argument(s) : pstr        Pointer to string (see Note #1).
+*
+*               pstr_next   Optional pointer to a variable to return a pointer to the first character
+*                               following the last integer parsed & its trailing spaces (see Note #2c).
+*
+*               pnbr_tbl    Pointer to table to return the parsed integers.
+*
+*               nbr_max     Maximum number of integers to parse (i.e. size of 'pnbr_tbl').
+*
+* Return(s)   : Number of integers parsed into 'pnbr_tbl'.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) String buffer NOT modified.
+*
+*               (2) (a) Each integer is preceded by optional spaces or tabs & an optional sign, & followed
+*                       by optional spaces or tabs.  Integers are separated by a comma.
+*
+*                   (b) Parsing stops :
+*
+*                       (1) At the first character that is neither a comma nor part of an integer,
+*                               e.g. the string's terminating NULL character or a carriage return;
+*                       (2) At a field that is NOT an integer or whose integer overflows 32 bits,
+*                               which is NOT parsed;
+*                       (3) After 'nbr_max' integers.
+*
+*                   (c) 'pstr_next' is returned so that the caller can check that the whole command
+*                       line was parsed or continue parsing the remaining characters.
+*
+*                           Example :
+*
+*                               pstr      = "12, -3400,+5 ,7\r\n"
+*                               nbr_max   = 8
+*
+*                               pnbr_tbl  = { 12, -3400, 5, 7 }
+*                               pstr_next = "\r\n"
+*
+*               (3) Unlike Str_ParseNbr_Int32S(), only base 10 is parsed & each digit costs a single
+*                   comparison; the overflow is only checked once the number is within one digit of
+*                   the maximum.
+*********************************************************************************************************
+*/
+
+CPU_SIZE_T  Str_ParseNbrList_Int32S (const  CPU_CHAR     *pstr,
+                                            CPU_CHAR    **pstr_next,
+                                            CPU_INT32S   *pnbr_tbl,
+                                            CPU_SIZE_T    nbr_max)
+{
+    const  CPU_CHAR     *pstr_parse;
+    const  CPU_CHAR     *pstr_dig;
+           CPU_SIZE_T    nbr_cnt;
+           CPU_INT32U    nbr_abs;
+           CPU_INT32U    nbr_abs_max;
+           CPU_INT08U    dig_val;
+           CPU_BOOLEAN   nbr_neg;
+           CPU_BOOLEAN   nbr_valid;
+
+
+    if (pstr_next != (CPU_CHAR **)0) {
+       *pstr_next  = (CPU_CHAR  *)pstr;                         /* Init rtn str for err (see Note #2c).                 */
+    }
+    if ((pstr     == (const CPU_CHAR *)0) ||                    /* Rtn zero if str or tbl ptr NULL.                     */
+        (pnbr_tbl == (CPU_INT32S     *)0)) {
+        return (0u);
+    }
+
+    pstr_parse = pstr;
+    nbr_cnt    = 0u;
+
+    while (nbr_cnt < nbr_max) {
+        while ((*pstr_parse == ASCII_CHAR_SPACE) ||             /* Skip leading spaces.                                 */
+               (*pstr_parse == ASCII_CHAR_CHARACTER_TABULATION)) {
+            pstr_parse++;
+        }
+
+        nbr_neg = DEF_NO;
+        if (*pstr_parse == '-') {
+            nbr_neg = DEF_YES;
+            pstr_parse++;
+        } else if (*pstr_parse == '+') {
+            pstr_parse++;
+        }
+        nbr_abs_max = (nbr_neg == DEF_YES) ? ((CPU_INT32U)DEF_INT_32S_MAX_VAL + 1u)
+                                           :  (CPU_INT32U)DEF_INT_32S_MAX_VAL;
+
+                                                                /* ------------------ PARSE DIGS ---------------------- */
+        pstr_dig  = pstr_parse;
+        nbr_abs   = 0u;
+        nbr_valid = DEF_YES;
+        dig_val   = (CPU_INT08U)(*pstr_parse - '0');
+        while (dig_val <= 9u) {                                 /* See Note #3.                                         */
+            if (nbr_abs >= (nbr_abs_max / 10u)) {               /* Chk ovf only if next dig may ovf.                    */
+                if ((nbr_abs >  (nbr_abs_max / 10u)) ||
+                   ((nbr_abs == (nbr_abs_max / 10u)) &&
+                    (dig_val >  (CPU_INT08U)(nbr_abs_max % 10u)))) {
+                    nbr_valid = DEF_NO;
+                    break;
+                }
+            }
+            nbr_abs = (nbr_abs * 10u) + dig_val;
+            pstr_parse++;
+            dig_val = (CPU_INT08U)(*pstr_parse - '0');
+        }
+        if ((pstr_parse == pstr_dig) ||                         /* Stop at field NOT an integer (see Note #2b2).        */
+            (nbr_valid  == DEF_NO)) {
+            break;
+        }
+
+        pnbr_tbl[nbr_cnt] = (nbr_neg == DEF_YES) ? (CPU_INT32S)((CPU_INT32U)0u - nbr_abs)
+                                                 : (CPU_INT32S)nbr_abs;
+        nbr_cnt++;
+
+        while ((*pstr_parse == ASCII_CHAR_SPACE) ||             /* Skip trailing spaces.                                */
+               (*pstr_parse == ASCII_CHAR_CHARACTER_TABULATION)) {
+            pstr_parse++;
+        }
+        if (pstr_next != (CPU_CHAR **)0) {
+           *pstr_next  = (CPU_CHAR  *)pstr_parse;
+        }
+
+        if (*pstr_parse != ',') {                               /* Stop at end of list (see Note #2b1).                 */
+            break;
+        }
+        pstr_parse++;
+    }
+
+    return (nbr_cnt);
+}
+
 
 /*
 *********************************************************************************************************
@@ -3489,7 +4288,7 @@ static  CPU_CHAR  *Str_FmtNbr_Int32 (CPU_INT32U    nbr,
     }
 
     if (lead_char != (CPU_CHAR)'\0') {
-        print_char =  ASCII_IsPrint(lead_char);
+        print_char =  ASCII_IS_PRINT(lead_char);
         if (print_char != DEF_YES) {                            /* If lead char non-printable (see Note #3a1), ...      */
             fmt_valid = DEF_NO;                                 /* ... fmt valid str          (see Note #6e).           */
 
@@ -3884,10 +4683,10 @@ static  CPU_INT32U  Str_ParseNbr_Int32 (const  CPU_CHAR      *pstr,
                                                                 /* ------------- IGNORE PRECEDING CHAR(S) ------------- */
     pstr_parse = pstr;                                          /* Save ptr to init'l str for err (see Note #2a2A2).    */
 
-    whitespace = ASCII_IsSpace(*pstr_parse);
+    whitespace = ASCII_IS_SPACE(*pstr_parse);
     while (whitespace == DEF_YES) {                             /* Ignore initial white-space char(s) [see Note #2a1A]. */
         pstr_parse++;
-        whitespace = ASCII_IsSpace(*pstr_parse);
+        whitespace = ASCII_IS_SPACE(*pstr_parse);
     }
 
     switch (*pstr_parse) {
@@ -3923,7 +4722,7 @@ static  CPU_INT32U  Str_ParseNbr_Int32 (const  CPU_CHAR      *pstr,
                       case 'X':
                            nbr_base   = 16u;                    /* ... set nbr base = 16    (see Note #2a1B1a3).        */
                            parse_char = (CPU_CHAR)(*(pstr_parse + 1));
-                           nbr_hex    =  ASCII_IsDigHex(parse_char);
+                           nbr_hex    =  ASCII_IS_DIG_HEX(parse_char);
                            if (nbr_hex == DEF_YES) {            /* If next char is valid hex dig, ...                   */
                                pstr_parse++;                    /* ... adv past '0x' prefix (see Note #2a1B1b2A).       */
                            }
@@ -3955,7 +4754,7 @@ static  CPU_INT32U  Str_ParseNbr_Int32 (const  CPU_CHAR      *pstr,
                       case 'x':
                       case 'X':
                            parse_char = (CPU_CHAR)(*(pstr_parse + 1));
-                           nbr_hex    =  ASCII_IsDigHex(parse_char);
+                           nbr_hex    =  ASCII_IS_DIG_HEX(parse_char);
                            if (nbr_hex == DEF_YES) {            /* If next char is valid hex dig, ...                   */
                                pstr_parse++;                    /* ... adv past '0x' prefix (see Note #2a1B1b2A).       */
                            }
@@ -3981,14 +4780,14 @@ static  CPU_INT32U  Str_ParseNbr_Int32 (const  CPU_CHAR      *pstr,
 
     while (done == DEF_NO) {                                    /* Parse str for desired nbr base digs (see Note #2a2). */
         parse_char = (CPU_CHAR)*pstr_parse;
-        nbr_alpha  =  ASCII_IsAlphaNum(parse_char);
+        nbr_alpha  =  ASCII_IS_ALPHA_NUM(parse_char);
         if (nbr_alpha == DEF_YES) {                             /* If valid alpha num nbr dig avail, ...                */
                                                                 /* ... convert parse char into nbr dig.                 */
-            nbr_dig = ASCII_IsDig(parse_char);
+            nbr_dig = ASCII_IS_DIG(parse_char);
             if (nbr_dig == DEF_YES) {
                 parse_dig = (CPU_INT08U)(parse_char - '0');
             } else {
-                nbr_hex_lower = ASCII_IsLower(parse_char);
+                nbr_hex_lower = ASCII_IS_LOWER(parse_char);
                 if (nbr_hex_lower == DEF_YES) {
                     parse_dig = ((CPU_INT08U)(parse_char - 'a') + 10u);
                 } else {
@@ -4037,3 +4836,184 @@ static  CPU_INT32U  Str_ParseNbr_Int32 (const  CPU_CHAR      *pstr,
     return (nbr);
 }
 
+
+/*
+*********************************************************************************************************
+*                                            Str_FmtDec()
+*
+* Description : Format 32-bit unsigned integer into a decimal character string.
+*
+* Argument(s) : nbr             Number to format.
+*
+*               nbr_dig_min     Minimum number of digits to format, padded with leading '0' digits.
+*
+*               pstr            Pointer to character array to return formatted number string.
+*
+* Return(s)   : Pointer to the terminating NULL character of the formatted string.
+*
+* Caller(s)   : Str_FmtDec_Int32U(),
+*               Str_FmtDec_Int32S(),
+*               Str_FmtFixPt_Int32S(),
+*               Str_FmtLite().
+*
+* Note(s)     : (1) The number of digits is found by comparing with the powers of 10 so that the
+*                   string can be formatted backwards from its last digit, two digits per division by
+*                   100 (see 'Str_DecDigPairTbl').
+*
+*               (2) 'pstr' & 'nbr_dig_min' validated by caller.
+*********************************************************************************************************
+*/
+
+static  CPU_CHAR  *Str_FmtDec (CPU_INT32U   nbr,
+                               CPU_INT08U   nbr_dig_min,
+                               CPU_CHAR    *pstr)
+{
+    CPU_CHAR    *pstr_fmt;
+    CPU_CHAR    *pstr_end;
+    CPU_INT32U   dig_pair_ix;
+    CPU_INT08U   nbr_dig;
+
+
+    nbr_dig = 1u;                                               /* Calc nbr digs (see Note #1).                         */
+    while ((nbr_dig <  DEF_INT_32U_NBR_DIG_MAX) &&
+           (nbr     >= Str_Pow10Tbl_Int32U[nbr_dig])) {
+        nbr_dig++;
+    }
+    if (nbr_dig < nbr_dig_min) {
+        nbr_dig = nbr_dig_min;
+    }
+
+    pstr_end  = pstr + nbr_dig;
+   *pstr_end  = (CPU_CHAR)'\0';
+    pstr_fmt  = pstr_end;
+
+    while (nbr >= 100u) {                                       /* Fmt two digs at a time ...                           */
+        dig_pair_ix  = (nbr % 100u) * 2u;
+        nbr         /=  100u;
+        pstr_fmt    -=  2;
+        pstr_fmt[0]  =  Str_DecDigPairTbl[dig_pair_ix];
+        pstr_fmt[1]  =  Str_DecDigPairTbl[dig_pair_ix + 1u];
+    }
+    if (nbr >= 10u) {                                           /* ... & the last one or two digs.                      */
+        dig_pair_ix  =  nbr * 2u;
+        pstr_fmt    -=  2;
+        pstr_fmt[0]  =  Str_DecDigPairTbl[dig_pair_ix];
+        pstr_fmt[1]  =  Str_DecDigPairTbl[dig_pair_ix + 1u];
+    } else {
+       *--pstr_fmt   = (CPU_CHAR)(nbr + '0');
+    }
+
+    while (pstr_fmt > pstr) {                                   /* Pad with '0' digs to min nbr digs.                   */
+       *--pstr_fmt = (CPU_CHAR)'0';
+    }
+
+    return (pstr_end);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            Str_FmtHex()
+*
+* Description : Format 32-bit unsigned integer into a hexadecimal character string.
+*
+* Argument(s) : nbr             Number to format.
+*
+*               lower_case      Format alphabetic characters in lower case :
+*
+*                                   DEF_NO          Format alphabetic characters in upper case.
+*                                   DEF_YES         Format alphabetic characters in lower case.
+*
+*               pstr            Pointer to character array to return formatted number string.
+*
+* Return(s)   : Pointer to the terminating NULL character of the formatted string.
+*
+* Caller(s)   : Str_FmtLite().
+*
+* Note(s)     : (1) 'pstr' validated by caller.
+*********************************************************************************************************
+*/
+
+static  CPU_CHAR  *Str_FmtHex (CPU_INT32U    nbr,
+                               CPU_BOOLEAN   lower_case,
+                               CPU_CHAR     *pstr)
+{
+    const  CPU_CHAR    *pdig_tbl;
+           CPU_CHAR    *pstr_fmt;
+           CPU_CHAR    *pstr_end;
+           CPU_INT08U   nbr_dig;
+
+
+    pdig_tbl = (lower_case == DEF_YES) ? (const CPU_CHAR *)"0123456789abcdef"
+                                       : (const CPU_CHAR *)"0123456789ABCDEF";
+
+    nbr_dig = 1u;
+    while ((nbr_dig < (DEF_INT_32_NBR_BITS / 4u)) &&
+          ((nbr >> (nbr_dig * 4u)) != 0u)) {
+        nbr_dig++;
+    }
+
+    pstr_end = pstr + nbr_dig;
+   *pstr_end = (CPU_CHAR)'\0';
+    pstr_fmt = pstr_end;
+    while (pstr_fmt > pstr) {
+       *--pstr_fmt   = pdig_tbl[nbr & 0x0Fu];
+        nbr        >>= 4u;
+    }
+
+    return (pstr_end);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          Str_FmtLiteCopy()
+*
+* Description : Append characters to a string being formatted by Str_FmtLite().
+*
+* Argument(s) : pstr        Pointer to character array of the string.
+*
+*               len         Number of characters already formatted.
+*
+*               len_max     Size of the character array, including the terminating NULL character.
+*
+*               psrc        Pointer to characters to append, or NULL to append 'len_src' 'fill_char'.
+*
+*               len_src     Number of characters to append.
+*
+*               fill_char   Character to append if 'psrc' is NULL.
+*
+* Return(s)   : Number of characters formatted, including the appended ones.
+*
+* Caller(s)   : Str_FmtLite().
+*
+* Note(s)     : (1) Characters that do NOT fit before the terminating NULL character are discarded.
+*********************************************************************************************************
+*/
+
+static  CPU_SIZE_T  Str_FmtLiteCopy (       CPU_CHAR    *pstr,
+                                            CPU_SIZE_T   len,
+                                            CPU_SIZE_T   len_max,
+                                     const  CPU_CHAR    *psrc,
+                                            CPU_SIZE_T   len_src,
+                                            CPU_CHAR     fill_char)
+{
+    if (len_src > ((len_max - 1u) - len)) {                     /* Trunc to avail size (see Note #1).                   */
+        len_src = (len_max - 1u) - len;
+    }
+
+    if (psrc != (const CPU_CHAR *)0) {
+        while (len_src > 0u) {
+            pstr[len++] = *psrc++;
+            len_src--;
+        }
+    } else {
+        while (len_src > 0u) {
+            pstr[len++] = fill_char;
+            len_src--;
+        }
+    }
+
+    return (len);
+}
+
@@ -211,6 +211,30 @@
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                 STRING WORD-AT-A-TIME CONFIGURATION
+*
+* Note(s) : (1) Configure LIB_STR_CFG_WORD_EN to enable/disable word-at-a-time string functions :
+*
+*               (a) Str_Len_N(), Str_Char_N() & Str_Cmp_N() (& the functions that call them) read
+*                   aligned CPU words & test all their characters at once for a NULL or search character
+*                   (see 'lib_str.c  LOCAL DEFINES  Note #1').
+*
+*               (b) Aligned word reads may read up to (sizeof(CPU_ALIGN) - 1) octets past the end of
+*                   a string, but never across a word boundary.  This is harmless on CPUs without
+*                   octet-granular memory protection but MAY be reported by memory checking tools.
+*********************************************************************************************************
+*/
+
+                                                                /* Configure word-at-a-time feature (see Note #1) :     */
+#ifndef  LIB_STR_CFG_WORD_EN
+#define  LIB_STR_CFG_WORD_EN                    DEF_DISABLED
+                                                                /*   DEF_DISABLED     Scan strings one char  at a time  */
+                                                                /*   DEF_ENABLED      Scan strings one word  at a time  */
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                               DEFINES
@@ -370,6 +394,22 @@ CPU_CHAR    *Str_FmtNbr_32      (       CPU_FP32       nbr,
                                         CPU_CHAR      *pstr);
 #endif
 
+CPU_CHAR    *Str_FmtDec_Int32U  (       CPU_INT32U     nbr,
+                                        CPU_CHAR      *pstr);
+
+CPU_CHAR    *Str_FmtDec_Int32S  (       CPU_INT32S     nbr,
+                                        CPU_CHAR      *pstr);
+
+CPU_CHAR    *Str_FmtFixPt_Int32S(       CPU_INT32S     nbr,
+                                        CPU_INT08U     nbr_frac_bits,
+                                        CPU_INT08U     nbr_dp,
+                                        CPU_CHAR      *pstr);
+
+CPU_SIZE_T   Str_FmtLite        (       CPU_CHAR      *pstr,
+                                        CPU_SIZE_T     len_max,
+                                 const  CPU_CHAR      *pfmt,
+                                        ...);
+
 
                                                                        /* ----------------- STR PARSE FNCTS ------------------ */
 CPU_INT32U   Str_ParseNbr_Int32U(const  CPU_CHAR      *pstr,
@@ -380,6 +420,11 @@ CPU_INT32S   Str_ParseNbr_Int32S(const  CPU_CHAR      *pstr,
                                         CPU_CHAR     **pstr_next,
                                         CPU_INT08U     nbr_base);
 
+CPU_SIZE_T   Str_ParseNbrList_Int32S(const  CPU_CHAR      *pstr,
+                                            CPU_CHAR     **pstr_next,
+                                            CPU_INT32S    *pnbr_tbl,
+                                            CPU_SIZE_T     nbr_max);
+
 
 /*
 *********************************************************************************************************
@@ -417,6 +462,14 @@ CPU_INT32S   Str_ParseNbr_Int32S(const  CPU_CHAR      *pstr,
 #endif
 
 
+#if    ((LIB_STR_CFG_WORD_EN != DEF_DISABLED) && \
+        (LIB_STR_CFG_WORD_EN != DEF_ENABLED ))
+#error  "LIB_STR_CFG_WORD_EN             illegally #define'd in 'lib_cfg.h'"
+#error  "                                [MUST be  DEF_DISABLED]           "
+#error  "                                [     ||  DEF_ENABLED ]           "
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                             MODULE END
@@ -53,6 +53,7 @@ OS_CPU_ExceptStkBaseAddr:  .word  OS_CPU_ExceptStkBase
     .global  OSCtxSw
     .global  OSIntCtxSw
     .global  OS_CPU_PendSVHandler
+    .global  OS_CPU_AtomicCmpSwap32
 
     .if __TI_VFP_SUPPORT__
     .global  OS_CPU_FP_Reg_Push
@@ -295,4 +296,33 @@ OS_CPU_PendSVHandler:
     BX      LR                                                  ; Exception return will restore remaining context
     .endasmfunc
 
+
+;********************************************************************************************************
+;                                       ATOMIC COMPARE AND SWAP
+;   CPU_BOOLEAN  OS_CPU_AtomicCmpSwap32 (CPU_INT32U  *p_val, CPU_INT32U  val_cmp, CPU_INT32U  val_new)
+;
+; Note(s) : 1) Stores 'val_new' to '*p_val' only if '*p_val' equals 'val_cmp', without disabling interrupts.
+;              Returns 1 if 'val_new' was stored, 0 otherwise.
+;
+;           2) The exclusive monitor is cleared on every exception entry & return, so STREX fails if this
+;              sequence was preempted between LDREX & STREX; the comparison is then redone.
+;********************************************************************************************************
+
+    .asmfunc
+OS_CPU_AtomicCmpSwap32:
+    LDREX   R3, [R0]                                            ; Load current value & claim exclusive access
+    CMP     R3, R1
+    BNE     OS_CPU_AtomicCmpSwap32_Fail                         ; Value changed, no store
+    STREX   R3, R2, [R0]                                        ; Store new value if still exclusive
+    CMP     R3, #0
+    BNE     OS_CPU_AtomicCmpSwap32                              ; Exclusive access lost (see Note #2), retry
+    MOVS    R0, #1
+    BX      LR
+
+OS_CPU_AtomicCmpSwap32_Fail:
+    CLREX                                                       ; Release exclusive access
+    MOVS    R0, #0
+    BX      LR
+    .endasmfunc
+
 .end
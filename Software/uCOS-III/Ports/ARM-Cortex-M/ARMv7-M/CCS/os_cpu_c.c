@@ -78,6 +78,38 @@ extern  "C" {
 #define  CPU_REG_FPCCR_LAZY_STK                        0xC0000000uL
 
 
+/*
+*********************************************************************************************************
+*                                          MPU STACK GUARD DEFINES
+*
+* Note(s) : (1) When OS_CFG_TASK_STK_GUARD_EN is enabled, MPU region OS_CPU_MPU_STK_GUARD_REGION covers the
+*               lowest OS_CPU_STK_GUARD_SIZE-aligned block of the running task's stack as a read-only, never
+*               execute region.  A stack overflow therefore raises a MemManage fault on the offending push
+*               instead of silently corrupting the memory below the stack.
+*
+*           (2) The guard is read-only rather than no-access so that OSTaskStkChk() can still scan the
+*               stack of the running task.
+*
+*           (3) The background region (PRIVDEFENA) keeps the default memory map for everything else.
+*********************************************************************************************************
+*/
+
+#define  OS_CPU_MPU_STK_GUARD_REGION                   7u       /* Highest prio region, overrides any other one.        */
+
+#define  CPU_REG_MPU_CTRL_ENABLE                       0x00000001uL
+#define  CPU_REG_MPU_CTRL_PRIVDEFENA                   0x00000004uL
+
+#define  CPU_REG_MPU_RBAR_VALID                        0x00000010uL
+
+#define  CPU_REG_MPU_RASR_ENABLE                       0x00000001uL
+#define  CPU_REG_MPU_RASR_SIZE_32                      0x00000008uL /* SIZE = 4, 2^(4 + 1) = 32 bytes.                  */
+#define  CPU_REG_MPU_RASR_AP_RO                        0x06000000uL /* AP = 0b110, priv & unpriv read-only.             */
+#define  CPU_REG_MPU_RASR_XN                           0x10000000uL
+
+#define  CPU_REG_SHCSR                 (*((CPU_REG32 *)0xE000ED24uL))   /* System Handler Ctrl & State Reg.            */
+#define  CPU_REG_SHCSR_MEMFAULTENA                     0x00010000uL
+
+
 /*
 *********************************************************************************************************
 *                                           IDLE TASK HOOK
@@ -132,6 +164,16 @@ void  OSInitHook (void)
         }
     }
 #endif
+
+#if (OS_CFG_TASK_STK_GUARD_EN == DEF_ENABLED)
+    CPU_REG_MPU_REG_NBR   = OS_CPU_MPU_STK_GUARD_REGION;        /* Guard region dis'd until the first task switch.      */
+    CPU_REG_MPU_REG_ATTR  = 0u;
+    CPU_REG_SHCSR        |= CPU_REG_SHCSR_MEMFAULTENA;          /* Report overflows as MemManage, not HardFault.        */
+    CPU_REG_MPU_CTRL      = CPU_REG_MPU_CTRL_PRIVDEFENA         /* See 'MPU STACK GUARD DEFINES  Note #3'.              */
+                          | CPU_REG_MPU_CTRL_ENABLE;
+    __asm("    dsb");
+    __asm("    isb");
+#endif
 }
 
 
@@ -549,6 +591,9 @@ void  OSTaskSwHook (void)
 #if (OS_CFG_TASK_STK_REDZONE_EN == DEF_ENABLED)
     CPU_BOOLEAN  stk_status;
 #endif
+#if (OS_CFG_TASK_STK_GUARD_EN == DEF_ENABLED)
+    CPU_ADDR     stk_guard;
+#endif
 
 #if (OS_CPU_ARM_FP_EN > 0u)
     OS_CPU_FP_Reg_Push(OSTCBCurPtr->StkPtr);                    /* Push the FP registers of the current task.           */
@@ -595,6 +640,19 @@ void  OSTaskSwHook (void)
     }
 #endif
 
+#if (OS_CFG_TASK_STK_GUARD_EN == DEF_ENABLED)
+                                                                /* Move MPU guard to the new task's stack.              */
+    stk_guard            = ((CPU_ADDR)OSTCBHighRdyPtr->StkBasePtr + OS_CPU_STK_GUARD_SIZE - 1u)
+                         & ~((CPU_ADDR)OS_CPU_STK_GUARD_SIZE - 1u);
+    CPU_REG_MPU_REG_BASE = stk_guard
+                         | CPU_REG_MPU_RBAR_VALID
+                         | OS_CPU_MPU_STK_GUARD_REGION;
+    CPU_REG_MPU_REG_ATTR = CPU_REG_MPU_RASR_XN
+                         | CPU_REG_MPU_RASR_AP_RO
+                         | CPU_REG_MPU_RASR_SIZE_32
+                         | CPU_REG_MPU_RASR_ENABLE;
+#endif
+
 #if (OS_CPU_ARM_FP_EN > 0u)
     OS_CPU_FP_Reg_Pop(OSTCBHighRdyPtr->StkPtr);                 /* Pop the FP registers of the highest ready task.      */
 #endif
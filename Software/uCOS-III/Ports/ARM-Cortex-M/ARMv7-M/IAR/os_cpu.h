@@ -79,6 +79,12 @@ extern  "C" {                                    /* See Note #1.
 #define  OS_CPU_ARM_FP_EN              0u
 #endif
 
+                                                            /* MPU stack guard size (in bytes), min MPU region size.  */
+#define  OS_CPU_STK_GUARD_SIZE        32u
+
+                                                            /* OS_CPU_AtomicCmpSwap32() is in OS_CPU_A.ASM.           */
+#define  OS_CPU_ATOMIC_CMP_SWAP_ASM_PRESENT
+
 
 /*
 *********************************************************************************************************
@@ -122,6 +128,21 @@ extern  "C" {                                    /* See Note #1.
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                       PRIORITY CONFIGURATION
+*
+* Note(s) : (1) OS_CPU_PendSVHandler() & OSStartHighRdy() copy OSPrioHighRdy to OSPrioCur with byte
+*               accesses (see OS_CPU_A.ASM). OS_PRIO widens to 16 bits when OS_CFG_PRIO_MAX > 255 (see
+*               'os_type.h'), so the port MUST reject such configurations.
+*********************************************************************************************************
+*/
+
+#if (OS_CFG_PRIO_MAX > 255u)                                /* See Note #1.                                           */
+#error  "os_cfg.h, OS_CFG_PRIO_MAX MUST be <= 255 with the ARMv7-M port (8-bit OS_PRIO)"
+#endif
+
+
 /*
 *********************************************************************************************************
 *                              OS TICK INTERRUPT PRIORITY CONFIGURATION
@@ -170,6 +191,10 @@ void  OSCtxSw           (void);
 void  OSIntCtxSw        (void);
 void  OSStartHighRdy    (void);
 
+CPU_BOOLEAN  OS_CPU_AtomicCmpSwap32(CPU_INT32U  *p_val,
+                                    CPU_INT32U   val_cmp,
+                                    CPU_INT32U   val_new);
+
                                                   /* See OS_CPU_C.C                                    */
 void  OS_CPU_SysTickInit    (CPU_INT32U  cnts);
 void  OS_CPU_SysTickInitFreq(CPU_INT32U  cpu_freq);
@@ -132,11 +132,41 @@ extern "C" {
 
 #define  OS_PRIO_TBL_SIZE          (((OS_CFG_PRIO_MAX - 1u) / (DEF_INT_CPU_NBR_BITS)) + 1u)
 
-#define  OS_MSG_EN                 (((OS_CFG_TASK_Q_EN == DEF_ENABLED) || (OS_CFG_Q_EN == DEF_ENABLED)) ? DEF_ENABLED : DEF_DISABLED)
+#define  OS_FLAG_NBR_BITS          (sizeof(OS_FLAGS) * DEF_OCTET_NBR_BITS)
+#define  OS_FLAG_IDX_SLOT_NBR       DEF_INT_CPU_NBR_BITS          /* Waiters indexed per event flag group               */
+#define  OS_FLAG_IDX_SLOT_NONE     ((CPU_INT08U)0xFFu)            /* Task not indexed                                   */
+#define  OS_FLAG_IDX_SLOT_OVF      ((CPU_INT08U)0xFEu)            /* Task pending without a slot (all slots in use)     */
 
-#define  OS_OBJ_TYPE_REQ           (((OS_CFG_DBG_EN == DEF_ENABLED) || (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)) ? \
+#define  OS_PRIO_GRP_EN            (((OS_CFG_PRIO_BITMAP_2L_EN == DEF_ENABLED) && (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)) ? \
                                       DEF_ENABLED : DEF_DISABLED)
 
+#define  OS_MSG_EN                 (((OS_CFG_TASK_Q_EN == DEF_ENABLED) || (OS_CFG_Q_EN == DEF_ENABLED)) ? DEF_ENABLED : DEF_DISABLED)
+
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)                          /* Priorities scheduled by deadline (see os_edf.c)      */
+#define  OS_EDF_PRIO_IN_BAND(prio)  (((prio) >= OS_CFG_SCHED_EDF_PRIO_HI) && ((prio) <= OS_CFG_SCHED_EDF_PRIO_LO))
+#define  OS_EDF_HEAP_IX_NONE       ((CPU_INT08U)0xFFu)            /* Task not in the EDF heap                           */
+#endif
+
+#if (OS_CFG_PEND_MULTI_EN == DEF_ENABLED)                         /* No task waiting, either directly or in OSPendMulti() */
+#define  OS_PEND_LIST_IS_EMPTY(p_pend_list)   (((p_pend_list)->HeadPtr      == (OS_TCB       *)0) && \
+                                               ((p_pend_list)->MultiHeadPtr == (OS_PEND_DATA *)0))
+#else
+#define  OS_PEND_LIST_IS_EMPTY(p_pend_list)    ((p_pend_list)->HeadPtr      == (OS_TCB       *)0)
+#endif
+
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)                             /* Payloads copied in the slots (see OSQCreateSlots())  */
+#define  OS_MSG_Q_IS_INLINE(p_msg_q)  ((p_msg_q)->PoolPtr->DataSize > 0u)
+#endif
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)                  /* Deferred posts keep the timestamp taken in the ISR   */
+#define  OS_POST_TS_GET()         (((OSIntNestingCtr == 0u) && (OSTCBCurPtr == &OSIntQTaskTCB)) ? OSIntQTaskTS : OS_TS_GET())
+#else
+#define  OS_POST_TS_GET()         OS_TS_GET()
+#endif
+
+#define  OS_OBJ_TYPE_REQ           (((OS_CFG_DBG_EN == DEF_ENABLED) || (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED) || \
+                                     (OS_CFG_PEND_MULTI_EN == DEF_ENABLED)) ? DEF_ENABLED : DEF_DISABLED)
+
 
 /*
 ************************************************************************************************************************
@@ -182,7 +212,7 @@ extern "C" {
 #define  OS_TASK_PEND_ON_NOTHING              (OS_STATE)(  0u)  /* Pending on nothing                                 */
 #define  OS_TASK_PEND_ON_FLAG                 (OS_STATE)(  1u)  /* Pending on event flag group                        */
 #define  OS_TASK_PEND_ON_TASK_Q               (OS_STATE)(  2u)  /* Pending on message to be sent to task              */
-#define  OS_TASK_PEND_ON_MULTI                (OS_STATE)(  3u)  /* OBSOLETE TASK STATE                                */
+#define  OS_TASK_PEND_ON_MULTI                (OS_STATE)(  3u)  /* Pending on multiple objects (OSPendMulti())         */
 #define  OS_TASK_PEND_ON_MUTEX                (OS_STATE)(  4u)  /* Pending on mutual exclusion semaphore              */
 #define  OS_TASK_PEND_ON_Q                    (OS_STATE)(  5u)  /* Pending on queue                                   */
 #define  OS_TASK_PEND_ON_SEM                  (OS_STATE)(  6u)  /* Pending on semaphore                               */
@@ -307,6 +337,9 @@ extern "C" {
 #define  OS_OPT_TASK_SAVE_FP                 (OS_OPT)(0x0004u)  /* Save the contents of any floating-point registers  */
 #define  OS_OPT_TASK_NO_TLS                  (OS_OPT)(0x0008u)  /* Specifies the task DOES NOT require TLS support    */
 
+#define  OS_OPT_TASK_BUDGET_DEMOTE           (OS_OPT)(0x0001u)  /* Run at a background priority when out of budget    */
+#define  OS_OPT_TASK_BUDGET_SUSPEND          (OS_OPT)(0x0002u)  /* Suspend the task when out of budget                */
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                     TIME OPTIONS
@@ -364,6 +397,8 @@ extern "C" {
 */
                                                                     /* Dflt prio to init task TCB                     */
 #define  OS_PRIO_INIT                       (OS_PRIO)(OS_CFG_PRIO_MAX)
+                                                                    /* Mutex without a ceiling (priority inheritance) */
+#define  OS_PRIO_CEILING_NONE               (OS_PRIO)(OS_CFG_PRIO_MAX)
 
 /*
 ------------------------------------------------------------------------------------------------------------------------
@@ -449,11 +484,11 @@ typedef  enum  os_err {
     OS_ERR_I                         = 18000u,
     OS_ERR_ILLEGAL_CREATE_RUN_TIME   = 18001u,
 
-    OS_ERR_INT_Q                     = 18002u,                  /* OBSOLETE ERR CODE                                    */
-    OS_ERR_INT_Q_FULL                = 18003u,                  /* OBSOLETE ERR CODE                                    */
-    OS_ERR_INT_Q_SIZE                = 18004u,                  /* OBSOLETE ERR CODE                                    */
-    OS_ERR_INT_Q_STK_INVALID         = 18005u,                  /* OBSOLETE ERR CODE                                    */
-    OS_ERR_INT_Q_STK_SIZE_INVALID    = 18006u,                  /* OBSOLETE ERR CODE                                    */
+    OS_ERR_INT_Q                     = 18002u,
+    OS_ERR_INT_Q_FULL                = 18003u,
+    OS_ERR_INT_Q_SIZE                = 18004u,
+    OS_ERR_INT_Q_STK_INVALID         = 18005u,
+    OS_ERR_INT_Q_STK_SIZE_INVALID    = 18006u,
 
     OS_ERR_ILLEGAL_DEL_RUN_TIME      = 18007u,
 
@@ -484,6 +519,7 @@ typedef  enum  os_err {
     OS_ERR_MUTEX_OWNER               = 22402u,
     OS_ERR_MUTEX_NESTING             = 22403u,
     OS_ERR_MUTEX_OVF                 = 22404u,
+    OS_ERR_MUTEX_CEILING             = 22405u,
 
     OS_ERR_N                         = 23000u,
     OS_ERR_NAME                      = 23001u,
@@ -526,6 +562,9 @@ typedef  enum  os_err {
     OS_ERR_Q_EMPTY                   = 26002u,
     OS_ERR_Q_MAX                     = 26003u,
     OS_ERR_Q_SIZE                    = 26004u,
+    OS_ERR_Q_MSG_SIZE                = 26005u,
+    OS_ERR_Q_INLINE                  = 26006u,
+    OS_ERR_Q_NOT_EMPTY               = 26007u,
 
     OS_ERR_R                         = 27000u,
     OS_ERR_REG_ID_INVALID            = 27001u,
@@ -540,6 +579,7 @@ typedef  enum  os_err {
     OS_ERR_SCHED_UNLOCK_ISR          = 28005u,
 
     OS_ERR_SEM_OVF                   = 28101u,
+    OS_ERR_SEM_CNT_INVALID           = 28103u,
     OS_ERR_SET_ISR                   = 28102u,
 
     OS_ERR_STAT_RESET_ISR            = 28201u,
@@ -577,6 +617,10 @@ typedef  enum  os_err {
     OS_ERR_TASK_SUSPEND_PRIO         = 29022u,
     OS_ERR_TASK_WAITING              = 29023u,
     OS_ERR_TASK_SUSPEND_CTR_OVF      = 29024u,
+    OS_ERR_TASK_PERIOD_INVALID       = 29025u,
+    OS_ERR_TASK_NOT_PERIODIC         = 29026u,
+    OS_ERR_TASK_EDF_FULL             = 29027u,
+    OS_ERR_TASK_BUDGET_INVALID       = 29028u,
 
     OS_ERR_TCB_INVALID               = 29101u,
 
@@ -644,6 +688,8 @@ typedef  enum  os_err {
 
 typedef  struct  os_flag_grp         OS_FLAG_GRP;
 
+typedef  struct  os_int_q            OS_INT_Q;
+
 typedef  struct  os_mem              OS_MEM;
 
 typedef  struct  os_msg              OS_MSG;
@@ -686,6 +732,7 @@ typedef  struct  os_tmr              OS_TMR;
 
 typedef  struct  os_pend_list        OS_PEND_LIST;
 typedef  struct  os_pend_obj         OS_PEND_OBJ;
+typedef  struct  os_pend_data        OS_PEND_DATA;
 
 #if (OS_CFG_APP_HOOKS_EN == DEF_ENABLED)
 typedef  void                      (*OS_APP_HOOK_VOID)(void);
@@ -728,6 +775,13 @@ struct  os_pend_list {
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_OBJ_QTY           NbrEntries;
 #endif
+#if (OS_CFG_PEND_LIST_BUCKET_EN == DEF_ENABLED)
+    CPU_DATA             PrioTbl[OS_PRIO_TBL_SIZE];         /* Bitmap of the priorities present in the list           */
+    OS_TCB              *PrioTailPtr[OS_CFG_PRIO_MAX];      /* Last task of each priority present in the list         */
+#endif
+#if (OS_CFG_PEND_MULTI_EN == DEF_ENABLED)
+    OS_PEND_DATA        *MultiHeadPtr;                      /* Tasks waiting in OSPendMulti(), in priority order      */
+#endif
 };
 
 
@@ -762,6 +816,39 @@ struct  os_pend_obj {
 };
 
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                      PEND DATA
+*
+* Note(s) : (1) An array of 'os_pend_data' entries is passed to OSPendMulti(), one entry per object to wait on.  The
+*               caller fills in .PendObjPtr (and .FlagsPend/.FlagsOpt for event flag groups); the kernel fills in the
+*               'Rdy' members of the entries that made the task ready-to-run.
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_PEND_MULTI_EN == DEF_ENABLED)
+struct  os_pend_data {
+    OS_PEND_DATA        *PrevPtr;                           /* Links in the object's OSPendMulti() waiter list        */
+    OS_PEND_DATA        *NextPtr;
+    OS_TCB              *TCBPtr;                            /* Task waiting                                           */
+    OS_PEND_OBJ         *PendObjPtr;                        /* Object to wait on (OS_SEM, OS_Q or OS_FLAG_GRP)        */
+#if (OS_CFG_FLAG_EN == DEF_ENABLED)
+    OS_FLAGS             FlagsPend;                         /* Event flag(s) to wait on                               */
+    OS_OPT               FlagsOpt;                          /* OS_OPT_PEND_FLAG_xxx [+ OS_OPT_PEND_FLAG_CONSUME]      */
+    OS_FLAGS             RdyFlags;                          /* Event flags that made the entry ready                  */
+#endif
+    OS_PEND_OBJ         *RdyObjPtr;                         /* == .PendObjPtr if the object was posted/deleted/aborted*/
+#if (OS_MSG_EN == DEF_ENABLED)
+    void                *RdyMsgPtr;                         /* Message received from an OS_Q                          */
+    OS_MSG_SIZE          RdyMsgSize;
+#endif
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    CPU_TS               RdyTS;                             /* Timestamp of the post                                  */
+#endif
+};
+#endif
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                     EVENT FLAGS
@@ -786,16 +873,45 @@ struct  os_flag_grp {                                       /* Event Flag Group
     CPU_CHAR            *DbgNamePtr;
 #endif
                                                             /* ------------------ SPECIFIC MEMBERS ------------------ */
-    OS_FLAGS             Flags;                             /* 8, 16 or 32 bit flags                                  */
+    OS_FLAGS             Flags;                             /* 8, 16, 32 or 64 bit flags                              */
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     CPU_TS               TS;                                /* Timestamp of when last post occurred                   */
 #endif
 #if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN == DEF_ENABLED))
     CPU_INT16U           FlagID;                            /* Unique ID for third-party debuggers and tracers.       */
 #endif
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    CPU_DATA             IdxTbl[OS_FLAG_NBR_BITS];          /* Per flag bit, slots of the waiters on that bit         */
+    OS_TCB              *IdxTCBTbl[OS_FLAG_IDX_SLOT_NBR];   /* Waiter in each slot                                    */
+    CPU_DATA             IdxUsed;                           /* Slots in use (slot 0 is the MSB)                       */
+    OS_OBJ_QTY           IdxOvfCtr;                         /* Nbr of waiters that did not get a slot                 */
+#endif
 };
 
 
+/*
+------------------------------------------------------------------------------------------------------------------------
+*                                                    ISR POST QUEUE
+*
+* Note(s) : Posts made from ISRs when OS_CFG_ISR_POST_DEFERRED_EN is enabled (see os_int.c).
+------------------------------------------------------------------------------------------------------------------------
+*/
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+struct  os_int_q {                                          /* Deferred ISR post                                      */
+    OS_OBJ_TYPE          Type;                              /* Type of object posted to                               */
+    void                *ObjPtr;                            /* Pointer to object (or OS_TCB) posted to                */
+    void                *MsgPtr;                            /* Message posted (queues)                                */
+    OS_MSG_SIZE          MsgSize;                           /* Size of the message posted (queues)                    */
+    OS_FLAGS             Flags;                             /* Flags posted (event flag groups)                       */
+    OS_OPT               Opt;                               /* Post option                                            */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    CPU_TS               TS;                                /* Timestamp taken in the ISR                             */
+#endif
+};
+#endif
+
+
 /*
 ------------------------------------------------------------------------------------------------------------------------
 *                                                   MEMORY PARTITIONS
@@ -811,11 +927,22 @@ struct os_mem {                                             /* MEMORY CONTROL BL
     CPU_CHAR            *NamePtr;
 #endif
     void                *AddrPtr;                           /* Pointer to beginning of memory partition               */
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED)
+    CPU_INT32U           FreeListHead;                      /* Index+1 of first free block and ABA tag (see os_mem.c) */
+#else
     void                *FreeListPtr;                       /* Pointer to list of free memory blocks                  */
+#endif
     OS_MEM_SIZE          BlkSize;                           /* Size (in bytes) of each block of memory                */
     OS_MEM_QTY           NbrMax;                            /* Total number of blocks in this partition               */
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED)
+    CPU_INT32U           NbrFree;                           /* Number of memory blocks remaining in this partition    */
+#else
     OS_MEM_QTY           NbrFree;                           /* Number of memory blocks remaining in this partition    */
+#endif
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
+    CPU_INT32U           NbrUsedMax;                        /* Peak number of memory blocks used                      */
+    CPU_INT32U           NbrGetFail;                        /* Number of OSMemGet() calls that found no free block    */
+    OS_TCB             **OwnerTblPtr;                       /* Owner task of each block, see OSMemOwnerTblSet()       */
     OS_MEM              *DbgPrevPtr;
     OS_MEM              *DbgNextPtr;
 #endif
@@ -850,6 +977,11 @@ struct  os_msg_pool {                                       /* OS_MSG POOL
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_MSG_QTY           NbrUsedMax;                        /* Peak number of messages used                           */
 #endif
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+    OS_MSG              *BasePtr;                           /* First OS_MSG of the pool                               */
+    CPU_INT08U          *DataPtr;                           /* Inline payloads (one per OS_MSG) or NULL               */
+    OS_MSG_SIZE          DataSize;                          /* Size of each inline payload (0 if none)                */
+#endif
 };
 
 
@@ -862,6 +994,9 @@ struct  os_msg_q {                                          /* OS_MSG_Q
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_MSG_QTY           NbrEntriesMax;                     /* Peak number of entries in the queue                    */
 #endif
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+    OS_MSG_POOL         *PoolPtr;                           /* Pool the OS_MSGs are taken from                        */
+#endif
 #if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN == DEF_ENABLED))
     CPU_INT16U           MsgQID;                            /* Unique ID for third-party debuggers and tracers.       */
 #endif
@@ -894,6 +1029,9 @@ struct  os_mutex {                                          /* Mutual Exclusion
     OS_MUTEX            *MutexGrpNextPtr;
     OS_TCB              *OwnerTCBPtr;
     OS_NESTING_CTR       OwnerNestingCtr;                   /* Mutex is available when the counter is 0               */
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+    OS_PRIO              CeilingPrio;                       /* Owner's priority (OS_PRIO_CEILING_NONE: inheritance)   */
+#endif
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     CPU_TS               TS;
 #endif
@@ -927,6 +1065,9 @@ struct  os_q {                                              /* Message Queue
 #endif
                                                             /* ------------------ SPECIFIC MEMBERS ------------------ */
     OS_MSG_Q             MsgQ;                              /* List of messages                                       */
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+    OS_MSG_POOL          Pool;                              /* Private slots (see OSQCreateSlots())                   */
+#endif
 };
 
 
@@ -1040,8 +1181,15 @@ struct os_tcb {
     OS_TCB              *PendNextPtr;                       /* Pointer to next     TCB in pend list.                  */
     OS_TCB              *PendPrevPtr;                       /* Pointer to previous TCB in pend list.                  */
     OS_PEND_OBJ         *PendObjPtr;                        /* Pointer to object pended on.                           */
+#if (OS_CFG_PEND_LIST_BUCKET_EN == DEF_ENABLED)
+    OS_PRIO              PendPrio;                          /* Priority the task was inserted in the pend list at.    */
+#endif
     OS_STATE             PendOn;                            /* Indicates what task is pending on                      */
     OS_STATUS            PendStatus;                        /* Pend status                                            */
+#if (OS_CFG_PEND_MULTI_EN == DEF_ENABLED)
+    OS_PEND_DATA        *PendDataTblPtr;                    /* Entries linked while waiting in OSPendMulti()          */
+    OS_OBJ_QTY           PendDataTblEntries;
+#endif
 
     OS_STATE             TaskState;                         /* See OS_TASK_STATE_xxx                                  */
     OS_PRIO              Prio;                              /* Task priority (0 == highest)                           */
@@ -1062,6 +1210,9 @@ struct os_tcb {
     CPU_INT16U           SemID;                             /* Unique ID for third-party debuggers and tracers.       */
 #endif
     OS_SEM_CTR           SemCtr;                            /* Task specific semaphore counter                        */
+#if (OS_CFG_SEM_BATCH_EN == DEF_ENABLED)
+    OS_SEM_CTR           SemPendCnt;                        /* Counts wanted/taken while pending on an OS_SEM         */
+#endif
 
                                                             /* DELAY / TIMEOUT                                        */
 #if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
@@ -1069,6 +1220,43 @@ struct os_tcb {
     OS_TICK              TickCtrPrev;                       /* Used by OSTimeDlyXX() in PERIODIC mode                 */
 #endif
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)                    /* EDF (see os_edf.c)                                     */
+    OS_TICK              EdfDeadline;                       /* Absolute deadline (an OSTickCtr value)                 */
+    CPU_INT08U           EdfHeapIx;                         /* Position in OSEdfHeap[] while ready                    */
+#endif
+
+#if (OS_CFG_TASK_PERIOD_EN == DEF_ENABLED)                  /* PERIODIC TASK (see OSTaskPeriodSet())                  */
+    OS_TICK              PeriodTicks;                       /* Release period (0 if the task is not periodic)         */
+    OS_TICK              PeriodDeadline;                    /* Relative deadline of each job                          */
+    OS_TICK              PeriodRelease;                     /* Tick at which the current job was released             */
+    OS_CTR               PeriodJobCtr;                      /* Number of jobs released                                */
+    OS_CTR               PeriodOverrunCtr;                  /* Number of jobs that finished past their deadline       */
+    OS_CTR               PeriodSkipCtr;                     /* Number of releases skipped to catch up                 */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    CPU_TS               PeriodTS;                          /* Period in CPU_TS units                                 */
+    CPU_TS               PeriodStartTS;                     /* Timestamp at the start of the current job              */
+    CPU_TS               PeriodJitter;                      /* Release jitter of the current job                      */
+    CPU_TS               PeriodJitterMax;                   /* Peak release jitter                                    */
+    CPU_INT64U           PeriodJitterTot;                   /* Sum of the release jitters                             */
+#endif
+#endif
+
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)                  /* CPU BUDGET (see OSTaskBudgetSet())                     */
+    OS_TCB              *BudgetNextPtr;                     /* Pointer to next task with a budget                     */
+    OS_TICK              BudgetTicks;                       /* Budget per replenishment period (0 if none)            */
+    OS_TICK              BudgetPeriod;                      /* Replenishment period                                   */
+    OS_TICK              BudgetRemain;                      /* Budget left until the next replenishment               */
+    OS_TICK              BudgetReplenishCtr;                /* Ticks to the next replenishment (0 if none pending)    */
+    OS_TICK              BudgetOverrunTicks;                /* Ticks charged while the budget was exhausted           */
+    OS_CTR               BudgetOverrunCtr;                  /* Number of times the budget was exhausted               */
+    OS_OPT               BudgetOpt;                         /* OS_OPT_TASK_BUDGET_DEMOTE or _SUSPEND                  */
+    OS_PRIO              BudgetPrio;                        /* Priority while the budget is exhausted                 */
+#if (OS_CFG_MUTEX_EN != DEF_ENABLED)
+    OS_PRIO              BudgetPrioSave;                    /* Priority before the task was demoted                   */
+#endif
+    CPU_BOOLEAN          BudgetThrottled;                   /* Demoted or suspended for lack of budget                */
+#endif
+
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
     OS_TICK              TimeQuanta;
     OS_TICK              TimeQuantaCtr;
@@ -1081,6 +1269,9 @@ struct os_tcb {
 
 #if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
     OS_MSG_Q             MsgQ;                              /* Message queue associated with task                     */
+#if (OS_CFG_TASK_Q_SLOT_EN == DEF_ENABLED)
+    OS_MSG_POOL          MsgPool;                           /* Private slots (see OSTaskQSlotsSet())                  */
+#endif
 #if (OS_CFG_TASK_PROFILE_EN == DEF_ENABLED)
     CPU_TS               MsgQPendTime;                      /* Time it took for signal to be received                 */
     CPU_TS               MsgQPendTimeMax;                   /* Max amount of time it took for signal to be received   */
@@ -1095,6 +1286,9 @@ struct os_tcb {
     OS_FLAGS             FlagsPend;                         /* Event flag(s) to wait on                               */
     OS_FLAGS             FlagsRdy;                          /* Event flags that made task ready to run                */
     OS_OPT               FlagsOpt;                          /* Options (See OS_OPT_FLAG_xxx)                          */
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    CPU_INT08U           FlagsIdxSlot;                      /* Slot in the flag group's waiter index                  */
+#endif
 #endif
 
 #if (OS_CFG_MON_EN == DEF_ENABLED)
@@ -1213,6 +1407,21 @@ OS_EXT            OS_IDLE_CTR               OSIdleTaskCtr;
 #endif
 #if (OS_CFG_TASK_IDLE_EN == DEF_ENABLED)
 OS_EXT            OS_TCB                    OSIdleTaskTCB;
+#endif
+
+                                                                        /* ISR HANDLER TASK ------------------------- */
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+OS_EXT            CPU_INT32U                OSIntQInIx;                 /* Next entry written by an ISR               */
+OS_EXT            CPU_INT32U                OSIntQOutIx;                /* Next entry read by the ISR handler task    */
+OS_EXT            CPU_INT32U                OSIntQNbrEntriesMax;        /* Peak number of entries in the queue        */
+OS_EXT            CPU_INT32U                OSIntQOvfCtr;               /* Number of posts lost, queue full           */
+OS_EXT            OS_CTR                    OSIntQRePostErrCtr;         /* Number of posts lost, re-post failed       */
+OS_EXT            OS_ERR                    OSIntQRePostErr;            /* Error of the last failed re-post           */
+OS_EXT            CPU_INT32U                OSIntQTaskRdy;              /* ISR handler task is in the ready list      */
+OS_EXT            OS_TCB                    OSIntQTaskTCB;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+OS_EXT            CPU_TS                    OSIntQTaskTS;               /* ISR timestamp of the post being re-posted  */
+#endif
 #endif
 
                                                                         /* MISCELLANEOUS ---------------------------- */
@@ -1260,6 +1469,9 @@ OS_EXT            OS_OBJ_QTY                OSMutexQty;                 /* Numbe
 OS_EXT            OS_PRIO                   OSPrioCur;                  /* Priority of current task                   */
 OS_EXT            OS_PRIO                   OSPrioHighRdy;              /* Priority of highest priority task          */
 extern            CPU_DATA                  OSPrioTbl[OS_PRIO_TBL_SIZE];
+#if (OS_PRIO_GRP_EN == DEF_ENABLED)
+extern            CPU_DATA                  OSPrioGrp;                  /* One bit per non-empty OSPrioTbl[] entry    */
+#endif
 
                                                                         /* QUEUES ----------------------------------- */
 #if (OS_CFG_Q_EN == DEF_ENABLED)
@@ -1273,6 +1485,11 @@ OS_EXT            OS_OBJ_QTY                OSQQty;                     /* Numbe
 
                                                                         /* READY LIST ------------------------------- */
 OS_EXT            OS_RDY_LIST               OSRdyList[OS_CFG_PRIO_MAX]; /* Table of tasks ready to run                */
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+OS_EXT            OS_TCB                   *OSEdfHeap[OS_CFG_SCHED_EDF_TASK_MAX]; /* Ready EDF tasks (min-heap) */
+OS_EXT            CPU_INT08U                OSEdfHeapQty;               /* Number of entries in OSEdfHeap[]           */
+OS_EXT            CPU_INT08U                OSEdfTaskQty;               /* Number of tasks created in the EDF band    */
+#endif
 
 
 #ifdef OS_SAFETY_CRITICAL_IEC61508
@@ -1331,6 +1548,10 @@ OS_EXT            OS_TCB                   *OSTaskDbgListPtr;
 
 OS_EXT            OS_OBJ_QTY                OSTaskQty;                  /* Number of tasks created                    */
 
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+OS_EXT            OS_TCB                   *OSTaskBudgetListPtr;        /* List of tasks with a CPU budget            */
+#endif
+
 #if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
 OS_EXT            OS_REG_ID                 OSTaskRegNextAvailID;       /* Next available Task Register ID            */
 #endif
@@ -1394,6 +1615,14 @@ extern  CPU_STK_SIZE  const OSCfg_IdleTaskStkLimit;
 extern  CPU_STK_SIZE  const OSCfg_IdleTaskStkSize;
 extern  CPU_INT32U    const OSCfg_IdleTaskStkSizeRAM;
 
+extern  OS_INT_Q    * const OSCfg_IntQBasePtr;
+extern  OS_OBJ_QTY    const OSCfg_IntQSize;
+extern  CPU_INT32U    const OSCfg_IntQSizeRAM;
+extern  CPU_STK     * const OSCfg_IntQTaskStkBasePtr;
+extern  CPU_STK_SIZE  const OSCfg_IntQTaskStkLimit;
+extern  CPU_STK_SIZE  const OSCfg_IntQTaskStkSize;
+extern  CPU_INT32U    const OSCfg_IntQTaskStkSizeRAM;
+
 extern  CPU_STK     * const OSCfg_ISRStkBasePtr;
 extern  CPU_STK_SIZE  const OSCfg_ISRStkSize;
 extern  CPU_INT32U    const OSCfg_ISRStkSizeRAM;
@@ -1431,6 +1660,11 @@ extern  CPU_INT32U    const OSCfg_DataSizeRAM;
 extern  CPU_STK        OSCfg_IdleTaskStk[OS_CFG_IDLE_TASK_STK_SIZE];
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+extern  OS_INT_Q       OSCfg_IntQ[OS_CFG_INT_Q_SIZE];
+extern  CPU_STK        OSCfg_IntQTaskStk[OS_CFG_INT_Q_TASK_STK_SIZE];
+#endif
+
 #if (OS_CFG_ISR_STK_SIZE > 0u)
 extern  CPU_STK        OSCfg_ISRStk[OS_CFG_ISR_STK_SIZE];
 #endif
@@ -1459,6 +1693,30 @@ extern  CPU_STK        OSCfg_TmrTaskStk[OS_CFG_TMR_TASK_STK_SIZE];
 ************************************************************************************************************************
 */
 
+/* ================================================================================================================== */
+/*                                          EARLIEST DEADLINE FIRST SCHEDULING                                        */
+/* ================================================================================================================== */
+
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+
+void          OSEdfDeadlineSet          (OS_TCB                *p_tcb,
+                                         OS_TICK                deadline,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_EdfDeadlineSet         (OS_TCB                *p_tcb,
+                                         OS_TICK                deadline);
+
+void          OS_EdfInit                (void);
+
+void          OS_EdfInsert              (OS_TCB                *p_tcb);
+
+void          OS_EdfRemove              (OS_TCB                *p_tcb);
+
+#endif
+
+
 /* ================================================================================================================== */
 /*                                                    EVENT FLAGS                                                     */
 /* ================================================================================================================== */
@@ -1511,9 +1769,24 @@ void          OS_FlagDbgListAdd         (OS_FLAG_GRP           *p_grp);
 void          OS_FlagDbgListRemove      (OS_FLAG_GRP           *p_grp);
 #endif
 
+CPU_BOOLEAN   OS_FlagRdyChk             (OS_FLAG_GRP           *p_grp,
+                                         OS_FLAGS               flags_pend,
+                                         OS_OPT                 opt,
+                                         OS_FLAGS              *p_flags_rdy);
+
 void          OS_FlagTaskRdy            (OS_TCB                *p_tcb,
                                          OS_FLAGS               flags_rdy,
                                          CPU_TS                 ts);
+
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+void          OS_FlagIdxInit            (OS_FLAG_GRP           *p_grp);
+
+void          OS_FlagIdxAdd             (OS_FLAG_GRP           *p_grp,
+                                         OS_TCB                *p_tcb);
+
+void          OS_FlagIdxRemove          (OS_FLAG_GRP           *p_grp,
+                                         OS_TCB                *p_tcb);
+#endif
 #endif
 
 
@@ -1537,6 +1810,12 @@ void          OSMemPut                  (OS_MEM                *p_mem,
                                          void                  *p_blk,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+void          OSMemOwnerTblSet          (OS_MEM                *p_mem,
+                                         OS_TCB               **p_tbl,
+                                         OS_ERR                *p_err);
+#endif
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
@@ -1548,6 +1827,30 @@ void          OS_MemInit                (OS_ERR                *p_err);
 #endif
 
 
+/* ================================================================================================================== */
+/*                                                  DEFERRED ISR POSTS                                                */
+/* ================================================================================================================== */
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+void          OS_IntQPost               (OS_OBJ_TYPE            type,
+                                         void                  *p_obj,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_FLAGS               flags,
+                                         OS_OPT                 opt,
+                                         CPU_TS                 ts,
+                                         OS_ERR                *p_err);
+
+void          OS_IntQTask               (void                  *p_arg);
+
+void          OS_IntQTaskInit           (OS_ERR                *p_err);
+
+#endif
+
+
 /* ================================================================================================================== */
 /*                                                     MONITORS                                                       */
 /* ================================================================================================================== */
@@ -1595,6 +1898,13 @@ void          OSMutexCreate             (OS_MUTEX              *p_mutex,
                                          CPU_CHAR              *p_name,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+void          OSMutexCreateCeiling      (OS_MUTEX              *p_mutex,
+                                         CPU_CHAR              *p_name,
+                                         OS_PRIO                prio_ceiling,
+                                         OS_ERR                *p_err);
+#endif
+
 #if (OS_CFG_MUTEX_DEL_EN == DEF_ENABLED)
 OS_OBJ_QTY    OSMutexDel                (OS_MUTEX              *p_mutex,
                                          OS_OPT                 opt,
@@ -1640,6 +1950,44 @@ void          OS_MutexGrpPostAll        (OS_TCB                *p_tcb);
 #endif
 
 
+/* ================================================================================================================== */
+/*                                                   MULTIPLE PENDS                                                   */
+/* ================================================================================================================== */
+
+#if (OS_CFG_PEND_MULTI_EN == DEF_ENABLED)
+
+OS_OBJ_QTY    OSPendMulti               (OS_PEND_DATA          *p_pend_data_tbl,
+                                         OS_OBJ_QTY             tbl_size,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+
+/* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
+
+OS_OBJ_QTY    OS_PendMultiAbortObj      (OS_PEND_OBJ           *p_obj,
+                                         CPU_TS                 ts,
+                                         OS_STATUS              reason,
+                                         CPU_BOOLEAN            all);
+
+void          OS_PendMultiChangePrio    (OS_TCB                *p_tcb);
+
+void          OS_PendMultiInsert        (OS_TCB                *p_tcb);
+
+void          OS_PendMultiPost          (OS_PEND_DATA          *p_pend_data,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         CPU_TS                 ts);
+
+CPU_BOOLEAN   OS_PendMultiPostObj       (OS_PEND_OBJ           *p_obj,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         CPU_TS                 ts,
+                                         OS_OPT                 opt);
+
+void          OS_PendMultiRemove        (OS_TCB                *p_tcb);
+#endif
+
+
 /* ================================================================================================================== */
 /*                                                   MESSAGE QUEUES                                                   */
 /* ================================================================================================================== */
@@ -1651,6 +1999,16 @@ void          OSQCreate                 (OS_Q                  *p_q,
                                          OS_MSG_QTY             max_qty,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+void          OSQCreateSlots            (OS_Q                  *p_q,
+                                         CPU_CHAR              *p_name,
+                                         OS_MSG                *p_msg_tbl,
+                                         OS_MSG_QTY             max_qty,
+                                         void                  *p_data,
+                                         OS_MSG_SIZE            data_size,
+                                         OS_ERR                *p_err);
+#endif
+
 #if (OS_CFG_Q_DEL_EN == DEF_ENABLED)
 OS_OBJ_QTY    OSQDel                    (OS_Q                  *p_q,
                                          OS_OPT                 opt,
@@ -1675,16 +2033,56 @@ OS_OBJ_QTY    OSQPendAbort              (OS_Q                  *p_q,
                                          OS_ERR                *p_err);
 #endif
 
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+OS_MSG_SIZE   OSQPendCopy               (OS_Q                  *p_q,
+                                         void                  *p_buf,
+                                         OS_MSG_SIZE            buf_size,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+
+OS_MSG_QTY    OSQPendN                  (OS_Q                  *p_q,
+                                         void                  *p_buf,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_MSG_QTY             qty,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+#endif
+
 void          OSQPost                   (OS_Q                  *p_q,
                                          void                  *p_void,
                                          OS_MSG_SIZE            msg_size,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+OS_MSG_QTY    OSQPostN                  (OS_Q                  *p_q,
+                                         void                  *p_data,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_MSG_QTY             qty,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
 /* ------------------------------------------------ INTERNAL FUNCTIONS ---------------------------------------------- */
 
 void          OS_QClr                   (OS_Q                  *p_q);
 
+CPU_BOOLEAN   OS_QPost                  (OS_Q                  *p_q,
+                                         void                  *p_void,
+                                         OS_MSG_SIZE            msg_size,
+                                         OS_OPT                 opt,
+                                         CPU_TS                 ts,
+                                         OS_ERR                *p_err);
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED) && (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+void          OS_QPostDeferred          (OS_Q                  *p_q,
+                                         OS_OPT                 opt);
+#endif
+
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
 void          OS_QDbgListAdd            (OS_Q                  *p_q);
 
@@ -1723,10 +2121,27 @@ OS_OBJ_QTY    OSSemPendAbort            (OS_SEM                *p_sem,
                                          OS_ERR                *p_err);
 #endif
 
+#if (OS_CFG_SEM_BATCH_EN == DEF_ENABLED)
+OS_SEM_CTR    OSSemPendUpTo             (OS_SEM                *p_sem,
+                                         OS_SEM_CTR             max,
+                                         OS_SEM_CTR            *p_got,
+                                         OS_TICK                timeout,
+                                         OS_OPT                 opt,
+                                         CPU_TS                *p_ts,
+                                         OS_ERR                *p_err);
+#endif
+
 OS_SEM_CTR    OSSemPost                 (OS_SEM                *p_sem,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_SEM_BATCH_EN == DEF_ENABLED)
+OS_SEM_CTR    OSSemPostN                (OS_SEM                *p_sem,
+                                         OS_SEM_CTR             cnt,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
 #if (OS_CFG_SEM_SET_EN == DEF_ENABLED)
 void          OSSemSet                  (OS_SEM                *p_sem,
                                          OS_SEM_CTR             cnt,
@@ -1750,6 +2165,15 @@ void          OS_SemDbgListRemove       (OS_SEM                *p_sem);
 /*                                                 TASK MANAGEMENT                                                    */
 /* ================================================================================================================== */
 
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+void          OSTaskBudgetSet           (OS_TCB                *p_tcb,
+                                         OS_TICK                budget,
+                                         OS_TICK                period,
+                                         OS_PRIO                prio,
+                                         OS_OPT                 opt,
+                                         OS_ERR                *p_err);
+#endif
+
 #if (OS_CFG_TASK_CHANGE_PRIO_EN == DEF_ENABLED)
 void          OSTaskChangePrio          (OS_TCB                *p_tcb,
                                          OS_PRIO                prio_new,
@@ -1775,6 +2199,16 @@ void          OSTaskDel                 (OS_TCB                *p_tcb,
                                          OS_ERR                *p_err);
 #endif
 
+#if (OS_CFG_TASK_PERIOD_EN == DEF_ENABLED)
+void          OSTaskPeriodSet           (OS_TCB                *p_tcb,
+                                         OS_TICK                period,
+                                         OS_TICK                phase,
+                                         OS_TICK                deadline,
+                                         OS_ERR                *p_err);
+
+void          OSTaskPeriodWait          (OS_ERR                *p_err);
+#endif
+
 #if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
 OS_MSG_QTY    OSTaskQFlush              (OS_TCB                *p_tcb,
                                          OS_ERR                *p_err);
@@ -1795,6 +2229,12 @@ void          OSTaskQPost               (OS_TCB                *p_tcb,
                                          OS_OPT                 opt,
                                          OS_ERR                *p_err);
 
+#if (OS_CFG_TASK_Q_SLOT_EN == DEF_ENABLED)
+void          OSTaskQSlotsSet           (OS_TCB                *p_tcb,
+                                         OS_MSG                *p_msg_tbl,
+                                         OS_MSG_QTY             max_qty,
+                                         OS_ERR                *p_err);
+#endif
 #endif
 
 #if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
@@ -1886,6 +2326,16 @@ void          OS_TaskStkRedzoneInit     (CPU_STK               *p_base,
 void          OS_TaskChangePrio(         OS_TCB                *p_tcb,
                                          OS_PRIO                prio_new);
 
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+void          OS_TaskBudgetTick         (OS_TICK                ticks);
+
+void          OS_TaskBudgetThrottle     (OS_TCB                *p_tcb);
+
+void          OS_TaskBudgetRelease      (OS_TCB                *p_tcb);
+
+void          OS_TaskBudgetListRemove   (OS_TCB                *p_tcb);
+#endif
+
 
 /* ================================================================================================================== */
 /*                                                 TIME MANAGEMENT                                                    */
@@ -2112,6 +2562,18 @@ void          OS_Dbg_Init               (void);
 
 void          OS_MsgPoolInit            (OS_ERR                *p_err);
 
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+void          OS_MsgPoolCreate          (OS_MSG_POOL           *p_pool,
+                                         OS_MSG                *p_msg_tbl,
+                                         OS_MSG_QTY             qty,
+                                         void                  *p_data,
+                                         OS_MSG_SIZE            data_size);
+
+void          OS_MsgCopy                (void                  *p_dest,
+                                         void                  *p_src,
+                                         OS_MSG_SIZE            size);
+#endif
+
 OS_MSG_QTY    OS_MsgQFreeAll            (OS_MSG_Q              *p_msg_q);
 
 void         *OS_MsgQGet                (OS_MSG_Q              *p_msg_q,
@@ -2258,6 +2720,16 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
 #endif
 
 
+#ifndef OS_CFG_ISR_POST_DEFERRED_EN
+#error  "OS_CFG.H, Missing OS_CFG_ISR_POST_DEFERRED_EN: Enable (1) or Disable (0) deferring ISR posts to the ISR handler task"
+#else
+    #if    (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED) && \
+           (OS_CFG_INT_Q_SIZE           <  2u)
+    #error  "OS_CFG_APP.H,     OS_CFG_INT_Q_SIZE must be >= 2 with OS_CFG_ISR_POST_DEFERRED_EN"
+    #endif
+#endif
+
+
 #ifndef OS_CFG_OBJ_TYPE_CHK_EN
 #error  "OS_CFG.H, Missing OS_CFG_OBJ_TYPE_CHK_EN: Enable (1) or Disable (0) checking for proper object types in kernel services"
 #endif
@@ -2268,6 +2740,33 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
 #endif
 
 
+#ifndef OS_CFG_PEND_LIST_BUCKET_EN
+#error  "OS_CFG.H, Missing OS_CFG_PEND_LIST_BUCKET_EN: Enable (1) or Disable (0) pend lists indexed by priority"
+#endif
+
+
+#ifndef OS_CFG_PEND_MULTI_EN
+#error  "OS_CFG.H, Missing OS_CFG_PEND_MULTI_EN: Enable (1) or Disable (0) code generation for OSPendMulti()"
+#else
+    #if    (OS_CFG_PEND_MULTI_EN == DEF_ENABLED) && \
+           (OS_CFG_SEM_EN        != DEF_ENABLED) && \
+           (OS_CFG_Q_EN          != DEF_ENABLED) && \
+           (OS_CFG_FLAG_EN       != DEF_ENABLED)
+    #error  "OS_CFG.H,         OS_CFG_PEND_MULTI_EN requires semaphores, message queues or event flags"
+    #endif
+#endif
+
+
+#ifndef OS_CFG_PRIO_BITMAP_2L_EN
+#error  "OS_CFG.H, Missing OS_CFG_PRIO_BITMAP_2L_EN: Enable (1) or Disable (0) the two-level ready priority bitmap"
+#else
+    #if    (OS_PRIO_GRP_EN   == DEF_ENABLED) && \
+           (OS_PRIO_TBL_SIZE >  DEF_INT_CPU_NBR_BITS)
+    #error  "OS_CFG.H,         OS_CFG_PRIO_MAX must be <= DEF_INT_CPU_NBR_BITS squared (1024) with OS_CFG_PRIO_BITMAP_2L_EN"
+    #endif
+#endif
+
+
 #ifndef OS_CFG_SCHED_LOCK_TIME_MEAS_EN
 #error  "OS_CFG.H, Missing OS_CFG_SCHED_LOCK_TIME_MEAS_EN: Include code to measure scheduler lock time"
 #else
@@ -2283,6 +2782,22 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
 #endif
 
 
+#ifndef OS_CFG_SCHED_EDF_EN
+#error  "OS_CFG.H, Missing OS_CFG_SCHED_EDF_EN: Enable (1) or Disable (0) the EDF scheduling class"
+#else
+    #if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+        #if     (OS_CFG_SCHED_EDF_PRIO_HI > OS_CFG_SCHED_EDF_PRIO_LO) || \
+                (OS_CFG_SCHED_EDF_PRIO_LO >= (OS_CFG_PRIO_MAX - 1u))
+        #error  "OS_CFG.H,         OS_CFG_SCHED_EDF_PRIO_HI/LO must satisfy HI <= LO < (OS_CFG_PRIO_MAX - 1)"
+        #endif
+        #if     (OS_CFG_SCHED_EDF_TASK_MAX < 1u) || \
+                (OS_CFG_SCHED_EDF_TASK_MAX > 254u)
+        #error  "OS_CFG.H,         OS_CFG_SCHED_EDF_TASK_MAX must be >= 1 and <= 254"
+        #endif
+    #endif
+#endif
+
+
 #ifndef OS_CFG_STK_SIZE_MIN
 #error  "OS_CFG.H, Missing OS_CFG_STK_SIZE_MIN: Determines the minimum size for a task stack"
 #endif
@@ -2316,6 +2831,17 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
     #ifndef OS_CFG_FLAG_PEND_ABORT_EN
     #error  "OS_CFG.H, Missing OS_CFG_FLAG_PEND_ABORT_EN: Include code for aborting pends from another task"
     #endif
+
+    #ifndef OS_CFG_FLAG_IDX_EN
+    #error  "OS_CFG.H, Missing OS_CFG_FLAG_IDX_EN: Index event flag waiters by flag bit"
+    #endif
+
+    #ifndef OS_CFG_FLAG_64_EN
+    #error  "OS_CFG.H, Missing OS_CFG_FLAG_64_EN: Use 64-bit event flags"
+    #elif  (OS_CFG_FLAG_64_EN     == DEF_ENABLED) && \
+           (CPU_CFG_DATA_SIZE_MAX <  CPU_WORD_SIZE_64)
+    #error  "OS_CFG.H,         OS_CFG_FLAG_64_EN requires CPU_CFG_DATA_SIZE_MAX >= CPU_WORD_SIZE_64 in 'cpu.h'"
+    #endif
 #endif
 
 /*
@@ -2326,6 +2852,10 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
 
 #ifndef OS_CFG_MEM_EN
 #error  "OS_CFG.H, Missing OS_CFG_MEM_EN: Enable (1) or Disable (0) code generation for MEMORY MANAGER"
+#else
+    #ifndef OS_CFG_MEM_LOCK_FREE_EN
+    #error  "OS_CFG.H, Missing OS_CFG_MEM_LOCK_FREE_EN: Use lock-free OSMemGet() and OSMemPut()"
+    #endif
 #endif
 
 /*
@@ -2337,6 +2867,10 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
 #ifndef OS_CFG_MUTEX_EN
 #error  "OS_CFG.H, Missing OS_CFG_MUTEX_EN: Enable (1) or Disable (0) code generation for MUTEX"
 #else
+    #ifndef OS_CFG_MUTEX_CEILING_EN
+    #error  "OS_CFG.H, Missing OS_CFG_MUTEX_CEILING_EN: Include code for priority-ceiling mutexes"
+    #endif
+
     #ifndef OS_CFG_MUTEX_DEL_EN
     #error  "OS_CFG.H, Missing OS_CFG_MUTEX_DEL_EN: Include code for OSMutexDel()"
     #endif
@@ -2366,6 +2900,10 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
     #ifndef OS_CFG_Q_PEND_ABORT_EN
     #error  "OS_CFG.H, Missing OS_CFG_Q_PEND_ABORT_EN: Include code for OSQPendAbort()"
     #endif
+
+    #ifndef OS_CFG_Q_SLOT_EN
+    #error  "OS_CFG.H, Missing OS_CFG_Q_SLOT_EN: Include code for queue slots, OSQPendCopy(), OSQPendN() and OSQPostN()"
+    #endif
 #endif
 
 /*
@@ -2388,6 +2926,10 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
     #ifndef OS_CFG_SEM_SET_EN
     #error  "OS_CFG.H, Missing OS_CFG_SEM_SET_EN: Include code for OSSemSet()"
     #endif
+
+    #ifndef OS_CFG_SEM_BATCH_EN
+    #error  "OS_CFG.H, Missing OS_CFG_SEM_BATCH_EN: Include code for OSSemPostN() and OSSemPendUpTo()"
+    #endif
 #endif
 
 /*
@@ -2404,6 +2946,10 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
 #error  "OS_CFG.H, Missing OS_CFG_STAT_TASK_STK_CHK_EN: Check task stacks from statistics task"
 #endif
 
+#ifndef OS_CFG_TASK_BUDGET_EN
+#error  "OS_CFG.H, Missing OS_CFG_TASK_BUDGET_EN: Include code for OSTaskBudgetSet()"
+#endif
+
 #ifndef OS_CFG_TASK_CHANGE_PRIO_EN
 #error  "OS_CFG.H, Missing OS_CFG_TASK_CHANGE_PRIO_EN: Include code for OSTaskChangePrio()"
 #endif
@@ -2412,6 +2958,15 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
 #error  "OS_CFG.H, Missing OS_CFG_TASK_DEL_EN: Include code for OSTaskDel()"
 #endif
 
+#ifndef OS_CFG_TASK_PERIOD_EN
+#error  "OS_CFG.H, Missing OS_CFG_TASK_PERIOD_EN: Include code for OSTaskPeriodSet() and OSTaskPeriodWait()"
+#else
+#if    (OS_CFG_TASK_PERIOD_EN == DEF_ENABLED) && \
+       (OS_CFG_TASK_TICK_EN == DEF_DISABLED)
+#error  "OS_CFG.H,         OS_CFG_TASK_TICK_EN must be Enabled (1) to use periodic tasks"
+#endif
+#endif
+
 #ifndef OS_CFG_TASK_Q_EN
 #error  "OS_CFG.H, Missing OS_CFG_TASK_Q_EN: Include code for OSTaskQxxx()"
 #endif
@@ -2420,6 +2975,15 @@ OS_TICK       BSP_OS_TickNextSet        (OS_TICK                ticks);
 #error  "OS_CFG.H, Missing OS_CFG_TASK_Q_PEND_ABORT_EN: Include code for OSTaskQPendAbort()"
 #endif
 
+#ifndef OS_CFG_TASK_Q_SLOT_EN
+#error  "OS_CFG.H, Missing OS_CFG_TASK_Q_SLOT_EN: Include code for OSTaskQSlotsSet()"
+#else
+#if    (OS_CFG_TASK_Q_SLOT_EN == DEF_ENABLED) && \
+      ((OS_CFG_TASK_Q_EN == DEF_DISABLED) || (OS_CFG_Q_SLOT_EN == DEF_DISABLED))
+#error  "OS_CFG.H,         OS_CFG_TASK_Q_EN and OS_CFG_Q_SLOT_EN must be Enabled (1) to use task queue slots"
+#endif
+#endif
+
 #ifndef OS_CFG_TASK_PROFILE_EN
 #error  "OS_CFG.H, Missing OS_CFG_TASK_PROFILE_EN: Include code for task profiling"
 #else
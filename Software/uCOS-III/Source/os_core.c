@@ -39,6 +39,17 @@
 const  CPU_CHAR  *os_core__c = "$Id: $";
 #endif
 
+#if (OS_CFG_PEND_LIST_BUCKET_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                                 FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  OS_TCB  *OS_PendListBucketPrevGet (OS_PEND_LIST  *p_pend_list,
+                                           OS_PRIO        prio);
+#endif
+
 /*
 ************************************************************************************************************************
 *                                                    INITIALIZATION
@@ -72,6 +83,8 @@ void  OSInit (OS_ERR  *p_err)
 
     OSInitHook();                                               /* Call port specific initialization code               */
 
+    OS_TRACE_INIT();                                            /* Initialize trace recorder (if any)                   */
+
     OSIntNestingCtr       =           0u;                       /* Clear the interrupt nesting counter                  */
 
     OSRunning             =  OS_STATE_OS_STOPPED;               /* Indicate that multitasking has not started           */
@@ -136,6 +149,10 @@ void  OSInit (OS_ERR  *p_err)
 
     OS_RdyListInit();                                           /* Initialize the Ready List                            */
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    OS_EdfInit();                                               /* Initialize the EDF heap                              */
+#endif
+
 
 #if (OS_CFG_FLAG_EN == DEF_ENABLED)                             /* Initialize the Event Flag module                     */
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
@@ -206,6 +223,14 @@ void  OSInit (OS_ERR  *p_err)
 #endif
 
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    OS_IntQTaskInit(p_err);                                     /* Initialize the ISR Handler Task                      */
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+#endif
+
+
 #if (OS_CFG_TASK_TICK_EN == DEF_ENABLED)
     OS_TickTaskInit(p_err);                                     /* Initialize the Tick Task                             */
     if (*p_err != OS_ERR_NONE) {
@@ -1162,6 +1187,10 @@ void  OS_PendDbgNameAdd (OS_PEND_OBJ  *p_obj,
                  p_tcb->DbgNamePtr = (CPU_CHAR *)((void *)"Task Sem");
                  break;
 
+            case OS_TASK_PEND_ON_MULTI:
+                 p_tcb->DbgNamePtr = (CPU_CHAR *)((void *)"Multi");
+                 break;
+
             default:
                  p_tcb->DbgNamePtr = (CPU_CHAR *)((void *)" ");
                  break;
@@ -1207,6 +1236,9 @@ void  OS_PendDbgNameRemove (OS_PEND_OBJ  *p_obj,
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
 *
 *              2) It's assumed that the TCB contains the NEW priority in its .Prio field.
+*
+*              3) With OS_CFG_PEND_LIST_BUCKET_EN, the task MUST move to its new priority's bucket even when it is alone
+*                 in the list.
 ************************************************************************************************************************
 */
 
@@ -1218,11 +1250,22 @@ void  OS_PendListChangePrio (OS_TCB  *p_tcb)
     p_obj       =  p_tcb->PendObjPtr;                           /* Get pointer to pend list                             */
     p_pend_list = &p_obj->PendList;
 
+#if (OS_CFG_PEND_LIST_BUCKET_EN == DEF_ENABLED)
+    if ((p_pend_list->HeadPtr->PendNextPtr != (OS_TCB *)0) ||   /* Only move if multiple entries in the list ...        */
+        (p_tcb->PendPrio != p_tcb->Prio)) {                     /* ... or if the bucket changes, see Note #3            */
+#else
     if (p_pend_list->HeadPtr->PendNextPtr != (OS_TCB *)0) {     /* Only move if multiple entries in the list            */
+#endif
             OS_PendListRemove(p_tcb);                           /* Remove entry from current position                   */
             p_tcb->PendObjPtr = p_obj;
             OS_PendListInsertPrio(p_pend_list,                  /* INSERT it back in the list                           */
                                   p_tcb);
+#if ((OS_CFG_FLAG_EN == DEF_ENABLED) && (OS_CFG_FLAG_IDX_EN == DEF_ENABLED))
+            if (p_tcb->PendOn == OS_TASK_PEND_ON_FLAG) {        /* Removal also dropped the event flag index entry      */
+                OS_FlagIdxAdd((OS_FLAG_GRP *)((void *)p_obj),
+                              p_tcb);
+            }
+#endif
     }
 }
 
@@ -1244,11 +1287,24 @@ void  OS_PendListChangePrio (OS_TCB  *p_tcb)
 
 void  OS_PendListInit (OS_PEND_LIST  *p_pend_list)
 {
+#if (OS_CFG_PEND_LIST_BUCKET_EN == DEF_ENABLED)
+    CPU_DATA  i;
+
+
+#endif
     p_pend_list->HeadPtr    = (OS_TCB *)0;
     p_pend_list->TailPtr    = (OS_TCB *)0;
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     p_pend_list->NbrEntries =           0u;
 #endif
+#if (OS_CFG_PEND_LIST_BUCKET_EN == DEF_ENABLED)
+    for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {                   /* .PrioTailPtr[] entries are only valid when their ... */
+        p_pend_list->PrioTbl[i] = 0u;                           /* ... bit is set in .PrioTbl[]                         */
+    }
+#endif
+#if (OS_CFG_PEND_MULTI_EN == DEF_ENABLED)
+    p_pend_list->MultiHeadPtr = (OS_PEND_DATA *)0;
+#endif
 }
 
 
@@ -1312,6 +1368,10 @@ void  OS_PendListInit (OS_PEND_LIST  *p_pend_list)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With OS_CFG_PEND_LIST_BUCKET_EN, the list is kept in the same order but the last task of each priority
+*                 present is known (.PrioTailPtr[] & .PrioTbl[]).  The new task goes right after the last task of its
+*                 own priority or, if there is none, of the nearest higher priority, without walking the list.
 ************************************************************************************************************************
 */
 
@@ -1320,8 +1380,38 @@ void  OS_PendListInsertPrio (OS_PEND_LIST  *p_pend_list,
 {
     OS_PRIO   prio;
     OS_TCB   *p_tcb_next;
+#if (OS_CFG_PEND_LIST_BUCKET_EN == DEF_ENABLED)
+    OS_TCB   *p_tcb_prev;
+    CPU_DATA  bit;
+
+
+    prio            = p_tcb->Prio;                              /* Obtain the priority of the task to insert            */
+    p_tcb->PendPrio = prio;
+    p_tcb_prev      = OS_PendListBucketPrevGet(p_pend_list, prio);  /* See Note #2                                      */
 
+    bit                                           = 1u;
+    bit                                         <<= (DEF_INT_CPU_NBR_BITS - 1u) - ((CPU_DATA)prio & (DEF_INT_CPU_NBR_BITS - 1u));
+    p_pend_list->PrioTbl[prio / (OS_PRIO)DEF_INT_CPU_NBR_BITS] |= bit;
+    p_pend_list->PrioTailPtr[prio]                =  p_tcb;
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_pend_list->NbrEntries++;
+#endif
 
+    if (p_tcb_prev == (OS_TCB *)0) {                            /* Highest priority waiter, insert at the head          */
+        p_tcb_next           = p_pend_list->HeadPtr;
+        p_pend_list->HeadPtr = p_tcb;
+    } else {
+        p_tcb_next              = p_tcb_prev->PendNextPtr;
+        p_tcb_prev->PendNextPtr = p_tcb;
+    }
+    p_tcb->PendPrevPtr = p_tcb_prev;
+    p_tcb->PendNextPtr = p_tcb_next;
+    if (p_tcb_next == (OS_TCB *)0) {                            /* Lowest priority waiter, new tail                     */
+        p_pend_list->TailPtr    = p_tcb;
+    } else {
+        p_tcb_next->PendPrevPtr = p_tcb;
+    }
+#else
     prio  = p_tcb->Prio;                                        /* Obtain the priority of the task to insert            */
 
     if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* CASE 0: Insert when there are no entries             */
@@ -1363,6 +1453,7 @@ void  OS_PendListInsertPrio (OS_PEND_LIST  *p_pend_list,
             }
         }
     }
+#endif
 }
 
 
@@ -1411,6 +1502,9 @@ void  OS_PendListInsertPrio (OS_PEND_LIST  *p_pend_list,
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A task waiting in OSPendMulti() has no .PendObjPtr; its OS_PEND_DATA entries are unlinked from all the
+*                 objects it waits on instead.
 ************************************************************************************************************************
 */
 
@@ -1419,11 +1513,41 @@ void  OS_PendListRemove (OS_TCB  *p_tcb)
     OS_PEND_LIST  *p_pend_list;
     OS_TCB        *p_next;
     OS_TCB        *p_prev;
+#if (OS_CFG_PEND_LIST_BUCKET_EN == DEF_ENABLED)
+    OS_PRIO        prio;
+    CPU_DATA       bit;
+#endif
 
 
+#if (OS_CFG_PEND_MULTI_EN == DEF_ENABLED)
+    if (p_tcb->PendDataTblPtr != (OS_PEND_DATA *)0) {           /* Waiting in OSPendMulti(), see Note #2                */
+        OS_PendMultiRemove(p_tcb);
+    }
+#endif
     if (p_tcb->PendObjPtr != (OS_PEND_OBJ *)0) {                /* Only remove if object has a pend list.               */
         p_pend_list = &p_tcb->PendObjPtr->PendList;             /* Get pointer to pend list                             */
 
+#if (OS_CFG_PEND_LIST_BUCKET_EN == DEF_ENABLED)
+        prio = p_tcb->PendPrio;                                 /* .Prio may already hold a new priority                */
+        if (p_pend_list->PrioTailPtr[prio] == p_tcb) {          /* Removing the last task of its priority?              */
+            p_prev = p_tcb->PendPrevPtr;
+            if ((p_prev         != (OS_TCB *)0) &&
+                (p_prev->PendPrio == prio)) {
+                p_pend_list->PrioTailPtr[prio] = p_prev;        /* No,  previous task of the same priority is the last  */
+            } else {
+                bit                                           = 1u;  /* Yes, priority no longer present             */
+                bit                                         <<= (DEF_INT_CPU_NBR_BITS - 1u) - ((CPU_DATA)prio & (DEF_INT_CPU_NBR_BITS - 1u));
+                p_pend_list->PrioTbl[prio / (OS_PRIO)DEF_INT_CPU_NBR_BITS] &= ~bit;
+            }
+        }
+#endif
+
+#if ((OS_CFG_FLAG_EN == DEF_ENABLED) && (OS_CFG_FLAG_IDX_EN == DEF_ENABLED))
+        if (p_tcb->FlagsIdxSlot != OS_FLAG_IDX_SLOT_NONE) {     /* Remove from the event flag waiter index              */
+            OS_FlagIdxRemove((OS_FLAG_GRP *)((void *)p_tcb->PendObjPtr),
+                             p_tcb);
+        }
+#endif
                                                                 /* Remove TCB from the pend list.                       */
         if (p_pend_list->HeadPtr->PendNextPtr == (OS_TCB *)0) {
             p_pend_list->HeadPtr = (OS_TCB *)0;                 /* Only one entry in the pend list                      */
@@ -1454,6 +1578,69 @@ void  OS_PendListRemove (OS_TCB  *p_tcb)
 }
 
 
+/*
+************************************************************************************************************************
+*                              FIND WHERE TO INSERT A TASK IN A PRIORITY INDEXED PEND LIST
+*
+* Description: This function returns the task after which a task of priority 'prio' is to be inserted, i.e. the last
+*              task of priority 'prio' or, if there is none, the last task of the nearest higher priority.
+*
+* Arguments  : p_pend_list    is a pointer to the pend list
+*              -----------
+*
+*              prio           is the priority of the task to insert
+*
+* Returns    : A pointer to the TCB to insert after, or a NULL pointer to insert at the head of the list.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) .PrioTbl[] has the same layout as OSPrioTbl[]: priority 0 is the MSB of the first entry.  The higher
+*                 priorities of the same entry are the bits above the one of 'prio'; the nearest of them is the lowest
+*                 set bit.  Other entries are only looked at when OS_CFG_PRIO_MAX exceeds DEF_INT_CPU_NBR_BITS.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_PEND_LIST_BUCKET_EN == DEF_ENABLED)
+static  OS_TCB  *OS_PendListBucketPrevGet (OS_PEND_LIST  *p_pend_list,
+                                           OS_PRIO        prio)
+{
+    CPU_DATA  bit_nbr;
+    CPU_DATA  bits;
+    OS_PRIO   ix;
+
+
+    ix      = prio / (OS_PRIO)DEF_INT_CPU_NBR_BITS;
+    bit_nbr = (CPU_DATA)prio & (DEF_INT_CPU_NBR_BITS - 1u);
+    bits    = p_pend_list->PrioTbl[ix];
+
+    if ((bits & ((CPU_DATA)1u << ((DEF_INT_CPU_NBR_BITS - 1u) - bit_nbr))) != 0u) {
+        return (p_pend_list->PrioTailPtr[prio]);                /* Same priority present, insert after its last task    */
+    }
+
+    if (bit_nbr != 0u) {                                        /* See Note #2                                          */
+        bits >>= DEF_INT_CPU_NBR_BITS - bit_nbr;                /* Keep the higher priorities of this entry only        */
+        if (bits != 0u) {
+            prio = (OS_PRIO)(prio - 1u - (OS_PRIO)CPU_CntTrailZeros(bits));
+            return (p_pend_list->PrioTailPtr[prio]);
+        }
+    }
+#if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
+    while (ix > 0u) {
+        ix--;
+        bits = p_pend_list->PrioTbl[ix];
+        if (bits != 0u) {
+            prio = (OS_PRIO)((ix * (OS_PRIO)DEF_INT_CPU_NBR_BITS) + (OS_PRIO)(DEF_INT_CPU_NBR_BITS - 1u)
+                 - (OS_PRIO)CPU_CntTrailZeros(bits));
+            return (p_pend_list->PrioTailPtr[prio]);
+        }
+    }
+#endif
+
+    return ((OS_TCB *)0);                                       /* No higher priority present, insert at the head       */
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                   POST TO A TASK
@@ -1714,6 +1901,13 @@ void  OS_RdyListInsertHead (OS_TCB  *p_tcb)
 
 
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    if (OS_EDF_PRIO_IN_BAND(p_tcb->Prio)) {                     /* EDF band: ordered by deadline, see os_edf.c          */
+        OS_EdfInsert(p_tcb);
+        return;
+    }
+#endif
+
     p_rdy_list = &OSRdyList[p_tcb->Prio];
     if (p_rdy_list->HeadPtr == (OS_TCB *)0) {                   /* CASE 0: Insert when there are no entries             */
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
@@ -1799,6 +1993,13 @@ void  OS_RdyListInsertTail (OS_TCB  *p_tcb)
 
 
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    if (OS_EDF_PRIO_IN_BAND(p_tcb->Prio)) {                     /* EDF band: ordered by deadline, see os_edf.c          */
+        OS_EdfInsert(p_tcb);
+        return;
+    }
+#endif
+
     p_rdy_list = &OSRdyList[p_tcb->Prio];
     if (p_rdy_list->HeadPtr == (OS_TCB *)0) {                   /* CASE 0: Insert when there are no entries             */
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
@@ -1961,6 +2162,14 @@ void  OS_RdyListRemove (OS_TCB  *p_tcb)
 
 
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    if (p_tcb->EdfHeapIx != OS_EDF_HEAP_IX_NONE) {              /* EDF band: ordered by deadline, see os_edf.c          */
+        OS_EdfRemove(p_tcb);
+        OS_TRACE_TASK_SUSPENDED(p_tcb);
+        return;
+    }
+#endif
+
     p_rdy_list = &OSRdyList[p_tcb->Prio];
     p_tcb1     = p_tcb->PrevPtr;                                /* Point to next and previous OS_TCB in the list        */
     p_tcb2     = p_tcb->NextPtr;
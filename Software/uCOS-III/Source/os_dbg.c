@@ -273,6 +273,9 @@ CPU_INT32U  const  OSDbg_DataSize = sizeof(OSIntNestingCtr)
                                   + sizeof(OSPrioCur)
                                   + sizeof(OSPrioHighRdy)
                                   + sizeof(OSPrioTbl)
+#if (OS_PRIO_GRP_EN == DEF_ENABLED)
+                                  + sizeof(OSPrioGrp)
+#endif
 
 #if (OS_CFG_Q_EN == DEF_ENABLED)
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
@@ -0,0 +1,371 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                          EARLIEST DEADLINE FIRST SCHEDULING
+*
+* File    : OS_EDF.C
+* Version : V3.06.01
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your
+*           application/product.   We provide ALL the source code for your convenience and to help you
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+*
+*           You can find our product's user manual, API reference, release notes and
+*           more information at doc.micrium.com.
+*           You can contact us at www.micrium.com.
+************************************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_edf__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                                    LOCAL DEFINES
+*
+* Note(s) : (1) Deadlines are absolute OSTickCtr values and are compared modulo 2^n: 'a' is earlier than 'b' when
+*               (a - b) is negative, i.e. when both are less than half the OS_TICK range apart.
+************************************************************************************************************************
+*/
+
+#define  OS_EDF_TICK_SIGN          ((OS_TICK)1u << ((sizeof(OS_TICK) * DEF_OCTET_NBR_BITS) - 1u))
+
+#define  OS_EDF_EARLIER(a, b)      (((OS_TICK)((a) - (b)) & OS_EDF_TICK_SIGN) != 0u)
+
+
+/*
+************************************************************************************************************************
+*                                                 FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void  OS_EdfHeadSync (void);
+
+static  void  OS_EdfSiftDown (CPU_INT08U  ix);
+
+static  void  OS_EdfSiftUp   (CPU_INT08U  ix);
+
+
+/*
+************************************************************************************************************************
+*                                             SET THE DEADLINE OF A TASK
+*
+* Description: This function sets the absolute deadline of a task in the EDF band (OS_CFG_SCHED_EDF_PRIO_HI to
+*              OS_CFG_SCHED_EDF_PRIO_LO).  Ready tasks in the band run in order of deadline, the earliest first.
+*
+* Arguments  : p_tcb       is a pointer to the task's OS_TCB.  Specifying a NULL pointer indicates that you wish to
+*                          set the deadline of the calling task.
+*
+*              deadline    is the deadline, in ticks from now.
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE       The call was successful
+*                              OS_ERR_SET_ISR    If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) Periodic tasks (see OSTaskPeriodSet()) don't need to call this function: each release sets the
+*                 deadline to the release tick plus the task's relative deadline.
+*
+*              2) Until a deadline is set, a task is given the tick at which it was created as its deadline.
+************************************************************************************************************************
+*/
+
+void  OSEdfDeadlineSet (OS_TCB   *p_tcb,
+                        OS_TICK   deadline,
+                        OS_ERR   *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {
+        p_tcb = OSTCBCurPtr;
+    }
+#if (OS_CFG_DYN_TICK_EN == DEF_ENABLED)
+    OS_EdfDeadlineSet(p_tcb, BSP_OS_TickGet() + deadline);
+#else
+    OS_EdfDeadlineSet(p_tcb, OSTickCtr        + deadline);
+#endif
+    CPU_CRITICAL_EXIT();
+
+    if (OSRunning == OS_STATE_OS_RUNNING) {
+        OSSched();                                              /* The task may no longer have the earliest deadline    */
+    }
+
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                            CHANGE THE DEADLINE OF A TASK
+*
+* Description: This function changes the absolute deadline of a task and, if the task is in the EDF heap, restores the
+*              heap order.
+*
+* Arguments  : p_tcb       is a pointer to the task's OS_TCB
+*
+*              deadline    is the new absolute deadline (an OSTickCtr value)
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+void  OS_EdfDeadlineSet (OS_TCB   *p_tcb,
+                         OS_TICK   deadline)
+{
+    p_tcb->EdfDeadline = deadline;
+    if (p_tcb->EdfHeapIx != OS_EDF_HEAP_IX_NONE) {
+        OS_EdfSiftUp(p_tcb->EdfHeapIx);
+        OS_EdfSiftDown(p_tcb->EdfHeapIx);
+        OS_EdfHeadSync();
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 INITIALIZE EDF CLASS
+*
+* Description: This function is called by OSInit() to initialize the EDF heap.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_EdfInit (void)
+{
+    CPU_INT08U  ix;
+
+
+    for (ix = 0u; ix < OS_CFG_SCHED_EDF_TASK_MAX; ix++) {
+        OSEdfHeap[ix] = (OS_TCB *)0;
+    }
+    OSEdfHeapQty = 0u;
+    OSEdfTaskQty = 0u;
+}
+
+
+/*
+************************************************************************************************************************
+*                                            INSERT A TASK IN THE EDF HEAP
+*
+* Description: This function is called by OS_RdyListInsertHead() and OS_RdyListInsertTail() to make a task of the EDF
+*              band ready-to-run.
+*
+*              The heap is a binary min-heap of OS_TCB pointers ordered by .EdfDeadline.  Its root, the ready task with
+*              the earliest deadline, is kept as the only entry of OSRdyList[OS_CFG_SCHED_EDF_PRIO_HI] so that
+*              OSSched(), OSIntExit() and round-robin need no change: the whole band is seen as one priority level.
+*
+* Arguments  : p_tcb       is a pointer to the OS_TCB to insert
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+*
+*              3) The heap can't overflow: OSTaskCreate() and OSTaskChangePrio() limit to OS_CFG_SCHED_EDF_TASK_MAX the
+*                 number of tasks whose base priority is in the band, and a task outside the band only enters it by
+*                 inheriting the priority of a task of the band that is blocked on one of its mutexes.
+************************************************************************************************************************
+*/
+
+void  OS_EdfInsert (OS_TCB  *p_tcb)
+{
+    CPU_INT08U  ix;
+
+
+    ix                 = OSEdfHeapQty;                          /* Append, then move up to its place                    */
+    OSEdfHeapQty++;
+    OSEdfHeap[ix]      = p_tcb;
+    p_tcb->EdfHeapIx   = ix;
+    p_tcb->NextPtr     = (OS_TCB *)0;                           /* Not linked in a ready list                           */
+    p_tcb->PrevPtr     = (OS_TCB *)0;
+    OS_EdfSiftUp(ix);
+    OS_EdfHeadSync();
+}
+
+
+/*
+************************************************************************************************************************
+*                                           REMOVE A TASK FROM THE EDF HEAP
+*
+* Description: This function is called by OS_RdyListRemove() for a task that is in the EDF heap.
+*
+* Arguments  : p_tcb       is a pointer to the OS_TCB to remove
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+void  OS_EdfRemove (OS_TCB  *p_tcb)
+{
+    CPU_INT08U   ix;
+    OS_TCB      *p_tcb_last;
+
+
+    ix = p_tcb->EdfHeapIx;
+    OSEdfHeapQty--;
+    p_tcb_last = OSEdfHeap[OSEdfHeapQty];                       /* Fill the hole with the last entry ...                */
+    OSEdfHeap[OSEdfHeapQty] = (OS_TCB *)0;
+    if (p_tcb_last != p_tcb) {
+        OSEdfHeap[ix]         = p_tcb_last;
+        p_tcb_last->EdfHeapIx = ix;
+        OS_EdfSiftUp(ix);                                       /* ... and move it up or down to its place              */
+        OS_EdfSiftDown(p_tcb_last->EdfHeapIx);
+    }
+    p_tcb->EdfHeapIx = OS_EDF_HEAP_IX_NONE;
+
+    OS_EdfHeadSync();
+    if (OSEdfHeapQty == 0u) {
+        OS_PrioRemove(OS_CFG_SCHED_EDF_PRIO_HI);                /* No more ready tasks in the band                      */
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                        PUBLISH THE EARLIEST DEADLINE TASK
+*
+* Description: This function makes the root of the EDF heap the only entry of OSRdyList[OS_CFG_SCHED_EDF_PRIO_HI].
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+static  void  OS_EdfHeadSync (void)
+{
+    OS_RDY_LIST  *p_rdy_list;
+
+
+    p_rdy_list = &OSRdyList[OS_CFG_SCHED_EDF_PRIO_HI];
+    if (OSEdfHeapQty > 0u) {
+        p_rdy_list->HeadPtr = OSEdfHeap[0];
+    } else {
+        p_rdy_list->HeadPtr = (OS_TCB *)0;
+    }
+    p_rdy_list->TailPtr     = p_rdy_list->HeadPtr;              /* Round-robin sees a single task at this level         */
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_rdy_list->NbrEntries  = OSEdfHeapQty;
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                                 RESTORE HEAP ORDER
+*
+* Description: OS_EdfSiftUp() moves the entry at 'ix' towards the root while its deadline is earlier than its parent's.
+*              OS_EdfSiftDown() moves it towards the leaves while a child has an earlier deadline.
+*
+* Arguments  : ix          is the index of the entry to move
+*
+* Returns    : none
+*
+* Note(s)    : none
+************************************************************************************************************************
+*/
+
+static  void  OS_EdfSiftUp (CPU_INT08U  ix)
+{
+    OS_TCB      *p_tcb;
+    CPU_INT08U   ix_parent;
+
+
+    p_tcb = OSEdfHeap[ix];
+    while (ix > 0u) {
+        ix_parent = (CPU_INT08U)((ix - 1u) / 2u);
+        if (OS_EDF_EARLIER(p_tcb->EdfDeadline, OSEdfHeap[ix_parent]->EdfDeadline) == DEF_FALSE) {
+            break;
+        }
+        OSEdfHeap[ix]            = OSEdfHeap[ix_parent];        /* Move the parent down                                 */
+        OSEdfHeap[ix]->EdfHeapIx = ix;
+        ix                       = ix_parent;
+    }
+    OSEdfHeap[ix]    = p_tcb;
+    p_tcb->EdfHeapIx = ix;
+}
+
+
+static  void  OS_EdfSiftDown (CPU_INT08U  ix)
+{
+    OS_TCB      *p_tcb;
+    CPU_INT16U   ix_child;
+
+
+    p_tcb = OSEdfHeap[ix];
+    while (DEF_ON) {
+        ix_child = (CPU_INT16U)(((CPU_INT16U)ix * 2u) + 1u);
+        if (ix_child >= OSEdfHeapQty) {
+            break;
+        }
+        if (((ix_child + 1u) < OSEdfHeapQty) &&                 /* Pick the child with the earliest deadline            */
+            (OS_EDF_EARLIER(OSEdfHeap[ix_child + 1u]->EdfDeadline, OSEdfHeap[ix_child]->EdfDeadline) == DEF_TRUE)) {
+            ix_child++;
+        }
+        if (OS_EDF_EARLIER(OSEdfHeap[ix_child]->EdfDeadline, p_tcb->EdfDeadline) == DEF_FALSE) {
+            break;
+        }
+        OSEdfHeap[ix]            = OSEdfHeap[ix_child];         /* Move the child up                                    */
+        OSEdfHeap[ix]->EdfHeapIx = ix;
+        ix                       = (CPU_INT08U)ix_child;
+    }
+    OSEdfHeap[ix]    = p_tcb;
+    p_tcb->EdfHeapIx = ix;
+}
+
+#endif
@@ -42,6 +42,22 @@ const  CPU_CHAR  *os_flag__c = "$Id: $";
 
 #if (OS_CFG_FLAG_EN == DEF_ENABLED)
 
+#if (OS_CFG_FLAG_64_EN == DEF_ENABLED)
+#define  OS_FLAG_BIT_NBR_LOWEST(flags)          CPU_CntTrailZeros64((CPU_INT64U)(flags))
+#else
+#define  OS_FLAG_BIT_NBR_LOWEST(flags)          CPU_CntTrailZeros((CPU_DATA)(flags))
+#endif
+
+/*
+************************************************************************************************************************
+*                                                 FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_FlagTaskChk (OS_FLAG_GRP  *p_grp,
+                                     OS_TCB       *p_tcb,
+                                     CPU_TS        ts);
+
 /*
 ************************************************************************************************************************
 *                                                 CREATE AN EVENT FLAG
@@ -116,6 +132,9 @@ void  OSFlagCreate (OS_FLAG_GRP  *p_grp,
     p_grp->TS      = 0u;
 #endif
     OS_PendListInit(&p_grp->PendList);
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    OS_FlagIdxInit(p_grp);
+#endif
 
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OS_FlagDbgListAdd(p_grp);
@@ -228,7 +247,7 @@ OS_OBJ_QTY  OSFlagDel (OS_FLAG_GRP  *p_grp,
     nbr_tasks   = 0u;
     switch (opt) {
         case OS_OPT_DEL_NO_PEND:                                /* Delete group if no task waiting                      */
-             if (p_pend_list->HeadPtr == (OS_TCB *)0) {
+             if (OS_PEND_LIST_IS_EMPTY(p_pend_list)) {
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
                  OS_FlagDbgListRemove(p_grp);
                  OSFlagQty--;
@@ -258,6 +277,13 @@ OS_OBJ_QTY  OSFlagDel (OS_FLAG_GRP  *p_grp,
                               OS_STATUS_PEND_DEL);
                  nbr_tasks++;
              }
+#if (OS_CFG_PEND_MULTI_EN == DEF_ENABLED)
+                                                                /* ... and all the tasks waiting in OSPendMulti()       */
+             nbr_tasks += OS_PendMultiAbortObj((OS_PEND_OBJ *)((void *)p_grp),
+                                               ts,
+                                               OS_STATUS_PEND_DEL,
+                                               DEF_YES);
+#endif
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
              OS_FlagDbgListRemove(p_grp);
              OSFlagQty--;
@@ -797,7 +823,7 @@ OS_OBJ_QTY  OSFlagPendAbort (OS_FLAG_GRP  *p_grp,
 
     CPU_CRITICAL_ENTER();
     p_pend_list = &p_grp->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on flag group?                      */
+    if (OS_PEND_LIST_IS_EMPTY(p_pend_list)) {                   /* Any task waiting on flag group?                      */
         CPU_CRITICAL_EXIT();                                    /* No                                                   */
        *p_err = OS_ERR_PEND_ABORT_NONE;
         return (0u);
@@ -810,7 +836,15 @@ OS_OBJ_QTY  OSFlagPendAbort (OS_FLAG_GRP  *p_grp,
     ts        = 0u;
 #endif
 
-    while (p_pend_list->HeadPtr != (OS_TCB *)0) {
+#if (OS_CFG_PEND_MULTI_EN == DEF_ENABLED)
+                                                                /* Tasks in OSPendMulti() first if higher priority      */
+    nbr_tasks = OS_PendMultiAbortObj((OS_PEND_OBJ *)((void *)p_grp),
+                                     ts,
+                                     OS_STATUS_PEND_ABORT,
+                                     (opt == OS_OPT_PEND_ABORT_ALL) ? DEF_YES : DEF_NO);
+#endif
+    while ((p_pend_list->HeadPtr != (OS_TCB *)0) &&
+           ((nbr_tasks == 0u) || (opt == OS_OPT_PEND_ABORT_ALL))) {
         p_tcb = p_pend_list->HeadPtr;
         OS_PendAbort(p_tcb,
                      ts,
@@ -925,6 +959,10 @@ OS_FLAGS  OSFlagPendGetFlagsRdy (OS_ERR  *p_err)
 * Returns    : the new value of the event flags bits that are still set.
 *
 * Note(s)    : 1) The execution time of this function depends on the number of tasks waiting on the event flag group.
+*
+*              2) With OS_CFG_FLAG_IDX_EN, only the tasks waiting on at least one of the bits in 'flags' are checked, so
+*                 the execution time depends on the number of those tasks only.  All the waiting tasks are checked if
+*                 more than OS_FLAG_IDX_SLOT_NBR tasks wait on the group.
 ************************************************************************************************************************
 */
 
@@ -935,12 +973,22 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
 {
 
     OS_FLAGS       flags_cur;
-    OS_FLAGS       flags_rdy;
-    OS_OPT         mode;
     OS_PEND_LIST  *p_pend_list;
     OS_TCB        *p_tcb;
     OS_TCB        *p_tcb_next;
+    CPU_BOOLEAN    valid;
     CPU_TS         ts;
+#if (OS_CFG_PEND_MULTI_EN == DEF_ENABLED)
+    OS_PEND_DATA  *p_pend_data;
+    OS_PEND_DATA  *p_pend_data_next;
+    OS_FLAGS       flags_rdy;
+#endif
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    OS_FLAGS       bits;
+    CPU_DATA       slots;
+    CPU_DATA       slot;
+    CPU_DATA       slot_bit;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -980,11 +1028,26 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
 #endif
 
 #if (OS_CFG_TS_EN == DEF_ENABLED)
-    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+    ts = OS_POST_TS_GET();                                      /* Get timestamp                                        */
 #else
     ts = 0u;
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Called from an ISR?                                  */
+        OS_IntQPost(OS_OBJ_TYPE_FLAG,                           /* Yes, defer the post to the ISR handler task        */
+                    (void *)p_grp,
+                    (void *)0,
+                    0u,
+                    flags,
+                    opt,
+                    ts,
+                    p_err);
+        OS_TRACE_FLAG_POST_EXIT(*p_err);
+        return (0u);
+    }
+#endif
+
     OS_TRACE_FLAG_POST(p_grp);
 
     switch (opt) {
@@ -1009,63 +1072,65 @@ OS_FLAGS  OSFlagPost (OS_FLAG_GRP  *p_grp,
     p_grp->TS   = ts;
 #endif
     p_pend_list = &p_grp->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on event flag group?                */
+    if (OS_PEND_LIST_IS_EMPTY(p_pend_list)) {                   /* Any task waiting on event flag group?                */
         CPU_CRITICAL_EXIT();                                    /* No                                                   */
        *p_err = OS_ERR_NONE;
         OS_TRACE_FLAG_POST_EXIT(*p_err);
         return (p_grp->Flags);
     }
 
-    p_tcb = p_pend_list->HeadPtr;
-    while (p_tcb != (OS_TCB *)0) {                              /* Go through all tasks waiting on event flag(s)        */
-        p_tcb_next = p_tcb->PendNextPtr;
-        mode       = p_tcb->FlagsOpt & OS_OPT_PEND_FLAG_MASK;
-        switch (mode) {
-            case OS_OPT_PEND_FLAG_SET_ALL:                      /* See if all req. flags are set for current node       */
-                 flags_rdy = (p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy == p_tcb->FlagsPend) {
-                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
-                                    flags_rdy,
-                                    ts);
-                 }
-                 break;
-
-            case OS_OPT_PEND_FLAG_SET_ANY:                      /* See if any flag set                                  */
-                 flags_rdy = (p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy != 0u) {
-                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
-                                    flags_rdy,
-                                    ts);
-                 }
-                 break;
-
-#if (OS_CFG_FLAG_MODE_CLR_EN == DEF_ENABLED)
-            case OS_OPT_PEND_FLAG_CLR_ALL:                      /* See if all req. flags are set for current node       */
-                 flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy == p_tcb->FlagsPend) {
-                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
-                                    flags_rdy,
-                                    ts);
-                 }
-                 break;
-
-            case OS_OPT_PEND_FLAG_CLR_ANY:                      /* See if any flag set                                  */
-                 flags_rdy = (OS_FLAGS)(~p_grp->Flags & p_tcb->FlagsPend);
-                 if (flags_rdy != 0u) {
-                     OS_FlagTaskRdy(p_tcb,                      /* Make task RTR, event(s) Rx'd                         */
-                                    flags_rdy,
-                                    ts);
-                 }
-                 break;
+    valid = DEF_OK;
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    if (p_grp->IdxOvfCtr == 0u) {                               /* All waiters indexed, see Note #2                     */
+        slots = 0u;
+        bits  = flags;
+        while (bits != 0u) {                                    /* Slots of the tasks waiting on any of the bits        */
+            slots |= p_grp->IdxTbl[OS_FLAG_BIT_NBR_LOWEST(bits)];
+            bits  &= bits - 1u;
+        }
+        while ((slots != 0u) &&
+               (valid == DEF_OK)) {
+            slot       = CPU_CntLeadZeros(slots);
+            slot_bit   = 1u;
+            slot_bit <<= (DEF_INT_CPU_NBR_BITS - 1u) - slot;
+            slots     &= ~slot_bit;
+            valid      = OS_FlagTaskChk(p_grp, p_grp->IdxTCBTbl[slot], ts);
+        }
+    } else
 #endif
-            default:
-                 CPU_CRITICAL_EXIT();
-                *p_err = OS_ERR_FLAG_PEND_OPT;
-                 OS_TRACE_FLAG_POST_EXIT(*p_err);
-                 return (0u);
+    {
+        p_tcb = p_pend_list->HeadPtr;
+        while ((p_tcb != (OS_TCB *)0) &&                        /* Go through all tasks waiting on event flag(s)        */
+               (valid == DEF_OK)) {
+            p_tcb_next = p_tcb->PendNextPtr;
+            valid      = OS_FlagTaskChk(p_grp, p_tcb, ts);
+            p_tcb      = p_tcb_next;                            /* Point to next task waiting for event flag(s)         */
         }
-                                                                /* Point to next task waiting for event flag(s)         */
-        p_tcb = p_tcb_next;
+    }
+#if (OS_CFG_PEND_MULTI_EN == DEF_ENABLED)
+    p_pend_data = p_pend_list->MultiHeadPtr;
+    while ((p_pend_data != (OS_PEND_DATA *)0) &&                /* Go through all tasks waiting in OSPendMulti()        */
+           (valid       == DEF_OK)) {
+        p_pend_data_next = p_pend_data->NextPtr;
+        valid            = OS_FlagRdyChk(p_grp,
+                                         p_pend_data->FlagsPend,
+                                         p_pend_data->FlagsOpt,
+                                        &flags_rdy);
+        if (flags_rdy != 0u) {
+            p_pend_data->RdyFlags = flags_rdy;
+            OS_PendMultiPost(p_pend_data,                       /* Make task RTR, event(s) Rx'd                         */
+                             (void *)0,
+                             0u,
+                             ts);
+        }
+        p_pend_data = p_pend_data_next;
+    }
+#endif
+    if (valid != DEF_OK) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_FLAG_PEND_OPT;
+        OS_TRACE_FLAG_POST_EXIT(*p_err);
+        return (0u);
     }
     CPU_CRITICAL_EXIT();
 
@@ -1128,6 +1193,9 @@ void  OS_FlagBlock (OS_FLAG_GRP  *p_grp,
     OS_Pend((OS_PEND_OBJ *)((void *)p_grp),
              OS_TASK_PEND_ON_FLAG,
              timeout);
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    OS_FlagIdxAdd(p_grp, OSTCBCurPtr);                          /* Index the task by the flags it waits on              */
+#endif
 }
 
 
@@ -1161,9 +1229,121 @@ void  OS_FlagClr (OS_FLAG_GRP  *p_grp)
     p_grp->Flags            =  0u;
     p_pend_list             = &p_grp->PendList;
     OS_PendListInit(p_pend_list);
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    OS_FlagIdxInit(p_grp);
+#endif
 }
 
 
+/*
+************************************************************************************************************************
+*                                         INDEX EVENT FLAG WAITERS BY FLAG BIT
+*
+* Description: These functions maintain the per-bit index of the tasks waiting on an event flag group.  Each waiting
+*              task occupies one of OS_FLAG_IDX_SLOT_NBR slots and, for every bit in its .FlagsPend, the bit of its slot
+*              is set in .IdxTbl[].  OSFlagPost() then only checks the tasks found in the entries of the posted bits.
+*
+*              OS_FlagIdxInit()    clears the index of a group
+*              OS_FlagIdxAdd()     adds a task that was just placed in the pend list of the group
+*              OS_FlagIdxRemove()  removes a task that is being removed from the pend list of the group
+*
+* Arguments  : p_grp     is a pointer to the event flag group
+*              -----
+*
+*              p_tcb     is a pointer to the OS_TCB of the task to add/remove
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application should not call them.
+*
+*              2) When all the slots are in use, the task is marked OS_FLAG_IDX_SLOT_OVF and only counted.  While
+*                 .IdxOvfCtr is not 0, OSFlagPost() checks all the tasks in the pend list.
+*
+*              3) OS_FlagIdxRemove() is called by OS_PendListRemove() so that tasks leaving the pend list for any reason
+*                 (post, timeout, abort, deletion) are removed from the index.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+void  OS_FlagIdxInit (OS_FLAG_GRP  *p_grp)
+{
+    CPU_DATA  i;
+
+
+    for (i = 0u; i < OS_FLAG_NBR_BITS; i++) {
+        p_grp->IdxTbl[i] = 0u;
+    }
+    for (i = 0u; i < OS_FLAG_IDX_SLOT_NBR; i++) {
+        p_grp->IdxTCBTbl[i] = (OS_TCB *)0;
+    }
+    p_grp->IdxUsed   = 0u;
+    p_grp->IdxOvfCtr = 0u;
+}
+
+
+void  OS_FlagIdxAdd (OS_FLAG_GRP  *p_grp,
+                     OS_TCB       *p_tcb)
+{
+    OS_FLAGS  bits;
+    CPU_DATA  slot;
+    CPU_DATA  slot_bit;
+
+
+    if (p_grp->IdxUsed == DEF_INT_CPU_U_MAX_VAL) {              /* All slots in use, see Note #2                        */
+        p_tcb->FlagsIdxSlot = OS_FLAG_IDX_SLOT_OVF;
+        p_grp->IdxOvfCtr++;
+        return;
+    }
+
+    slot       = CPU_CntLeadZeros(~p_grp->IdxUsed);             /* Lowest numbered free slot                            */
+    slot_bit   = 1u;
+    slot_bit <<= (DEF_INT_CPU_NBR_BITS - 1u) - slot;
+    p_grp->IdxUsed        |= slot_bit;
+    p_grp->IdxTCBTbl[slot] = p_tcb;
+    p_tcb->FlagsIdxSlot    = (CPU_INT08U)slot;
+
+    bits = p_tcb->FlagsPend;
+    while (bits != 0u) {                                        /* Index the slot under every flag the task waits on    */
+        p_grp->IdxTbl[OS_FLAG_BIT_NBR_LOWEST(bits)] |= slot_bit;
+        bits &= bits - 1u;
+    }
+}
+
+
+void  OS_FlagIdxRemove (OS_FLAG_GRP  *p_grp,
+                        OS_TCB       *p_tcb)
+{
+    OS_FLAGS  bits;
+    CPU_DATA  slot;
+    CPU_DATA  slot_bit;
+
+
+    if (p_tcb->FlagsIdxSlot == OS_FLAG_IDX_SLOT_NONE) {         /* Task is not indexed                                  */
+        return;
+    }
+    if (p_tcb->FlagsIdxSlot == OS_FLAG_IDX_SLOT_OVF) {
+        p_grp->IdxOvfCtr--;
+        p_tcb->FlagsIdxSlot = OS_FLAG_IDX_SLOT_NONE;
+        return;
+    }
+
+    slot       = (CPU_DATA)p_tcb->FlagsIdxSlot;
+    slot_bit   = 1u;
+    slot_bit <<= (DEF_INT_CPU_NBR_BITS - 1u) - slot;
+    p_grp->IdxUsed        &= ~slot_bit;
+    p_grp->IdxTCBTbl[slot] = (OS_TCB *)0;
+    p_tcb->FlagsIdxSlot    = OS_FLAG_IDX_SLOT_NONE;
+
+    bits = p_tcb->FlagsPend;
+    while (bits != 0u) {
+        p_grp->IdxTbl[OS_FLAG_BIT_NBR_LOWEST(bits)] &= ~slot_bit;
+        bits &= bits - 1u;
+    }
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                    ADD/REMOVE EVENT FLAG GROUP TO/FROM DEBUG LIST
@@ -1285,4 +1465,112 @@ void   OS_FlagTaskRdy (OS_TCB    *p_tcb,
     }
     OS_PendListRemove(p_tcb);
 }
+
+
+/*
+************************************************************************************************************************
+*                                  DETERMINE THE FLAGS THAT SATISFY A WAIT CONDITION
+*
+* Description: This function is called to find out whether the state of an event flag group satisfies a wait
+*              condition.
+*
+* Arguments  : p_grp         is a pointer to the event flag group
+*              -----
+*
+*              flags_pend    contains the bit pattern of the event flags waited on
+*
+*              opt           is the wait option (OS_OPT_PEND_FLAG_xxx, other bits are ignored)
+*
+*              p_flags_rdy   is a pointer to where the flags that satisfy the condition are returned, or 0 if the
+*              -----------   condition is not satisfied
+*
+* Returns    : DEF_OK        if 'opt' is valid
+*              DEF_FAIL      otherwise
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OS_FlagRdyChk (OS_FLAG_GRP  *p_grp,
+                            OS_FLAGS      flags_pend,
+                            OS_OPT        opt,
+                            OS_FLAGS     *p_flags_rdy)
+{
+    OS_FLAGS  flags_rdy;
+
+
+    switch (opt & OS_OPT_PEND_FLAG_MASK) {
+        case OS_OPT_PEND_FLAG_SET_ALL:                          /* See if all req. flags are set                        */
+             flags_rdy = (p_grp->Flags & flags_pend);
+             if (flags_rdy != flags_pend) {
+                 flags_rdy = 0u;
+             }
+             break;
+
+        case OS_OPT_PEND_FLAG_SET_ANY:                          /* See if any flag set                                  */
+             flags_rdy = (p_grp->Flags & flags_pend);
+             break;
+
+#if (OS_CFG_FLAG_MODE_CLR_EN == DEF_ENABLED)
+        case OS_OPT_PEND_FLAG_CLR_ALL:                          /* See if all req. flags are cleared                    */
+             flags_rdy = (OS_FLAGS)(~p_grp->Flags & flags_pend);
+             if (flags_rdy != flags_pend) {
+                 flags_rdy = 0u;
+             }
+             break;
+
+        case OS_OPT_PEND_FLAG_CLR_ANY:                          /* See if any flag cleared                              */
+             flags_rdy = (OS_FLAGS)(~p_grp->Flags & flags_pend);
+             break;
+#endif
+        default:
+            *p_flags_rdy = 0u;
+             return (DEF_FAIL);
+    }
+   *p_flags_rdy = flags_rdy;
+    return (DEF_OK);
+}
+
+
+/*
+************************************************************************************************************************
+*                                 CHECK WHETHER A WAITING TASK CAN BE MADE READY-TO-RUN
+*
+* Description: This function is called by OSFlagPost() to check whether the flags a task waits on are in the state it
+*              requested and, if so, to make the task ready-to-run.
+*
+* Arguments  : p_grp         is a pointer to the event flag group
+*              -----
+*
+*              p_tcb         is a pointer to the OS_TCB of the waiting task
+*              -----
+*
+*              ts            is a timestamp associated with the post
+*
+* Returns    : DEF_OK        if the task's pend option is valid
+*              DEF_FAIL      otherwise
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  OS_FlagTaskChk (OS_FLAG_GRP  *p_grp,
+                                     OS_TCB       *p_tcb,
+                                     CPU_TS        ts)
+{
+    OS_FLAGS     flags_rdy;
+    CPU_BOOLEAN  valid;
+
+
+    valid = OS_FlagRdyChk(p_grp,
+                          p_tcb->FlagsPend,
+                          p_tcb->FlagsOpt,
+                         &flags_rdy);
+    if (flags_rdy != 0u) {
+        OS_FlagTaskRdy(p_tcb,                                   /* Make task RTR, event(s) Rx'd                         */
+                       flags_rdy,
+                       ts);
+    }
+    return (valid);
+}
 #endif
@@ -0,0 +1,429 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                                 DEFERRED ISR POSTS
+*
+* File    : OS_INT.C
+* Version : V3.06.01
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your
+*           application/product.   We provide ALL the source code for your convenience and to help you
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+*
+*           You can find our product's user manual, API reference, release notes and
+*           more information at doc.micrium.com.
+*           You can contact us at www.micrium.com.
+************************************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_int__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                                    LOCAL DEFINES
+*
+* Note(s) : (1) ISRs reserve ISR post queue entries with a compare-and-swap on OSIntQInIx (see OS_IntQPost() Note #2).
+*               The port provides OS_CPU_AtomicCmpSwap32(), based on LDREX/STREX on ARMv7-M.  Builds without it, such
+*               as host simulations, fall back on C11 atomics.
+************************************************************************************************************************
+*/
+
+#if   defined(OS_CPU_ATOMIC_CMP_SWAP_ASM_PRESENT)               /* See Note #1.                                         */
+#define  OS_INT_CMP_SWAP(p_val, val_cmp, val_new)    OS_CPU_AtomicCmpSwap32((p_val), (val_cmp), (val_new))
+#elif (defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__))
+#include  <stdatomic.h>
+#define  OS_INT_CMP_SWAP(p_val, val_cmp, val_new)    OS_IntCmpSwap((p_val), (val_cmp), (val_new))
+
+static  CPU_BOOLEAN  OS_IntCmpSwap (CPU_INT32U  *p_val,
+                                    CPU_INT32U   val_cmp,
+                                    CPU_INT32U   val_new)
+{
+    return ((atomic_compare_exchange_strong((_Atomic CPU_INT32U *)p_val, &val_cmp, val_new) != 0) ? DEF_TRUE : DEF_FALSE);
+}
+#else
+#error  "OS_CFG_ISR_POST_DEFERRED_EN requires OS_CPU_AtomicCmpSwap32() in the port or C11 atomics"
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                                 FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  void  OS_IntQRePost (OS_INT_Q  *p_int_q);
+
+
+/*
+************************************************************************************************************************
+*                                                   POST FROM AN ISR
+*
+* Description: This function is called by OSFlagPost(), OSQPost(), OSSemPost(), OSTaskQPost() and OSTaskSemPost() when
+*              they are called from an ISR.  Instead of readying the task(s) waiting on the object, it saves the post in
+*              the ISR post queue and makes the ISR handler task ready-to-run.  The ISR handler task runs at priority 0
+*              as soon as the last nested ISR returns, and performs the post at task level.
+*
+* Arguments  : type      is the type of object posted to:
+*
+*                            OS_OBJ_TYPE_FLAG          Event flag group
+*                            OS_OBJ_TYPE_Q             Message queue
+*                            OS_OBJ_TYPE_SEM           Semaphore
+*                            OS_OBJ_TYPE_TASK_MSG      Task message queue
+*                            OS_OBJ_TYPE_TASK_SIGNAL   Task semaphore
+*
+*              p_obj     is a pointer to the object (or OS_TCB) posted to
+*
+*              p_void    is the message posted (message queues) or the count posted by OSSemPostN() (semaphores)
+*
+*              msg_size  is the size of the message posted (message queues only)
+*
+*              flags     are the flags posted (event flag groups only)
+*
+*              opt       is the option of the post
+*
+*              ts        is the timestamp taken by the post function in the ISR
+*
+*              p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE          The post was queued
+*                            OS_ERR_INT_Q_FULL    The ISR post queue is full, the post is lost
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) The ISR post queue is a ring of OS_CFG_INT_Q_SIZE entries, one of them always free.  ISRs, which may
+*                 nest, write entries at OSIntQInIx and the ISR handler task, its only reader, frees them at OSIntQOutIx.
+*                 The ring is lock-free:
+*
+*                 a) An ISR reserves the entry at OSIntQInIx by advancing OSIntQInIx with a compare-and-swap.  A nested
+*                    ISR that reserves an entry in between makes the compare-and-swap fail and the ISR retries with the
+*                    next entry.  CPU_AtomicFetchAdd32() can NOT reserve entries: it would advance OSIntQInIx past a full
+*                    ring, and past the end of the ring, before the ISR could check either.
+*
+*                 b) The ISR then fills (commits) the entry it reserved.  The ISR handler task only runs once the last
+*                    nested ISR returned, so it never reads a reserved entry that is not committed yet.
+*
+*                 c) The statistics are updated with CPU_AtomicFetchAdd32() or a compare-and-swap as well.
+*
+*              3) Interrupts are only disabled to insert the ISR handler task in the ready list, by the first post made
+*                 while the task is not ready; OSIntQTaskRdy is claimed with a compare-and-swap so that a nested ISR
+*                 does not insert the task twice.  The ISR handler task checks that the ring is empty and clears
+*                 OSIntQTaskRdy in the same critical section, so no post can be left in the ring without the task ready.
+************************************************************************************************************************
+*/
+
+void  OS_IntQPost (OS_OBJ_TYPE   type,
+                   void         *p_obj,
+                   void         *p_void,
+                   OS_MSG_SIZE   msg_size,
+                   OS_FLAGS      flags,
+                   OS_OPT        opt,
+                   CPU_TS        ts,
+                   OS_ERR       *p_err)
+{
+    OS_INT_Q    *p_int_q;
+    CPU_INT32U   in_ix;
+    CPU_INT32U   in_ix_next;
+    CPU_INT32U   out_ix;
+    CPU_INT32U   nbr_entries;
+    CPU_INT32U   nbr_entries_max;
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_TS_EN == DEF_DISABLED)
+    (void)ts;                                                   /* Prevent compiler warning for not using 'ts'          */
+#endif
+
+    do {                                                        /* Reserve an entry, see Note #2a                       */
+        in_ix      = OSIntQInIx;
+        out_ix     = OSIntQOutIx;
+        in_ix_next = in_ix + 1u;
+        if (in_ix_next >= OSCfg_IntQSize) {
+            in_ix_next = 0u;
+        }
+        if (in_ix_next == out_ix) {                             /* Is the ISR post queue full?                          */
+            (void)CPU_AtomicFetchAdd32(&OSIntQOvfCtr, 1u);      /* Yes, the post is lost                                */
+           *p_err = OS_ERR_INT_Q_FULL;
+            return;
+        }
+    } while (OS_INT_CMP_SWAP(&OSIntQInIx, in_ix, in_ix_next) == DEF_FALSE);
+
+    p_int_q          = &OSCfg_IntQBasePtr[in_ix];               /* Commit the post, see Note #2b                        */
+    p_int_q->Type    =  type;
+    p_int_q->ObjPtr  =  p_obj;
+    p_int_q->MsgPtr  =  p_void;
+    p_int_q->MsgSize =  msg_size;
+    p_int_q->Flags   =  flags;
+    p_int_q->Opt     =  opt;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    p_int_q->TS      =  ts;
+#endif
+
+    if (in_ix_next >= out_ix) {                                 /* Keep track of the peak number of entries             */
+        nbr_entries = in_ix_next - out_ix;
+    } else {
+        nbr_entries = (in_ix_next + OSCfg_IntQSize) - out_ix;
+    }
+    nbr_entries_max = OSIntQNbrEntriesMax;
+    while ((nbr_entries_max < nbr_entries) &&
+           (OS_INT_CMP_SWAP(&OSIntQNbrEntriesMax, nbr_entries_max, nbr_entries) == DEF_FALSE)) {
+        nbr_entries_max = OSIntQNbrEntriesMax;
+    }
+
+    if (OS_INT_CMP_SWAP(&OSIntQTaskRdy, DEF_FALSE, DEF_TRUE) == DEF_TRUE) {
+        CPU_CRITICAL_ENTER();                                   /* Make the ISR handler task ready-to-run, see Note #3  */
+        OS_RdyListInsert(&OSIntQTaskTCB);
+        CPU_CRITICAL_EXIT();
+    }
+   *p_err = OS_ERR_NONE;
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  ISR HANDLER TASK
+*
+* Description: This task is internal to uC/OS-III and performs, at task level, the posts made from ISRs.  It runs at
+*              priority 0 and is only in the ready list while the ISR post queue is not empty.
+*
+* Arguments  : p_arg     is an argument passed to the task when the task is created (unused).
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) An entry is freed only once re-posted, so ISRs never overwrite the entry being re-posted.
+*
+*              3) See OS_IntQPost() Note #3.
+************************************************************************************************************************
+*/
+
+void  OS_IntQTask (void  *p_arg)
+{
+    OS_INT_Q  *p_int_q;
+    CPU_SR_ALLOC();
+
+
+    (void)p_arg;                                                /* Prevent compiler warning                             */
+
+    for (;;) {
+        CPU_CRITICAL_ENTER();                                   /* See Note #3                                          */
+        if (OSIntQOutIx == OSIntQInIx) {                        /* Is the ISR post queue empty?                         */
+            OS_RdyListRemove(&OSIntQTaskTCB);                   /* Yes, wait for the next ISR post                      */
+            OSIntQTaskRdy = DEF_FALSE;
+            CPU_CRITICAL_EXIT();
+            OSSched();                                          /* Run the highest priority task ready                  */
+        } else {
+            CPU_CRITICAL_EXIT();
+            p_int_q = &OSCfg_IntQBasePtr[OSIntQOutIx];
+            OS_IntQRePost(p_int_q);                             /* No,  perform the post                                */
+            if (OSIntQOutIx >= (OSCfg_IntQSize - 1u)) {         /* Free the entry, see Note #2                          */
+                OSIntQOutIx = 0u;
+            } else {
+                OSIntQOutIx++;
+            }
+        }
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                            INITIALIZE THE ISR HANDLER TASK
+*
+* Description: This function is called by OSInit() to initialize the ISR post queue and create the ISR handler task.
+*
+* Arguments  : p_err     is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE                     Initialization was successful
+*                            OS_ERR_INT_Q                    OSCfg_IntQBasePtr is NULL
+*                            OS_ERR_INT_Q_SIZE               OSCfg_IntQSize is less than 2
+*                            OS_ERR_INT_Q_STK_INVALID        OSCfg_IntQTaskStkBasePtr is NULL
+*                            OS_ERR_INT_Q_STK_SIZE_INVALID   OSCfg_IntQTaskStkSize is less than OSCfg_StkSizeMin
+*                            Other                           Error codes returned by OSTaskCreate()
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_IntQTaskInit (OS_ERR  *p_err)
+{
+    OSIntQInIx          = 0u;
+    OSIntQOutIx         = 0u;
+    OSIntQNbrEntriesMax = 0u;
+    OSIntQOvfCtr        = 0u;
+    OSIntQRePostErrCtr  = 0u;
+    OSIntQRePostErr     = OS_ERR_NONE;
+    OSIntQTaskRdy       = DEF_TRUE;                             /* OSTaskCreate() puts the task in the ready list       */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    OSIntQTaskTS        = 0u;
+#endif
+
+    if (OSCfg_IntQBasePtr == (OS_INT_Q *)0) {
+       *p_err = OS_ERR_INT_Q;
+        return;
+    }
+
+    if (OSCfg_IntQSize < 2u) {
+       *p_err = OS_ERR_INT_Q_SIZE;
+        return;
+    }
+
+    if (OSCfg_IntQTaskStkBasePtr == (CPU_STK *)0) {
+       *p_err = OS_ERR_INT_Q_STK_INVALID;
+        return;
+    }
+
+    if (OSCfg_IntQTaskStkSize < OSCfg_StkSizeMin) {
+       *p_err = OS_ERR_INT_Q_STK_SIZE_INVALID;
+        return;
+    }
+
+    OSTaskCreate(&OSIntQTaskTCB,
+#if  (OS_CFG_DBG_EN == DEF_DISABLED)
+                 (CPU_CHAR   *)0,
+#else
+                 (CPU_CHAR   *)"uC/OS-III ISR Queue Task",
+#endif
+                  OS_IntQTask,
+                 (void       *)0,
+                  0u,                                           /* Priority 0 is reserved for the ISR handler task      */
+                  OSCfg_IntQTaskStkBasePtr,
+                  OSCfg_IntQTaskStkLimit,
+                  OSCfg_IntQTaskStkSize,
+                  0u,
+                  0u,
+                 (void       *)0,
+                 (OS_OPT_TASK_STK_CHK | (OS_OPT)(OS_OPT_TASK_STK_CLR | OS_OPT_TASK_NO_TLS)),
+                  p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  RE-POST AN ISR POST
+*
+* Description: This function performs, at task level, a post saved by OS_IntQPost().
+*
+* Arguments  : p_int_q   is a pointer to the ISR post queue entry
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) The posts are made with OS_OPT_POST_NO_SCHED since the ISR handler task has the highest priority.
+*                 They use the timestamp taken in the ISR (see OS_POST_TS_GET()).
+*
+*              3) The post functions already validated their arguments in the ISR, but the re-post can still fail,
+*                 e.g. if the message queue filled up or the object was deleted in the meantime.  Such posts are lost:
+*                 they are counted in OSIntQRePostErrCtr, the last error is kept in OSIntQRePostErr and the post
+*                 functions record the failure in the trace (OS_TRACE_..._POST_FAILED()).
+************************************************************************************************************************
+*/
+
+static  void  OS_IntQRePost (OS_INT_Q  *p_int_q)
+{
+    OS_ERR  err;
+
+
+    err = OS_ERR_NONE;                                          /* Initialize err explicitly for static analysis.       */
+
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    OSIntQTaskTS = p_int_q->TS;                                 /* See Note #2                                          */
+#endif
+
+    switch (p_int_q->Type) {
+#if (OS_CFG_FLAG_EN == DEF_ENABLED)
+        case OS_OBJ_TYPE_FLAG:
+             (void)OSFlagPost((OS_FLAG_GRP *)p_int_q->ObjPtr,
+                                             p_int_q->Flags,
+                              (OS_OPT       )(p_int_q->Opt | OS_OPT_POST_NO_SCHED),
+                                            &err);
+             break;
+#endif
+
+#if (OS_CFG_Q_EN == DEF_ENABLED)
+        case OS_OBJ_TYPE_Q:
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+             if (OS_MSG_Q_IS_INLINE(&((OS_Q *)p_int_q->ObjPtr)->MsgQ)) {
+                 OS_QPostDeferred((OS_Q *)p_int_q->ObjPtr,      /* Payload already queued by the ISR                    */
+                                          p_int_q->Opt);
+                 break;
+             }
+#endif
+             OSQPost((OS_Q   *)p_int_q->ObjPtr,
+                               p_int_q->MsgPtr,
+                               p_int_q->MsgSize,
+                     (OS_OPT  )(p_int_q->Opt | OS_OPT_POST_NO_SCHED),
+                              &err);
+             break;
+#endif
+
+#if (OS_CFG_SEM_EN == DEF_ENABLED)
+        case OS_OBJ_TYPE_SEM:
+#if (OS_CFG_SEM_BATCH_EN == DEF_ENABLED)
+             if (p_int_q->MsgPtr != (void *)0) {                /* Count deferred by OSSemPostN()                       */
+                 (void)OSSemPostN((OS_SEM   *)p_int_q->ObjPtr,
+                                  (OS_SEM_CTR)(CPU_ADDR)p_int_q->MsgPtr,
+                                  (OS_OPT    )(p_int_q->Opt | OS_OPT_POST_NO_SCHED),
+                                            &err);
+                 break;
+             }
+#endif
+             (void)OSSemPost((OS_SEM *)p_int_q->ObjPtr,
+                             (OS_OPT  )(p_int_q->Opt | OS_OPT_POST_NO_SCHED),
+                                      &err);
+             break;
+#endif
+
+#if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
+        case OS_OBJ_TYPE_TASK_MSG:
+             OSTaskQPost((OS_TCB *)p_int_q->ObjPtr,
+                                   p_int_q->MsgPtr,
+                                   p_int_q->MsgSize,
+                         (OS_OPT  )(p_int_q->Opt | OS_OPT_POST_NO_SCHED),
+                                  &err);
+             break;
+#endif
+
+        case OS_OBJ_TYPE_TASK_SIGNAL:
+             (void)OSTaskSemPost((OS_TCB *)p_int_q->ObjPtr,
+                                 (OS_OPT  )(p_int_q->Opt | OS_OPT_POST_NO_SCHED),
+                                          &err);
+             break;
+
+        default:
+             break;
+    }
+
+    if (err != OS_ERR_NONE) {                                   /* See Note #3                                          */
+        OSIntQRePostErrCtr++;
+        OSIntQRePostErr = err;
+    }
+}
+#endif
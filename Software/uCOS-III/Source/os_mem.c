@@ -41,6 +41,52 @@ const  CPU_CHAR  *os_mem__c = "$Id: $";
 
 
 #if (OS_CFG_MEM_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                                    LOCAL DEFINES
+*
+* Note(s) : (1) Lock-free partitions keep the head of the free list in a single 32-bit word that is only changed with
+*               a compare-and-swap.  Bits 15..0 hold the index+1 of the first free block (0 when the list is empty) and
+*               bits 31..16 hold a tag that is incremented on every change of the list.  A free block holds the
+*               index+1 of the next free block in its first word.
+*
+*               A task that reads the head and the link of the first block, gets preempted while other code takes and
+*               returns blocks, and then swaps in the link it read, would corrupt the list even if the same block is
+*               back at the head (ABA problem).  The tag makes its compare-and-swap fail instead, and it retries.
+*
+*               Any block count fits in the 16-bit index as long as OS_MEM_QTY is a 16-bit type, which is checked at
+*               compile time (a negative array size) rather than on each OSMemCreate().
+*
+*           (2) The port provides OS_CPU_AtomicCmpSwap32(), based on LDREX/STREX on ARMv7-M.  Builds without it, such
+*               as host simulations, fall back on C11 atomics.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED)
+#define  OS_MEM_FREE_LIST_IX_MSK              0x0000FFFFu       /* See Note #1.                                         */
+#define  OS_MEM_FREE_LIST_TAG_INC             0x00010000u
+
+                                                                /* OS_MEM_QTY must fit in the index (See Note #1).      */
+typedef  CPU_INT08U  OS_MEM_QTY_CHK[(sizeof(OS_MEM_QTY) <= 2u) ? 1 : -1];
+
+#if   defined(OS_CPU_ATOMIC_CMP_SWAP_ASM_PRESENT)               /* See Note #2.                                         */
+#define  OS_MEM_CMP_SWAP(p_val, val_cmp, val_new)    OS_CPU_AtomicCmpSwap32((p_val), (val_cmp), (val_new))
+#elif (defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__))
+#include  <stdatomic.h>
+#define  OS_MEM_CMP_SWAP(p_val, val_cmp, val_new)    OS_MemCmpSwap((p_val), (val_cmp), (val_new))
+
+static  CPU_BOOLEAN  OS_MemCmpSwap (CPU_INT32U  *p_val,
+                                    CPU_INT32U   val_cmp,
+                                    CPU_INT32U   val_new)
+{
+    return ((atomic_compare_exchange_strong((_Atomic CPU_INT32U *)p_val, &val_cmp, val_new) != 0) ? DEF_TRUE : DEF_FALSE);
+}
+#else
+#error  "OS_CFG_MEM_LOCK_FREE_EN requires OS_CPU_AtomicCmpSwap32() in the port or C11 atomics"
+#endif
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                               CREATE A MEMORY PARTITION
@@ -73,7 +119,7 @@ const  CPU_CHAR  *os_mem__c = "$Id: $";
 *                                                             - must be able to hold an integral number of pointers
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) With OS_CFG_MEM_LOCK_FREE_EN, a partition holds at most 65535 blocks (see 'LOCAL DEFINES  Note #1').
 ************************************************************************************************************************
 */
 
@@ -90,7 +136,11 @@ void  OSMemCreate (OS_MEM       *p_mem,
     OS_MEM_QTY     i;
     OS_MEM_QTY     loops;
     CPU_INT08U    *p_blk;
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED)
+    CPU_INT32U    *p_link;
+#else
     void         **p_link;
+#endif
     CPU_SR_ALLOC();
 
 
@@ -142,6 +192,17 @@ void  OSMemCreate (OS_MEM       *p_mem,
     }
 #endif
 
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED)
+    p_link = (CPU_INT32U *)p_addr;                              /* Create linked list of free memory blocks             */
+    p_blk  = (CPU_INT08U *)p_addr;
+    loops  = n_blks - 1u;
+    for (i = 0u; i < loops; i++) {
+        p_blk +=  blk_size;
+       *p_link = (CPU_INT32U)i + 2u;                            /* Save index+1 of NEXT block in CURRENT block          */
+        p_link = (CPU_INT32U *)(void *)p_blk;                   /* Position       to NEXT block                         */
+    }
+   *p_link             = 0u;                                    /* Last memory block has no next block                  */
+#else
     p_link = (void **)p_addr;                                   /* Create linked list of free memory blocks             */
     p_blk  = (CPU_INT08U *)p_addr;
     loops  = n_blks - 1u;
@@ -151,6 +212,7 @@ void  OSMemCreate (OS_MEM       *p_mem,
         p_link = (void **)(void *)p_blk;                        /* Position     to NEXT block                           */
     }
    *p_link             = (void *)0;                             /* Last memory block points to NULL                     */
+#endif
 
     CPU_CRITICAL_ENTER();
 #if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
@@ -162,12 +224,19 @@ void  OSMemCreate (OS_MEM       *p_mem,
     (void)p_name;
 #endif
     p_mem->AddrPtr     = p_addr;                                /* Store start address of memory partition              */
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED)
+    p_mem->FreeListHead = 1u;                                   /* First block is index 0, tag starts at 0              */
+#else
     p_mem->FreeListPtr = p_addr;                                /* Initialize pointer to pool of free blocks            */
+#endif
     p_mem->NbrFree     = n_blks;                                /* Store number of free blocks in MCB                   */
     p_mem->NbrMax      = n_blks;
     p_mem->BlkSize     = blk_size;                              /* Store block size of each memory blocks               */
 
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_mem->NbrUsedMax  = 0u;
+    p_mem->NbrGetFail  = 0u;
+    p_mem->OwnerTblPtr = (OS_TCB **)0;
     OS_MemDbgListAdd(p_mem);
     OSMemQty++;
 #endif
@@ -197,15 +266,31 @@ void  OSMemCreate (OS_MEM       *p_mem,
 * Returns    : A pointer to a memory block if no error is detected
 *              A pointer to NULL if an error is detected
 *
-* Note(s)    : none
+* Note(s)    : 1) With OS_CFG_MEM_LOCK_FREE_EN, interrupts are not disabled.  The block is taken with a compare-and-swap
+*                 on the free list head (see 'LOCAL DEFINES  Note #1') which is retried if the list changed meanwhile.
+*                 'NbrFree' is updated after the block is taken.
 ************************************************************************************************************************
 */
 
 void  *OSMemGet (OS_MEM  *p_mem,
                  OS_ERR  *p_err)
 {
-    void    *p_blk;
+    void        *p_blk;
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED)
+    CPU_INT32U   head;
+    CPU_INT32U   ix;
+    CPU_INT32U   nbr_free;
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    CPU_INT32U   nbr_used;
+    CPU_INT32U   nbr_used_max;
+    CPU_INT32U   nbr_fail;
+#endif
+#else
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    OS_MEM_QTY   nbr_used;
+#endif
     CPU_SR_ALLOC();
+#endif
 
 
 
@@ -236,8 +321,51 @@ void  *OSMemGet (OS_MEM  *p_mem,
 #endif
 
 
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED)                    /* See Note #1                                          */
+    do {
+        head = p_mem->FreeListHead;
+        ix   = head & OS_MEM_FREE_LIST_IX_MSK;
+        if (ix == 0u) {                                         /* See if there are any free memory blocks              */
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+            do {
+                nbr_fail = p_mem->NbrGetFail;
+            } while (OS_MEM_CMP_SWAP(&p_mem->NbrGetFail, nbr_fail, nbr_fail + 1u) == DEF_FALSE);
+#endif
+            OS_TRACE_MEM_GET_FAILED(p_mem);
+            OS_TRACE_MEM_GET_EXIT(OS_ERR_MEM_NO_FREE_BLKS);
+           *p_err = OS_ERR_MEM_NO_FREE_BLKS;                    /* No,  Notify caller of empty memory partition         */
+            return ((void *)0);                                 /* Return NULL pointer to caller                        */
+        }
+        p_blk = (void *)((CPU_INT08U *)p_mem->AddrPtr + ((ix - 1u) * p_mem->BlkSize));
+                                                                /* Link may be stale if preempted, swap then fails      */
+    } while (OS_MEM_CMP_SWAP(&p_mem->FreeListHead,
+                              head,
+                             ((head & ~OS_MEM_FREE_LIST_IX_MSK) + OS_MEM_FREE_LIST_TAG_INC) |
+                             (*(CPU_INT32U *)p_blk & OS_MEM_FREE_LIST_IX_MSK)) == DEF_FALSE);
+
+    do {                                                        /* One less memory block in this partition              */
+        nbr_free = p_mem->NbrFree;
+    } while (OS_MEM_CMP_SWAP(&p_mem->NbrFree, nbr_free, nbr_free - 1u) == DEF_FALSE);
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    nbr_used = (CPU_INT32U)p_mem->NbrMax - (nbr_free - 1u);
+    do {                                                        /* Update high-water mark                               */
+        nbr_used_max = p_mem->NbrUsedMax;
+        if (nbr_used <= nbr_used_max) {
+            break;
+        }
+    } while (OS_MEM_CMP_SWAP(&p_mem->NbrUsedMax, nbr_used_max, nbr_used) == DEF_FALSE);
+
+    if (p_mem->OwnerTblPtr != (OS_TCB **)0) {                   /* Record owner task, none if called from an ISR        */
+        p_mem->OwnerTblPtr[ix - 1u] = (OSIntNestingCtr == 0u) ? OSTCBCurPtr : (OS_TCB *)0;
+    }
+#endif
+#else
     CPU_CRITICAL_ENTER();
     if (p_mem->NbrFree == 0u) {                                 /* See if there are any free memory blocks              */
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+        p_mem->NbrGetFail++;
+#endif
         CPU_CRITICAL_EXIT();
         OS_TRACE_MEM_GET_FAILED(p_mem);
         OS_TRACE_MEM_GET_EXIT(OS_ERR_MEM_NO_FREE_BLKS);
@@ -247,7 +375,18 @@ void  *OSMemGet (OS_MEM  *p_mem,
     p_blk              = p_mem->FreeListPtr;                    /* Yes, point to next free memory block                 */
     p_mem->FreeListPtr = *(void **)p_blk;                       /* Adjust pointer to new free list                      */
     p_mem->NbrFree--;                                           /* One less memory block in this partition              */
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    nbr_used = p_mem->NbrMax - p_mem->NbrFree;
+    if (p_mem->NbrUsedMax < nbr_used) {                         /* Update high-water mark                               */
+        p_mem->NbrUsedMax = nbr_used;
+    }
+    if (p_mem->OwnerTblPtr != (OS_TCB **)0) {                   /* Record owner task, none if called from an ISR        */
+        p_mem->OwnerTblPtr[((CPU_INT08U *)p_blk - (CPU_INT08U *)p_mem->AddrPtr) / p_mem->BlkSize] =
+                           (OSIntNestingCtr == 0u) ? OSTCBCurPtr : (OS_TCB *)0;
+    }
+#endif
     CPU_CRITICAL_EXIT();
+#endif
     OS_TRACE_MEM_GET(p_mem);
     OS_TRACE_MEM_GET_EXIT(OS_ERR_NONE);
    *p_err = OS_ERR_NONE;                                        /* No error                                             */
@@ -270,13 +409,17 @@ void  *OSMemGet (OS_MEM  *p_mem,
 *                            OS_ERR_NONE               If the memory block was inserted into the partition
 *                            OS_ERR_MEM_FULL           If you are returning a memory block to an already FULL memory
 *                                                      partition (You freed more blocks than you allocated!)
-*                            OS_ERR_MEM_INVALID_P_BLK  If you passed a NULL pointer for the block to release.
+*                            OS_ERR_MEM_INVALID_P_BLK  If you passed a NULL pointer for the block to release, or (with
+*                                                      OS_CFG_MEM_LOCK_FREE_EN) a pointer that is not a block of
+*                                                      this partition
 *                            OS_ERR_MEM_INVALID_P_MEM  If you passed a NULL pointer for 'p_mem'
 *                            OS_ERR_OBJ_TYPE           If 'p_mem' is not pointing at a memory partition
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) With OS_CFG_MEM_LOCK_FREE_EN, interrupts are not disabled.  'NbrFree' is incremented first, which also
+*                 checks that the partition is not full, then the block is pushed with a compare-and-swap on the free
+*                 list head.
 ************************************************************************************************************************
 */
 
@@ -284,7 +427,13 @@ void  OSMemPut (OS_MEM  *p_mem,
                 void    *p_blk,
                 OS_ERR  *p_err)
 {
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED)
+    CPU_INT32U   head;
+    CPU_INT32U   ix;
+    CPU_INT32U   nbr_free;
+#else
     CPU_SR_ALLOC();
+#endif
 
 
 
@@ -321,6 +470,42 @@ void  OSMemPut (OS_MEM  *p_mem,
 #endif
 
 
+#if (OS_CFG_MEM_LOCK_FREE_EN == DEF_ENABLED)                    /* See Note #1                                          */
+    ix = (CPU_INT32U)(((CPU_INT08U *)p_blk - (CPU_INT08U *)p_mem->AddrPtr) / p_mem->BlkSize);
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (((CPU_INT08U *)p_blk < (CPU_INT08U *)p_mem->AddrPtr) || /* Block must belong to this partition                  */
+        (ix >= p_mem->NbrMax)                                 ||
+        (((CPU_INT08U *)p_mem->AddrPtr + (ix * p_mem->BlkSize)) != (CPU_INT08U *)p_blk)) {
+        OS_TRACE_MEM_PUT_FAILED(p_mem);
+        OS_TRACE_MEM_PUT_EXIT(OS_ERR_MEM_INVALID_P_BLK);
+       *p_err  = OS_ERR_MEM_INVALID_P_BLK;
+        return;
+    }
+#endif
+
+    do {                                                        /* One more memory block in this partition              */
+        nbr_free = p_mem->NbrFree;
+        if (nbr_free >= p_mem->NbrMax) {                        /* Make sure all blocks not already returned            */
+            OS_TRACE_MEM_PUT_FAILED(p_mem);
+            OS_TRACE_MEM_PUT_EXIT(OS_ERR_MEM_FULL);
+           *p_err = OS_ERR_MEM_FULL;
+            return;
+        }
+    } while (OS_MEM_CMP_SWAP(&p_mem->NbrFree, nbr_free, nbr_free + 1u) == DEF_FALSE);
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    if (p_mem->OwnerTblPtr != (OS_TCB **)0) {
+        p_mem->OwnerTblPtr[ix] = (OS_TCB *)0;
+    }
+#endif
+
+    do {                                                        /* Insert released block into free block list           */
+        head             = p_mem->FreeListHead;
+       *(CPU_INT32U *)p_blk = head & OS_MEM_FREE_LIST_IX_MSK;
+    } while (OS_MEM_CMP_SWAP(&p_mem->FreeListHead,
+                              head,
+                             ((head & ~OS_MEM_FREE_LIST_IX_MSK) + OS_MEM_FREE_LIST_TAG_INC) | (ix + 1u)) == DEF_FALSE);
+#else
     CPU_CRITICAL_ENTER();
     if (p_mem->NbrFree >= p_mem->NbrMax) {                      /* Make sure all blocks not already returned            */
         CPU_CRITICAL_EXIT();
@@ -329,16 +514,92 @@ void  OSMemPut (OS_MEM  *p_mem,
        *p_err = OS_ERR_MEM_FULL;
         return;
     }
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    if (p_mem->OwnerTblPtr != (OS_TCB **)0) {
+        p_mem->OwnerTblPtr[((CPU_INT08U *)p_blk - (CPU_INT08U *)p_mem->AddrPtr) / p_mem->BlkSize] = (OS_TCB *)0;
+    }
+#endif
     *(void **)p_blk    = p_mem->FreeListPtr;                    /* Insert released block into free block list           */
     p_mem->FreeListPtr = p_blk;
     p_mem->NbrFree++;                                           /* One more memory block in this partition              */
     CPU_CRITICAL_EXIT();
+#endif
     OS_TRACE_MEM_PUT(p_mem);
     OS_TRACE_MEM_PUT_EXIT(OS_ERR_NONE);
    *p_err              = OS_ERR_NONE;                           /* Notify caller that memory block was released         */
 }
 
 
+/*
+************************************************************************************************************************
+*                                           SET THE BLOCK OWNER TRACKING TABLE
+*
+* Description : This function assigns a table in which OSMemGet() records the task that obtained each block of the
+*               partition, to find which task holds on to blocks while debugging.
+*
+* Arguments   : p_mem    is a pointer to the memory partition control block
+*
+*               p_tbl    is a pointer to a table of 'NbrMax' task pointers, indexed by block number.  Entry 'i' is the
+*                        TCB of the task that obtained the block at 'p_addr + i * blk_size', or NULL if that block is
+*                        free or was obtained from an ISR.  Pass NULL to stop tracking.
+*
+*               p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                            OS_ERR_NONE               If the table was assigned
+*                            OS_ERR_MEM_INVALID_P_MEM  If you passed a NULL pointer for 'p_mem'
+*                            OS_ERR_OBJ_TYPE           If 'p_mem' is not pointing at a memory partition
+*
+* Returns    : none
+*
+* Note(s)    : 1) Blocks obtained before the table is assigned have no recorded owner.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+void  OSMemOwnerTblSet (OS_MEM   *p_mem,
+                        OS_TCB  **p_tbl,
+                        OS_ERR   *p_err)
+{
+    OS_MEM_QTY  i;
+    CPU_SR_ALLOC();
+
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_mem == (OS_MEM *)0) {                                 /* Must point to a valid memory partition               */
+       *p_err  = OS_ERR_MEM_INVALID_P_MEM;
+        return;
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_mem->Type != OS_OBJ_TYPE_MEM) {                       /* Make sure the memory block was created               */
+       *p_err = OS_ERR_OBJ_TYPE;
+        return;
+    }
+#endif
+
+    if (p_tbl != (OS_TCB **)0) {
+        for (i = 0u; i < p_mem->NbrMax; i++) {                  /* See Note #1                                          */
+            p_tbl[i] = (OS_TCB *)0;
+        }
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_mem->OwnerTblPtr = p_tbl;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                           ADD MEMORY PARTITION TO DEBUG LIST
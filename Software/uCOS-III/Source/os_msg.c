@@ -105,11 +105,118 @@ void  OS_MsgPoolInit (OS_ERR  *p_err)
     OSMsgPool.NbrUsed    = 0u;
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
     OSMsgPool.NbrUsedMax = 0u;
+#endif
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+    OSMsgPool.BasePtr    = OSCfg_MsgPoolBasePtr;
+    OSMsgPool.DataPtr    = (CPU_INT08U *)0;                     /* Messages are pointers                                */
+    OSMsgPool.DataSize   = 0u;
 #endif
    *p_err                = OS_ERR_NONE;
 }
 
 
+/*
+************************************************************************************************************************
+*                                          INITIALIZE A PRIVATE POOL OF 'OS_MSG'
+*
+* Description: This function is called by OSQCreateSlots() to build a pool of OS_MSGs reserved for one queue.
+*
+* Argument(s): p_pool     is a pointer to the pool to initialize
+*
+*              p_msg_tbl  is a pointer to an array of 'qty' OS_MSGs
+*
+*              qty        is the number of OS_MSGs in the pool
+*
+*              p_data     is a pointer to 'qty' * 'data_size' bytes used to store the message payloads, or a NULL
+*                         pointer if the messages are pointers
+*
+*              data_size  is the size of the payload stored with each OS_MSG
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+void  OS_MsgPoolCreate (OS_MSG_POOL  *p_pool,
+                        OS_MSG       *p_msg_tbl,
+                        OS_MSG_QTY    qty,
+                        void         *p_data,
+                        OS_MSG_SIZE   data_size)
+{
+    OS_MSG      *p_msg;
+    OS_MSG_QTY   i;
+
+
+    p_msg = p_msg_tbl;
+    for (i = 0u; i < qty; i++) {                                /* Init. list of free OS_MSGs                           */
+        p_msg->NextPtr = p_msg + 1u;
+        p_msg->MsgPtr  = (void *)0;
+        p_msg->MsgSize =         0u;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+        p_msg->MsgTS   =         0u;
+#endif
+        p_msg++;
+    }
+    p_msg--;
+    p_msg->NextPtr = (OS_MSG *)0;                               /* Last OS_MSG                                          */
+
+    p_pool->NextPtr    = p_msg_tbl;
+    p_pool->NbrFree    = qty;
+    p_pool->NbrUsed    = 0u;
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_pool->NbrUsedMax = 0u;
+#endif
+    p_pool->BasePtr    = p_msg_tbl;
+    if (p_data == (void *)0) {
+        p_pool->DataPtr  = (CPU_INT08U *)0;
+        p_pool->DataSize = 0u;
+    } else {
+        p_pool->DataPtr  = (CPU_INT08U *)p_data;
+        p_pool->DataSize = data_size;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                                                  COPY A MESSAGE PAYLOAD
+*
+* Description: This function copies 'size' bytes from 'p_src' to 'p_dest'.
+*
+* Argument(s): p_dest     is a pointer to the destination
+*
+*              p_src      is a pointer to the source
+*
+*              size       is the number of bytes to copy
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+************************************************************************************************************************
+*/
+
+void  OS_MsgCopy (void         *p_dest,
+                  void         *p_src,
+                  OS_MSG_SIZE   size)
+{
+    CPU_INT08U  *p_dest_08;
+    CPU_INT08U  *p_src_08;
+
+
+    p_dest_08 = (CPU_INT08U *)p_dest;
+    p_src_08  = (CPU_INT08U *)p_src;
+    while (size > 0u) {
+       *p_dest_08 = *p_src_08;
+        p_dest_08++;
+        p_src_08++;
+        size--;
+    }
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                        RELEASE ALL MESSAGE IN MESSAGE QUEUE
@@ -127,18 +234,24 @@ void  OS_MsgPoolInit (OS_ERR  *p_err)
 
 OS_MSG_QTY  OS_MsgQFreeAll (OS_MSG_Q  *p_msg_q)
 {
-    OS_MSG      *p_msg;
-    OS_MSG_QTY   qty;
+    OS_MSG       *p_msg;
+    OS_MSG_POOL  *p_pool;
+    OS_MSG_QTY    qty;
 
 
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+    p_pool = p_msg_q->PoolPtr;                                  /* Global pool or the queue's own slots                 */
+#else
+    p_pool = &OSMsgPool;
+#endif
 
     qty = p_msg_q->NbrEntries;                                  /* Get the number of OS_MSGs being freed                */
     if (p_msg_q->NbrEntries > 0u) {
         p_msg                   = p_msg_q->InPtr;               /* Point to end of message chain                        */
-        p_msg->NextPtr          = OSMsgPool.NextPtr;
-        OSMsgPool.NextPtr       = p_msg_q->OutPtr;              /* Point to beginning of message chain                  */
-        OSMsgPool.NbrUsed      -= p_msg_q->NbrEntries;          /* Update statistics for free list of messages          */
-        OSMsgPool.NbrFree      += p_msg_q->NbrEntries;
+        p_msg->NextPtr          = p_pool->NextPtr;
+        p_pool->NextPtr         = p_msg_q->OutPtr;              /* Point to beginning of message chain                  */
+        p_pool->NbrUsed        -= p_msg_q->NbrEntries;          /* Update statistics for free list of messages          */
+        p_pool->NbrFree        += p_msg_q->NbrEntries;
         p_msg_q->NbrEntries     =           0u;                 /* Flush the message queue                              */
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
         p_msg_q->NbrEntriesMax  =           0u;
@@ -177,6 +290,9 @@ void  OS_MsgQInit (OS_MSG_Q    *p_msg_q,
 #endif
     p_msg_q->InPtr          = (OS_MSG *)0;
     p_msg_q->OutPtr         = (OS_MSG *)0;
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+    p_msg_q->PoolPtr        = &OSMsgPool;
+#endif
 }
 
 
@@ -201,6 +317,9 @@ void  OS_MsgQInit (OS_MSG_Q    *p_msg_q,
 * Returns    : The message (a pointer)
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) For a queue with inline payloads, the message points to the payload in the freed slot: the caller
+*                 MUST copy it before re-enabling interrupts.
 ************************************************************************************************************************
 */
 
@@ -209,8 +328,9 @@ void  *OS_MsgQGet (OS_MSG_Q     *p_msg_q,
                    CPU_TS       *p_ts,
                    OS_ERR       *p_err)
 {
-    OS_MSG  *p_msg;
-    void    *p_void;
+    OS_MSG       *p_msg;
+    OS_MSG_POOL  *p_pool;
+    void         *p_void;
 
 
 #if (OS_CFG_TS_EN == DEF_DISABLED)
@@ -246,10 +366,15 @@ void  *OS_MsgQGet (OS_MSG_Q     *p_msg_q,
         p_msg_q->NbrEntries--;                                  /* Yes, One less message in the queue                   */
     }
 
-    p_msg->NextPtr    = OSMsgPool.NextPtr;                      /* Return message control block to free list            */
-    OSMsgPool.NextPtr = p_msg;
-    OSMsgPool.NbrFree++;
-    OSMsgPool.NbrUsed--;
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+    p_pool = p_msg_q->PoolPtr;
+#else
+    p_pool = &OSMsgPool;
+#endif
+    p_msg->NextPtr  = p_pool->NextPtr;                          /* Return message control block to free list            */
+    p_pool->NextPtr = p_msg;
+    p_pool->NbrFree++;
+    p_pool->NbrUsed--;
 
    *p_err             = OS_ERR_NONE;
     return (p_void);
@@ -285,6 +410,9 @@ void  *OS_MsgQGet (OS_MSG_Q     *p_msg_q,
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) For a queue with inline payloads, 'msg_size' bytes are copied from 'p_void' into the slot.  The
+*                 caller checked that 'msg_size' fits in the slot.
 ************************************************************************************************************************
 */
 
@@ -295,8 +423,12 @@ void  OS_MsgQPut (OS_MSG_Q     *p_msg_q,
                   CPU_TS        ts,
                   OS_ERR       *p_err)
 {
-    OS_MSG  *p_msg;
-    OS_MSG  *p_msg_in;
+    OS_MSG       *p_msg;
+    OS_MSG       *p_msg_in;
+    OS_MSG_POOL  *p_pool;
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+    CPU_INT08U   *p_data;
+#endif
 
 
 #if (OS_CFG_TS_EN == DEF_DISABLED)
@@ -308,19 +440,32 @@ void  OS_MsgQPut (OS_MSG_Q     *p_msg_q,
         return;
     }
 
-    if (OSMsgPool.NbrFree == 0u) {
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+    p_pool = p_msg_q->PoolPtr;                                  /* Global pool or the queue's own slots                 */
+#else
+    p_pool = &OSMsgPool;
+#endif
+    if (p_pool->NbrFree == 0u) {
        *p_err = OS_ERR_MSG_POOL_EMPTY;                          /* No more OS_MSG to use                                */
         return;
     }
 
-    p_msg = OSMsgPool.NextPtr;                                  /* Remove message control block from free list          */
-    OSMsgPool.NextPtr = p_msg->NextPtr;
-    OSMsgPool.NbrFree--;
-    OSMsgPool.NbrUsed++;
+    p_msg = p_pool->NextPtr;                                    /* Remove message control block from free list          */
+    p_pool->NextPtr = p_msg->NextPtr;
+    p_pool->NbrFree--;
+    p_pool->NbrUsed++;
 
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
-    if (OSMsgPool.NbrUsedMax < OSMsgPool.NbrUsed) {
-        OSMsgPool.NbrUsedMax = OSMsgPool.NbrUsed;
+    if (p_pool->NbrUsedMax < p_pool->NbrUsed) {
+        p_pool->NbrUsedMax = p_pool->NbrUsed;
+    }
+#endif
+
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+    if (p_pool->DataSize > 0u) {                                /* Copy the payload in the slot (see Note #2)           */
+        p_data = p_pool->DataPtr + ((CPU_SIZE_T)(p_msg - p_pool->BasePtr) * p_pool->DataSize);
+        OS_MsgCopy((void *)p_data, p_void, msg_size);
+        p_void = (void *)p_data;
     }
 #endif
 
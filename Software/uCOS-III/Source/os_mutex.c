@@ -113,6 +113,9 @@ void  OSMutexCreate (OS_MUTEX  *p_mutex,
     p_mutex->MutexGrpNextPtr   = (OS_MUTEX *)0;
     p_mutex->OwnerTCBPtr       = (OS_TCB   *)0;
     p_mutex->OwnerNestingCtr   =             0u;                /* Mutex is available                                   */
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+    p_mutex->CeilingPrio       =  OS_PRIO_CEILING_NONE;         /* Use priority inheritance                             */
+#endif
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     p_mutex->TS                =             0u;
 #endif
@@ -129,6 +132,92 @@ void  OSMutexCreate (OS_MUTEX  *p_mutex,
 }
 
 
+/*
+************************************************************************************************************************
+*                                           CREATE A PRIORITY-CEILING MUTEX
+*
+* Description: This function creates a mutex that uses the immediate priority-ceiling protocol instead of priority
+*              inheritance: the task that acquires the mutex is raised to 'prio_ceiling' at once and keeps that
+*              priority until it releases the mutex.
+*
+* Arguments  : p_mutex       is a pointer to the mutex to initialize.  Your application is responsible for allocating
+*                            storage for the mutex.
+*
+*              p_name        is a pointer to the name you would like to give the mutex.
+*
+*              prio_ceiling  is the priority of the owner of the mutex.  It MUST be at least as high (i.e. as low a
+*                            number) as the priority of every task that uses the mutex.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE                    If the call was successful
+*                                OS_ERR_CREATE_ISR              If you called this function from an ISR
+*                                OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the mutex after you called
+*                                                                 OSSafetyCriticalStart()
+*                                OS_ERR_OBJ_PTR_NULL            If 'p_mutex' is a NULL pointer
+*                                OS_ERR_PRIO_INVALID            If 'prio_ceiling' is the idle task priority or is
+*                                                                 reserved by the kernel
+*
+* Returns    : none
+*
+* Note(s)    : 1) A task never blocks on a ceiling mutex held by a task it could preempt, so the mutex owner never
+*                 inherits a priority and OSMutexPost() doesn't have to look for the highest waiter to restore the
+*                 owner's priority.
+*
+*              2) OSMutexPend() returns OS_ERR_MUTEX_CEILING if the base priority of the caller is higher than the
+*                 ceiling.
+*
+*              3) The ceiling can't be in the EDF band: a task raised to the ceiling would need a place in the EDF heap.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+void  OSMutexCreateCeiling (OS_MUTEX  *p_mutex,
+                            CPU_CHAR  *p_name,
+                            OS_PRIO    prio_ceiling,
+                            OS_ERR    *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (prio_ceiling >= (OS_CFG_PRIO_MAX - 1u)) {               /* Can't use the idle task priority                     */
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (prio_ceiling == 0u) {                                   /* Priority 0 is reserved for the ISR handler task      */
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+#endif
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    if (OS_EDF_PRIO_IN_BAND(prio_ceiling)) {                    /* See Note #3                                          */
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+#endif
+#endif
+
+    OSMutexCreate(p_mutex, p_name, p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_mutex->CeilingPrio = prio_ceiling;
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                   DELETE A MUTEX
@@ -330,6 +419,7 @@ OS_OBJ_QTY  OSMutexDel (OS_MUTEX  *p_mutex,
 *              p_err         is a pointer to a variable that will contain an error code returned by this function.
 *
 *                                OS_ERR_NONE               The call was successful and your task owns the resource
+*                                OS_ERR_MUTEX_CEILING      If the caller's priority is higher than the mutex ceiling
 *                                OS_ERR_MUTEX_OWNER        If calling task already owns the mutex
 *                                OS_ERR_MUTEX_OVF          Mutex nesting counter overflowed
 *                                OS_ERR_OBJ_DEL            If 'p_mutex' was deleted
@@ -422,6 +512,17 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
 #endif
 
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+    if ((p_mutex->CeilingPrio  != OS_PRIO_CEILING_NONE) &&      /* Caller must not be above the ceiling                 */
+        (OSTCBCurPtr->BasePrio <  p_mutex->CeilingPrio)) {
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_MUTEX_PEND_FAILED(p_mutex);
+        OS_TRACE_MUTEX_PEND_EXIT(OS_ERR_MUTEX_CEILING);
+       *p_err = OS_ERR_MUTEX_CEILING;
+        return;
+    }
+#endif
+
     if (p_mutex->OwnerNestingCtr == 0u) {                       /* Resource available?                                  */
         p_mutex->OwnerTCBPtr     = OSTCBCurPtr;                 /* Yes, caller may proceed                              */
         p_mutex->OwnerNestingCtr = 1u;
@@ -431,6 +532,13 @@ void  OSMutexPend (OS_MUTEX  *p_mutex,
         }
 #endif
         OS_MutexGrpAdd(OSTCBCurPtr, p_mutex);                   /* Add mutex to owner's group                           */
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+        if (OSTCBCurPtr->Prio > p_mutex->CeilingPrio) {         /* Raise the owner to the ceiling                       */
+            OS_TaskChangePrio(OSTCBCurPtr, p_mutex->CeilingPrio);
+            OSPrioCur = p_mutex->CeilingPrio;
+            OS_TRACE_MUTEX_TASK_PRIO_INHERIT(OSTCBCurPtr, OSTCBCurPtr->Prio);
+        }
+#endif
         CPU_CRITICAL_EXIT();
         OS_TRACE_MUTEX_PEND(p_mutex);
         OS_TRACE_MUTEX_PEND_EXIT(OS_ERR_NONE);
@@ -819,7 +927,12 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
     OS_MutexGrpRemove(OSTCBCurPtr, p_mutex);                    /* Remove mutex from owner's group                      */
 
     p_pend_list = &p_mutex->PendList;
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+    if ((p_pend_list->HeadPtr == (OS_TCB *)0) &&                /* Any task waiting on mutex?                           */
+        (p_mutex->CeilingPrio == OS_PRIO_CEILING_NONE)) {       /* ... the owner of a ceiling mutex must be lowered     */
+#else
     if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on mutex?                           */
+#endif
         p_mutex->OwnerTCBPtr     = (OS_TCB *)0;                 /* No                                                   */
         p_mutex->OwnerNestingCtr =           0u;
         CPU_CRITICAL_EXIT();
@@ -840,11 +953,31 @@ void  OSMutexPost (OS_MUTEX  *p_mutex,
             OSPrioCur         = prio_new;
         }
     }
+
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Ceiling mutex without waiters                        */
+        p_mutex->OwnerTCBPtr     = (OS_TCB *)0;
+        p_mutex->OwnerNestingCtr =           0u;
+        CPU_CRITICAL_EXIT();
+        if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
+            OSSched();                                          /* A task may be ready above our restored priority      */
+        }
+        OS_TRACE_MUTEX_POST_EXIT(OS_ERR_NONE);
+       *p_err = OS_ERR_NONE;
+        return;
+    }
+#endif
                                                                 /* Get TCB from head of pend list                       */
     p_tcb                    = p_pend_list->HeadPtr;
     p_mutex->OwnerTCBPtr     = p_tcb;                           /* Give mutex to new owner                              */
     p_mutex->OwnerNestingCtr = 1u;
     OS_MutexGrpAdd(p_tcb, p_mutex);
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+    if (p_tcb->Prio > p_mutex->CeilingPrio) {                   /* Raise the new owner to the ceiling                   */
+        OS_TaskChangePrio(p_tcb, p_mutex->CeilingPrio);
+        OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb, p_tcb->Prio);
+    }
+#endif
                                                                 /* Post to mutex                                        */
     OS_Post((OS_PEND_OBJ *)((void *)p_mutex),
                            p_tcb,
@@ -889,6 +1022,9 @@ void  OS_MutexClr (OS_MUTEX  *p_mutex)
     p_mutex->MutexGrpNextPtr   = (OS_MUTEX *)0;
     p_mutex->OwnerTCBPtr       = (OS_TCB   *)0;
     p_mutex->OwnerNestingCtr   =             0u;
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+    p_mutex->CeilingPrio       =  OS_PRIO_CEILING_NONE;
+#endif
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     p_mutex->TS                =             0u;
 #endif
@@ -1017,6 +1153,7 @@ void  OS_MutexGrpRemove (OS_TCB  *p_tcb, OS_MUTEX  *p_mutex)
 *                                              MUTEX FIND HIGHEST PENDING
 *
 * Description: This function is called by the kernel to find the highest task pending on any mutex from a group.
+*              The ceiling of a priority-ceiling mutex counts as a pending task.
 *
 
 * Argument(s): p_tcb        is a pointer to the tcb of the task to process.
@@ -1047,6 +1184,12 @@ OS_PRIO  OS_MutexGrpPrioFindHighest (OS_TCB  *p_tcb)
                 highest_prio = prio;
             }
         }
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+        prio = (*pp_mutex)->CeilingPrio;
+        if(prio < highest_prio) {
+            highest_prio = prio;
+        }
+#endif
         pp_mutex = &(*pp_mutex)->MutexGrpNextPtr;
     }
 
@@ -1102,9 +1245,15 @@ void  OS_MutexGrpPostAll (OS_TCB  *p_tcb)
         } else {
                                                                 /* Get TCB from head of pend list                       */
             p_tcb_new                = p_pend_list->HeadPtr;
-            p_mutex->OwnerTCBPtr     = p_tcb;                   /* Give mutex to new owner                              */
+            p_mutex->OwnerTCBPtr     = p_tcb_new;               /* Give mutex to new owner                              */
             p_mutex->OwnerNestingCtr = 1u;
             OS_MutexGrpAdd(p_tcb_new, p_mutex);
+#if (OS_CFG_MUTEX_CEILING_EN == DEF_ENABLED)
+            if (p_tcb_new->Prio > p_mutex->CeilingPrio) {       /* Raise the new owner to the ceiling                   */
+                OS_TaskChangePrio(p_tcb_new, p_mutex->CeilingPrio);
+                OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb_new, p_tcb_new->Prio);
+            }
+#endif
                                                                 /* Post to mutex                                        */
             OS_Post((OS_PEND_OBJ *)((void *)p_mutex),
                                    p_tcb_new,
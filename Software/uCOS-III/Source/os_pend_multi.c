@@ -0,0 +1,781 @@
+/*
+************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                  (c) Copyright 2009-2016; Micrium, Inc.; Weston, FL
+*                           All rights reserved.  Protected by international copyright laws.
+*
+*                                               PEND ON MULTIPLE OBJECTS
+*
+* File    : OS_PEND_MULTI.C
+* Version : V3.06.01
+*
+* LICENSING TERMS:
+* ---------------
+*           uC/OS-III is provided in source form for FREE short-term evaluation, for educational use or
+*           for peaceful research.  If you plan or intend to use uC/OS-III in a commercial application/
+*           product then, you need to contact Micrium to properly license uC/OS-III for its use in your
+*           application/product.   We provide ALL the source code for your convenience and to help you
+*           experience uC/OS-III.  The fact that the source is provided does NOT mean that you can use
+*           it commercially without paying a licensing fee.
+*
+*           Knowledge of the source code may NOT be used to develop a similar product.
+*
+*           Please help us continue to provide the embedded community with the finest software available.
+*           Your honesty is greatly appreciated.
+*
+*           You can find our product's user manual, API reference, release notes and
+*           more information at doc.micrium.com.
+*           You can contact us at www.micrium.com.
+************************************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_pend_multi__c = "$Id: $";
+#endif
+
+
+#if (OS_CFG_PEND_MULTI_EN == DEF_ENABLED)
+/*
+************************************************************************************************************************
+*                                                 FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+static  OS_OBJ_QTY  OS_PendMultiGetRdy     (OS_PEND_DATA  *p_pend_data_tbl,
+                                            OS_OBJ_QTY     tbl_size);
+
+static  void        OS_PendMultiListInsert (OS_PEND_DATA  *p_pend_data);
+
+static  void        OS_PendMultiListRemove (OS_PEND_DATA  *p_pend_data);
+
+#if (OS_CFG_FLAG_EN == DEF_ENABLED)
+static  void        OS_PendMultiFlagConsume(OS_PEND_DATA  *p_pend_data);
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                              PEND ON MULTIPLE OBJECTS
+*
+* Description: This function pends on multiple objects (semaphores, message queues and event flag groups) at once.
+*              The calling task is made ready-to-run as soon as ONE of the objects is posted, or when the timeout
+*              expires.  If one or more objects are already available when this function is called, all of them are
+*              acquired and the function returns immediately.
+*
+* Arguments  : p_pend_data_tbl   is a pointer to an array of OS_PEND_DATA, one entry per object to pend on.  For each
+*                                entry, the caller sets:
+*
+*                                    .PendObjPtr    a pointer to an OS_SEM, OS_Q or OS_FLAG_GRP (cast to OS_PEND_OBJ *)
+*                                    .FlagsPend     for event flag groups, the bit(s) to wait for
+*                                    .FlagsOpt      for event flag groups, one of:
+*
+*                                                       OS_OPT_PEND_FLAG_CLR_ALL
+*                                                       OS_OPT_PEND_FLAG_CLR_ANY
+*                                                       OS_OPT_PEND_FLAG_SET_ALL
+*                                                       OS_OPT_PEND_FLAG_SET_ANY
+*
+*                                                   optionally + OS_OPT_PEND_FLAG_CONSUME
+*
+*                                On return, .RdyObjPtr is equal to .PendObjPtr for each object that was acquired and
+*                                .RdyMsgPtr/.RdyMsgSize (queues), .RdyFlags (event flag groups) and .RdyTS hold what was
+*                                received.  .RdyObjPtr is NULL for the other entries.
+*
+*              tbl_size          is the number of entries in 'p_pend_data_tbl'
+*
+*              timeout           is an optional timeout period (in clock ticks).  If non-zero, your task will wait for
+*                                any of the objects up to the amount of time specified by this argument.  If you
+*                                specify 0, however, your task will wait forever or until one of the objects is posted.
+*
+*              opt               determines whether the user wants to block if none of the objects is available:
+*
+*                                    OS_OPT_PEND_BLOCKING
+*                                    OS_OPT_PEND_NON_BLOCKING
+*
+*              p_err             is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                    OS_ERR_NONE               At least one object is ready
+*                                    OS_ERR_OBJ_DEL            If an object was deleted (.RdyObjPtr identifies it)
+*                                    OS_ERR_OBJ_PTR_NULL       If an entry's .PendObjPtr is NULL or appears twice
+*                                    OS_ERR_OBJ_TYPE           If an entry is not a semaphore, queue or event flag group
+*                                    OS_ERR_OPT_INVALID        If you specified an invalid option ('opt' or .FlagsOpt)
+*                                    OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                    OS_ERR_PEND_ABORT         If the pend was aborted
+*                                    OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                    OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but no object was ready
+*                                    OS_ERR_PTR_INVALID        If 'p_pend_data_tbl' is NULL or 'tbl_size' is 0
+*                                    OS_ERR_Q_INLINE           If a queue was created with inline payloads
+*                                    OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                    OS_ERR_STATUS_INVALID     If the pend status is invalid
+*                                    OS_ERR_TIMEOUT            None of the objects was posted within the timeout
+*
+* Returns    : The number of objects acquired (i.e. the number of entries with a non-NULL .RdyObjPtr), 0 on error.
+*
+* Note(s)    : 1) Mutexes cannot be pended on with this function.
+*
+*              2) A task blocked in OSPendMulti() is linked in each object's OS_PEND_LIST .MultiHeadPtr list through its
+*                 OS_PEND_DATA entries, which MUST therefore remain valid (e.g. on the task's stack) until it returns.
+*                 A post to an object goes to the highest priority task waiting on it, whether it waits directly or
+*                 through OSPendMulti(); on equal priorities, tasks waiting directly are served first.
+*
+*              3) Event flags are consumed by the waiting task when it resumes, as with OSFlagPend().
+************************************************************************************************************************
+*/
+
+OS_OBJ_QTY  OSPendMulti (OS_PEND_DATA  *p_pend_data_tbl,
+                         OS_OBJ_QTY     tbl_size,
+                         OS_TICK        timeout,
+                         OS_OPT         opt,
+                         OS_ERR        *p_err)
+{
+    OS_PEND_DATA  *p_pend_data;
+    OS_OBJ_QTY     nbr_obj_rdy;
+    OS_OBJ_QTY     i;
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    OS_OBJ_QTY     j;
+#endif
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_PEND_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if ((p_pend_data_tbl == (OS_PEND_DATA *)0) ||               /* Validate the table                                   */
+        (tbl_size        == 0u)) {
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+    for (i = 0u; i < tbl_size; i++) {                           /* Each object MUST appear once, see Note #2            */
+        if (p_pend_data_tbl[i].PendObjPtr == (OS_PEND_OBJ *)0) {
+           *p_err = OS_ERR_OBJ_PTR_NULL;
+            return (0u);
+        }
+        for (j = i + 1u; j < tbl_size; j++) {
+            if (p_pend_data_tbl[j].PendObjPtr == p_pend_data_tbl[i].PendObjPtr) {
+               *p_err = OS_ERR_OBJ_PTR_NULL;
+                return (0u);
+            }
+        }
+    }
+#endif
+
+    for (i = 0u; i < tbl_size; i++) {                           /* Validate the object types & event flag options       */
+        p_pend_data = &p_pend_data_tbl[i];
+        switch (p_pend_data->PendObjPtr->Type) {
+#if (OS_CFG_SEM_EN == DEF_ENABLED)
+            case OS_OBJ_TYPE_SEM:
+                 break;
+#endif
+
+#if (OS_CFG_Q_EN == DEF_ENABLED)
+            case OS_OBJ_TYPE_Q:
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+                 if (OS_MSG_Q_IS_INLINE(&((OS_Q *)((void *)p_pend_data->PendObjPtr))->MsgQ)) {
+                    *p_err = OS_ERR_Q_INLINE;                   /* Inline payloads are read with OSQPendCopy()          */
+                     return (0u);
+                 }
+#endif
+                 break;
+#endif
+
+#if (OS_CFG_FLAG_EN == DEF_ENABLED)
+            case OS_OBJ_TYPE_FLAG:
+                 switch (p_pend_data->FlagsOpt & (OS_OPT)~OS_OPT_PEND_FLAG_CONSUME) {
+#if (OS_CFG_FLAG_MODE_CLR_EN == DEF_ENABLED)
+                     case OS_OPT_PEND_FLAG_CLR_ALL:
+                     case OS_OPT_PEND_FLAG_CLR_ANY:
+#endif
+                     case OS_OPT_PEND_FLAG_SET_ALL:
+                     case OS_OPT_PEND_FLAG_SET_ANY:
+                          break;
+
+                     default:
+                         *p_err = OS_ERR_OPT_INVALID;
+                          return (0u);
+                 }
+                 break;
+#endif
+
+            default:
+                *p_err = OS_ERR_OBJ_TYPE;
+                 return (0u);
+        }
+    }
+
+    CPU_CRITICAL_ENTER();
+    nbr_obj_rdy = OS_PendMultiGetRdy(p_pend_data_tbl,           /* Acquire the objects that are already available       */
+                                     tbl_size);
+    if (nbr_obj_rdy > 0u) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_NONE;
+        return (nbr_obj_rdy);
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;
+        return (0u);
+    } else {                                                    /* Yes                                                  */
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return (0u);
+        }
+    }
+
+    OSTCBCurPtr->PendDataTblPtr     = p_pend_data_tbl;          /* Block the task on all the objects                    */
+    OSTCBCurPtr->PendDataTblEntries = tbl_size;
+    OS_Pend((OS_PEND_OBJ *)0,
+            OS_TASK_PEND_ON_MULTI,
+            timeout);
+    OS_PendMultiInsert(OSTCBCurPtr);
+    CPU_CRITICAL_EXIT();
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    nbr_obj_rdy = 0u;
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* One of the objects was posted                        */
+             for (i = 0u; i < tbl_size; i++) {
+                 p_pend_data = &p_pend_data_tbl[i];
+                 if (p_pend_data->RdyObjPtr != (OS_PEND_OBJ *)0) {
+#if (OS_CFG_FLAG_EN == DEF_ENABLED)
+                     if (p_pend_data->PendObjPtr->Type == OS_OBJ_TYPE_FLAG) {
+                         OS_PendMultiFlagConsume(p_pend_data);  /* See Note #3                                          */
+                     }
+#endif
+                     nbr_obj_rdy++;
+                 }
+             }
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that no object was posted within timeout    */
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that an object pended on has been deleted   */
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+            *p_err = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+
+    return (nbr_obj_rdy);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          ACQUIRE THE OBJECTS ALREADY AVAILABLE
+*
+* Description: This function is called by OSPendMulti() to acquire all the objects of the table that are available
+*              without waiting.  It also clears the 'Rdy' members of the other entries.
+*
+* Arguments  : p_pend_data_tbl   is a pointer to the OS_PEND_DATA table
+*
+*              tbl_size          is the number of entries in the table
+*
+* Returns    : The number of objects acquired.
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+*
+*              2) This function is called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+static  OS_OBJ_QTY  OS_PendMultiGetRdy (OS_PEND_DATA  *p_pend_data_tbl,
+                                        OS_OBJ_QTY     tbl_size)
+{
+    OS_PEND_DATA  *p_pend_data;
+    OS_PEND_OBJ   *p_obj;
+    OS_OBJ_QTY     nbr_obj_rdy;
+    OS_OBJ_QTY     i;
+#if (OS_CFG_SEM_EN == DEF_ENABLED)
+    OS_SEM        *p_sem;
+#endif
+#if (OS_CFG_Q_EN == DEF_ENABLED)
+    OS_Q          *p_q;
+    void          *p_void;
+    OS_MSG_SIZE    msg_size;
+    OS_ERR         err;
+#endif
+#if (OS_CFG_FLAG_EN == DEF_ENABLED)
+    OS_FLAG_GRP   *p_grp;
+    OS_FLAGS       flags_rdy;
+#endif
+    CPU_TS         ts;
+
+
+    nbr_obj_rdy = 0u;
+    for (i = 0u; i < tbl_size; i++) {
+        p_pend_data             = &p_pend_data_tbl[i];
+        p_obj                   =  p_pend_data->PendObjPtr;
+        p_pend_data->PrevPtr    = (OS_PEND_DATA *)0;
+        p_pend_data->NextPtr    = (OS_PEND_DATA *)0;
+        p_pend_data->TCBPtr     = (OS_TCB       *)0;
+        p_pend_data->RdyObjPtr  = (OS_PEND_OBJ  *)0;
+#if (OS_CFG_FLAG_EN == DEF_ENABLED)
+        p_pend_data->RdyFlags   =                 0u;
+#endif
+#if (OS_MSG_EN == DEF_ENABLED)
+        p_pend_data->RdyMsgPtr  = (void         *)0;
+        p_pend_data->RdyMsgSize =                 0u;
+#endif
+        ts                      =                 0u;
+        switch (p_obj->Type) {
+#if (OS_CFG_SEM_EN == DEF_ENABLED)
+            case OS_OBJ_TYPE_SEM:
+                 p_sem = (OS_SEM *)((void *)p_obj);
+                 if (p_sem->Ctr > 0u) {                         /* Semaphore available?                                 */
+                     p_sem->Ctr--;                              /* Yes, take it                                         */
+                     p_pend_data->RdyObjPtr = p_obj;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+                     ts                     = p_sem->TS;
+#endif
+                 }
+                 break;
+#endif
+
+#if (OS_CFG_Q_EN == DEF_ENABLED)
+            case OS_OBJ_TYPE_Q:
+                 p_q    = (OS_Q *)((void *)p_obj);
+                 p_void = OS_MsgQGet(&p_q->MsgQ,                /* Any message waiting in the message queue?            */
+                                     &msg_size,
+                                     &ts,
+                                     &err);
+                 if (err == OS_ERR_NONE) {
+                     p_pend_data->RdyObjPtr  = p_obj;           /* Yes, take it                                         */
+                     p_pend_data->RdyMsgPtr  = p_void;
+                     p_pend_data->RdyMsgSize = msg_size;
+                 } else {
+                     ts                      = 0u;
+                 }
+                 break;
+#endif
+
+#if (OS_CFG_FLAG_EN == DEF_ENABLED)
+            case OS_OBJ_TYPE_FLAG:
+                 p_grp = (OS_FLAG_GRP *)((void *)p_obj);
+                 (void)OS_FlagRdyChk(p_grp,                     /* Desired flag(s) set or cleared?                      */
+                                     p_pend_data->FlagsPend,
+                                     p_pend_data->FlagsOpt,
+                                    &flags_rdy);
+                 if (flags_rdy != 0u) {
+                     p_pend_data->RdyObjPtr = p_obj;            /* Yes                                                  */
+                     p_pend_data->RdyFlags  = flags_rdy;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+                     ts                     = p_grp->TS;
+#endif
+                     OS_PendMultiFlagConsume(p_pend_data);
+                 }
+                 break;
+#endif
+
+            default:
+                 break;
+        }
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+        p_pend_data->RdyTS = ts;
+#else
+        (void)ts;
+#endif
+        if (p_pend_data->RdyObjPtr != (OS_PEND_OBJ *)0) {
+            nbr_obj_rdy++;
+        }
+    }
+    return (nbr_obj_rdy);
+}
+
+
+/*
+************************************************************************************************************************
+*                                        CONSUME THE EVENT FLAGS OF A READY ENTRY
+*
+* Description: This function clears (or sets, for the CLR modes) the event flags that made an entry ready when
+*              OS_OPT_PEND_FLAG_CONSUME was specified in .FlagsOpt.
+*
+* Arguments  : p_pend_data   is a pointer to the OS_PEND_DATA entry of an event flag group
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_FLAG_EN == DEF_ENABLED)
+static  void  OS_PendMultiFlagConsume (OS_PEND_DATA  *p_pend_data)
+{
+    OS_FLAG_GRP  *p_grp;
+
+
+    if ((p_pend_data->FlagsOpt & OS_OPT_PEND_FLAG_CONSUME) == 0u) {
+        return;
+    }
+    p_grp = (OS_FLAG_GRP *)((void *)p_pend_data->PendObjPtr);
+    switch (p_pend_data->FlagsOpt & OS_OPT_PEND_FLAG_MASK) {
+        case OS_OPT_PEND_FLAG_SET_ALL:
+        case OS_OPT_PEND_FLAG_SET_ANY:                          /* Clear ONLY the flags we got                          */
+             p_grp->Flags &= ~p_pend_data->RdyFlags;
+             break;
+
+#if (OS_CFG_FLAG_MODE_CLR_EN == DEF_ENABLED)
+        case OS_OPT_PEND_FLAG_CLR_ALL:
+        case OS_OPT_PEND_FLAG_CLR_ANY:                          /* Set   ONLY the flags we got                          */
+             p_grp->Flags |=  p_pend_data->RdyFlags;
+             break;
+#endif
+
+        default:
+             break;
+    }
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                     ABORT THE OSPendMulti() WAITERS OF AN OBJECT
+*
+* Description: This function is called when an object is deleted or its pend is aborted to make ready the tasks waiting
+*              on it through OSPendMulti().
+*
+* Arguments  : p_obj     is a pointer to the object
+*              -----
+*
+*              ts        is the timestamp of the abort
+*
+*              reason    is OS_STATUS_PEND_ABORT or OS_STATUS_PEND_DEL
+*
+*              all       DEF_YES  to abort all the OSPendMulti() waiters
+*                        DEF_NO   to abort the highest priority one only, and only if no task waiting directly on the
+*                                 object has the same or a higher priority
+*
+* Returns    : The number of tasks made ready.
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+OS_OBJ_QTY  OS_PendMultiAbortObj (OS_PEND_OBJ  *p_obj,
+                                  CPU_TS        ts,
+                                  OS_STATUS     reason,
+                                  CPU_BOOLEAN   all)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_PEND_DATA  *p_pend_data;
+    OS_OBJ_QTY     nbr_tasks;
+
+
+    nbr_tasks   = 0u;
+    p_pend_list = &p_obj->PendList;
+    p_pend_data =  p_pend_list->MultiHeadPtr;
+    while (p_pend_data != (OS_PEND_DATA *)0) {
+        if ((all                  == DEF_NO) &&
+            (p_pend_list->HeadPtr != (OS_TCB *)0)) {
+            if (p_pend_list->HeadPtr->Prio <= p_pend_data->TCBPtr->Prio) {
+                break;                                          /* A task waiting directly goes first                   */
+            }
+        }
+        p_pend_data->RdyObjPtr = p_obj;                         /* Tell the task which object was deleted/aborted       */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+        p_pend_data->RdyTS     = ts;
+#endif
+        OS_PendAbort(p_pend_data->TCBPtr,                       /* Also unlinks all the entries of the task             */
+                     ts,
+                     reason);
+        nbr_tasks++;
+        if (all == DEF_NO) {
+            break;
+        }
+        p_pend_data = p_pend_list->MultiHeadPtr;
+    }
+    return (nbr_tasks);
+}
+
+
+/*
+************************************************************************************************************************
+*                                CHANGE THE PRIORITY OF A TASK WAITING IN OSPendMulti()
+*
+* Description: This function is called to re-sort the OS_PEND_DATA entries of a task whose priority changed.
+*
+* Arguments  : p_tcb     is a pointer to the OS_TCB of the task; .Prio contains the NEW priority
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : This function is INTERNAL to uC/OS-III and your application should not call it.
+************************************************************************************************************************
+*/
+
+void  OS_PendMultiChangePrio (OS_TCB  *p_tcb)
+{
+    OS_PEND_DATA  *p_pend_data;
+    OS_OBJ_QTY     i;
+
+
+    p_pend_data = p_tcb->PendDataTblPtr;
+    for (i = 0u; i < p_tcb->PendDataTblEntries; i++) {
+        OS_PendMultiListRemove(p_pend_data);
+        OS_PendMultiListInsert(p_pend_data);
+        p_pend_data++;
+    }
+}
+
+
+/*
+************************************************************************************************************************
+*                              LINK/UNLINK THE ENTRIES OF A TASK WAITING IN OSPendMulti()
+*
+* Description: OS_PendMultiInsert() links each OS_PEND_DATA entry of a task in the OSPendMulti() waiter list of its
+*              object.  OS_PendMultiRemove() unlinks them all.
+*
+* Arguments  : p_tcb     is a pointer to the OS_TCB of the task
+*              -----
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application should not call them.
+*
+*              2) OS_PendMultiRemove() is called by OS_PendListRemove(), so a task leaving OSPendMulti() for any reason
+*                 (post, timeout, abort, deletion) is unlinked from all the objects.
+************************************************************************************************************************
+*/
+
+void  OS_PendMultiInsert (OS_TCB  *p_tcb)
+{
+    OS_PEND_DATA  *p_pend_data;
+    OS_OBJ_QTY     i;
+
+
+    p_pend_data = p_tcb->PendDataTblPtr;
+    for (i = 0u; i < p_tcb->PendDataTblEntries; i++) {
+        p_pend_data->TCBPtr = p_tcb;
+        OS_PendMultiListInsert(p_pend_data);
+        p_pend_data++;
+    }
+}
+
+
+void  OS_PendMultiRemove (OS_TCB  *p_tcb)
+{
+    OS_PEND_DATA  *p_pend_data;
+    OS_OBJ_QTY     i;
+
+
+    p_pend_data = p_tcb->PendDataTblPtr;
+    for (i = 0u; i < p_tcb->PendDataTblEntries; i++) {
+        OS_PendMultiListRemove(p_pend_data);
+        p_pend_data++;
+    }
+    p_tcb->PendDataTblPtr     = (OS_PEND_DATA *)0;
+    p_tcb->PendDataTblEntries =                 0u;
+}
+
+
+/*
+************************************************************************************************************************
+*                                    MAKE READY A TASK WAITING IN OSPendMulti()
+*
+* Description: OS_PendMultiPost() makes ready the task owning an OS_PEND_DATA entry because the entry's object was
+*              posted.  OS_PendMultiPostObj() is called by the post functions before they look at the tasks waiting
+*              directly on the object.
+*
+* Arguments  : p_pend_data   is a pointer to the entry of the object posted
+*              -----------
+*
+*              p_obj         is a pointer to the object posted
+*              -----
+*
+*              p_void        is the message posted (OS_Q only)
+*
+*              msg_size      is the size of the message posted (OS_Q only)
+*
+*              ts            is the timestamp of the post
+*
+*              opt           is the post option; with OS_OPT_POST_ALL, all the OSPendMulti() waiters are made ready
+*
+* Returns    : OS_PendMultiPostObj() returns DEF_YES if the post was consumed by a task waiting in OSPendMulti(), i.e.
+*              if that task has a strictly higher priority than the tasks waiting directly on the object.  It returns
+*              DEF_NO otherwise, and always with OS_OPT_POST_ALL.
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call them.
+************************************************************************************************************************
+*/
+
+void  OS_PendMultiPost (OS_PEND_DATA  *p_pend_data,
+                        void          *p_void,
+                        OS_MSG_SIZE    msg_size,
+                        CPU_TS         ts)
+{
+    OS_TCB  *p_tcb;
+
+
+    p_tcb                   = p_pend_data->TCBPtr;
+    p_pend_data->RdyObjPtr  = p_pend_data->PendObjPtr;
+#if (OS_MSG_EN == DEF_ENABLED)
+    p_pend_data->RdyMsgPtr  = p_void;
+    p_pend_data->RdyMsgSize = msg_size;
+#endif
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    p_pend_data->RdyTS      = ts;
+#endif
+    OS_PendMultiRemove(p_tcb);                                  /* Unlink from all the objects                          */
+    OS_Post((OS_PEND_OBJ *)0,                                   /* Make task ready-to-run                               */
+            p_tcb,
+            p_void,
+            msg_size,
+            ts);
+}
+
+
+CPU_BOOLEAN  OS_PendMultiPostObj (OS_PEND_OBJ  *p_obj,
+                                  void         *p_void,
+                                  OS_MSG_SIZE   msg_size,
+                                  CPU_TS        ts,
+                                  OS_OPT        opt)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_PEND_DATA  *p_pend_data;
+    OS_PEND_DATA  *p_pend_data_next;
+
+
+    p_pend_list = &p_obj->PendList;
+    p_pend_data =  p_pend_list->MultiHeadPtr;
+    if ((opt & OS_OPT_POST_ALL) != 0u) {                        /* Broadcast: post to all the OSPendMulti() waiters ... */
+        while (p_pend_data != (OS_PEND_DATA *)0) {
+            p_pend_data_next = p_pend_data->NextPtr;
+            OS_PendMultiPost(p_pend_data,
+                             p_void,
+                             msg_size,
+                             ts);
+            p_pend_data      = p_pend_data_next;
+        }
+        return (DEF_NO);                                        /* ... and to the tasks waiting directly                */
+    }
+
+    if (p_pend_data == (OS_PEND_DATA *)0) {
+        return (DEF_NO);
+    }
+    if (p_pend_list->HeadPtr != (OS_TCB *)0) {
+        if (p_pend_list->HeadPtr->Prio <= p_pend_data->TCBPtr->Prio) {
+            return (DEF_NO);                                    /* A task waiting directly goes first                   */
+        }
+    }
+    OS_PendMultiPost(p_pend_data,
+                     p_void,
+                     msg_size,
+                     ts);
+    return (DEF_YES);
+}
+
+
+/*
+************************************************************************************************************************
+*                             INSERT/REMOVE AN ENTRY IN/FROM AN OSPendMulti() WAITER LIST
+*
+* Description: These functions keep the OSPendMulti() waiter list of an object sorted by task priority, FIFO among tasks
+*              of the same priority.
+*
+* Arguments  : p_pend_data   is a pointer to the OS_PEND_DATA entry; .TCBPtr and .PendObjPtr MUST be set
+*              -----------
+*
+* Returns    : none
+*
+* Note(s)    : These functions are INTERNAL to uC/OS-III and your application should not call them.
+************************************************************************************************************************
+*/
+
+static  void  OS_PendMultiListInsert (OS_PEND_DATA  *p_pend_data)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_PEND_DATA  *p_prev;
+    OS_PEND_DATA  *p_next;
+    OS_PRIO        prio;
+
+
+    p_pend_list = &p_pend_data->PendObjPtr->PendList;
+    prio        =  p_pend_data->TCBPtr->Prio;
+    p_prev      = (OS_PEND_DATA *)0;
+    p_next      =  p_pend_list->MultiHeadPtr;
+    while ((p_next               != (OS_PEND_DATA *)0) &&       /* Find the first entry of a lower priority task        */
+           (p_next->TCBPtr->Prio <= prio)) {
+        p_prev = p_next;
+        p_next = p_next->NextPtr;
+    }
+
+    p_pend_data->PrevPtr = p_prev;
+    p_pend_data->NextPtr = p_next;
+    if (p_prev == (OS_PEND_DATA *)0) {
+        p_pend_list->MultiHeadPtr = p_pend_data;
+    } else {
+        p_prev->NextPtr           = p_pend_data;
+    }
+    if (p_next != (OS_PEND_DATA *)0) {
+        p_next->PrevPtr           = p_pend_data;
+    }
+}
+
+
+static  void  OS_PendMultiListRemove (OS_PEND_DATA  *p_pend_data)
+{
+    OS_PEND_LIST  *p_pend_list;
+    OS_PEND_DATA  *p_prev;
+    OS_PEND_DATA  *p_next;
+
+
+    p_pend_list = &p_pend_data->PendObjPtr->PendList;
+    p_prev      =  p_pend_data->PrevPtr;
+    p_next      =  p_pend_data->NextPtr;
+    if (p_prev == (OS_PEND_DATA *)0) {
+        p_pend_list->MultiHeadPtr = p_next;
+    } else {
+        p_prev->NextPtr           = p_next;
+    }
+    if (p_next != (OS_PEND_DATA *)0) {
+        p_next->PrevPtr           = p_prev;
+    }
+    p_pend_data->PrevPtr = (OS_PEND_DATA *)0;
+    p_pend_data->NextPtr = (OS_PEND_DATA *)0;
+}
+#endif
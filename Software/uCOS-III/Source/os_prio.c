@@ -44,6 +44,10 @@ CPU_DATA   OSPrioTbl[OS_PRIO_TBL_SIZE];                         /* Declare the a
                                                                 /* ... optimization.  In other words, this allows the ...*/
                                                                 /* ... table to be located in fast memory                */
 
+#if (OS_PRIO_GRP_EN == DEF_ENABLED)
+CPU_DATA   OSPrioGrp;                                           /* Bit 'n' (MSB first) set when OSPrioTbl[n] is non-zero */
+#endif
+
 /*
 ************************************************************************************************************************
 *                                               INITIALIZE THE PRIORITY LIST
@@ -67,6 +71,9 @@ void  OS_PrioInit (void)
     for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {
          OSPrioTbl[i] = 0u;
     }
+#if (OS_PRIO_GRP_EN == DEF_ENABLED)
+    OSPrioGrp = 0u;
+#endif
 
 #if (OS_CFG_TASK_IDLE_EN == DEF_DISABLED)
     OS_PrioInsert ((OS_PRIO)(OS_CFG_PRIO_MAX - 1u));            /* Insert what would be the idle task                   */
@@ -85,11 +92,23 @@ void  OS_PrioInit (void)
 * Returns    : The priority of the Highest Priority Task (HPT) waiting for the event
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With OS_CFG_PRIO_BITMAP_2L_EN, OSPrioGrp tells which OSPrioTbl[] entry holds the highest priority
+*                 so that the lookup takes two count leading zeros regardless of OS_CFG_PRIO_MAX.  Otherwise the
+*                 table is scanned, which is as fast when OS_CFG_PRIO_MAX fits in a few CPU_DATA words.
 ************************************************************************************************************************
 */
 
 OS_PRIO  OS_PrioGetHighest (void)
 {
+#if (OS_PRIO_GRP_EN == DEF_ENABLED)
+    OS_PRIO    ix;
+
+
+    ix = (OS_PRIO)CPU_CntLeadZeros(OSPrioGrp);                  /* See Note #2                                          */
+
+    return ((OS_PRIO)((ix * (OS_PRIO)DEF_INT_CPU_NBR_BITS) + (OS_PRIO)CPU_CntLeadZeros(OSPrioTbl[ix])));
+#else
     CPU_DATA  *p_tbl;
     OS_PRIO    prio;
 
@@ -105,6 +124,7 @@ OS_PRIO  OS_PrioGetHighest (void)
     prio += (OS_PRIO)CPU_CntLeadZeros(*p_tbl);                  /* Find the position of the first bit set at the entry  */
 
     return (prio);
+#endif
 }
 
 /*
@@ -118,6 +138,9 @@ OS_PRIO  OS_PrioGetHighest (void)
 * Returns    : none
 *
 * Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) With OS_CFG_SCHED_EDF_EN, all the priorities of the EDF band are represented by the bit of
+*                 OS_CFG_SCHED_EDF_PRIO_HI.  The bit is removed by OS_EdfRemove() once no task of the band is ready.
 ************************************************************************************************************************
 */
 
@@ -127,6 +150,11 @@ void  OS_PrioInsert (OS_PRIO  prio)
     CPU_DATA  bit_nbr;
     OS_PRIO   ix;
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    if (OS_EDF_PRIO_IN_BAND(prio)) {                            /* See Note #2                                          */
+        prio = OS_CFG_SCHED_EDF_PRIO_HI;
+    }
+#endif
 #if (OS_CFG_PRIO_MAX > DEF_INT_CPU_NBR_BITS)
     ix             = prio / (OS_PRIO)DEF_INT_CPU_NBR_BITS;
     bit_nbr        = (CPU_DATA)prio & (DEF_INT_CPU_NBR_BITS - 1u);
@@ -137,6 +165,11 @@ void  OS_PrioInsert (OS_PRIO  prio)
     bit            = 1u;
     bit          <<= (DEF_INT_CPU_NBR_BITS - 1u) - bit_nbr;
     OSPrioTbl[ix] |= bit;
+#if (OS_PRIO_GRP_EN == DEF_ENABLED)
+    bit            = 1u;
+    bit          <<= (DEF_INT_CPU_NBR_BITS - 1u) - ix;
+    OSPrioGrp     |= bit;                                       /* Entry 'ix' is now non-empty                          */
+#endif
 }
 
 /*
@@ -169,4 +202,11 @@ void  OS_PrioRemove (OS_PRIO  prio)
     bit            = 1u;
     bit          <<= (DEF_INT_CPU_NBR_BITS - 1u) - bit_nbr;
     OSPrioTbl[ix] &= ~bit;
+#if (OS_PRIO_GRP_EN == DEF_ENABLED)
+    if (OSPrioTbl[ix] == 0u) {                                  /* Entry 'ix' is now empty                              */
+        bit          = 1u;
+        bit        <<= (DEF_INT_CPU_NBR_BITS - 1u) - ix;
+        OSPrioGrp   &= ~bit;
+    }
+#endif
 }
@@ -134,6 +134,107 @@ void  OSQCreate (OS_Q        *p_q,
 }
 
 
+/*
+************************************************************************************************************************
+*                                       CREATE A MESSAGE QUEUE WITH ITS OWN SLOTS
+*
+* Description: This function creates a message queue that takes its OS_MSGs from a slot array supplied by the caller
+*              instead of the global pool of OS_MSGs, so it can't run out of OS_MSGs because of another queue.
+*              Optionally, each slot also stores a copy of the message payload.
+*
+* Arguments  : p_q         is a pointer to the message queue
+*
+*              p_name      is a pointer to an ASCII string that will be used to name the message queue
+*
+*              p_msg_tbl   is a pointer to an array of 'max_qty' OS_MSGs used as the slots of the queue
+*
+*              max_qty     indicates the maximum size of the message queue (must be non-zero).
+*
+*              p_data      is a pointer to 'max_qty' * 'data_size' bytes used to store the payloads, or a NULL pointer
+*                          if the queue carries pointers like a queue created by OSQCreate().
+*
+*              data_size   is the largest payload, in bytes, that can be posted to the queue (ignored if 'p_data' is
+*                          a NULL pointer)
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                    The call was successful
+*                              OS_ERR_CREATE_ISR              Can't create from an ISR
+*                              OS_ERR_ILLEGAL_CREATE_RUN_TIME If you are trying to create the Queue after you called
+*                                                               OSSafetyCriticalStart()
+*                              OS_ERR_MSG_POOL_NULL_PTR       If you passed a NULL pointer for 'p_msg_tbl'
+*                              OS_ERR_OBJ_PTR_NULL            If you passed a NULL pointer for 'p_q'
+*                              OS_ERR_Q_MSG_SIZE              If 'p_data' is not NULL and 'data_size' is 0
+*                              OS_ERR_Q_SIZE                  If the size you specified is 0
+*
+* Returns    : none
+*
+* Note(s)    : 1) With inline payloads, OSQPost() copies 'msg_size' bytes from 'p_void' into a free slot, or directly
+*                 into the buffer of a task waiting in OSQPendCopy().  The data posted can be reused as soon as
+*                 OSQPost() returns.
+*
+*              2) A queue with inline payloads is read with OSQPendCopy() or OSQPendN(): OSQPend() and OSPendMulti()
+*                 return OS_ERR_Q_INLINE.
+*
+*              3) When posts from ISRs are deferred (OS_CFG_ISR_POST_DEFERRED_EN), OSQPost() still copies the data
+*                 posted by an ISR into a slot before returning, so the ISR can also reuse its buffer at once (see
+*                 'OSQPost()  Note #1').
+*
+*              4) Task message queues get their own slots from OSTaskQSlotsSet(), without inline payloads.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+void  OSQCreateSlots (OS_Q         *p_q,
+                      CPU_CHAR     *p_name,
+                      OS_MSG       *p_msg_tbl,
+                      OS_MSG_QTY    max_qty,
+                      void         *p_data,
+                      OS_MSG_SIZE   data_size,
+                      OS_ERR       *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_msg_tbl == (OS_MSG *)0) {                             /* Validate the slots                                   */
+       *p_err = OS_ERR_MSG_POOL_NULL_PTR;
+        return;
+    }
+    if ((p_data    != (void *)0) &&
+        (data_size ==         0u)) {
+       *p_err = OS_ERR_Q_MSG_SIZE;
+        return;
+    }
+#endif
+
+    OSQCreate(p_q,                                              /* Create the queue on the global pool ...              */
+              p_name,
+              max_qty,
+              p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    OS_MsgPoolCreate(&p_q->Pool,                                /* ... and switch it to its own slots                   */
+                      p_msg_tbl,
+                      max_qty,
+                      p_data,
+                      data_size);
+    p_q->MsgQ.PoolPtr = &p_q->Pool;
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                               DELETE A MESSAGE QUEUE
@@ -237,7 +338,7 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
     nbr_tasks   = 0u;
     switch (opt) {
         case OS_OPT_DEL_NO_PEND:                                /* Delete message queue only if no task waiting         */
-             if (p_pend_list->HeadPtr == (OS_TCB *)0) {
+             if (OS_PEND_LIST_IS_EMPTY(p_pend_list)) {
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
                  OS_QDbgListRemove(p_q);
                  OSQQty--;
@@ -265,6 +366,13 @@ OS_OBJ_QTY  OSQDel (OS_Q    *p_q,
                               OS_STATUS_PEND_DEL);
                  nbr_tasks++;
              }
+#if (OS_CFG_PEND_MULTI_EN == DEF_ENABLED)
+                                                                /* ... and all the tasks waiting in OSPendMulti()       */
+             nbr_tasks += OS_PendMultiAbortObj((OS_PEND_OBJ *)((void *)p_q),
+                                               ts,
+                                               OS_STATUS_PEND_DEL,
+                                               DEF_YES);
+#endif
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
              OS_QDbgListRemove(p_q);
              OSQQty--;
@@ -403,6 +511,7 @@ OS_MSG_QTY  OSQFlush (OS_Q    *p_q,
 *                                OS_ERR_PEND_ISR           If you called this function from an ISR
 *                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the queue was not empty
 *                                OS_ERR_PTR_INVALID        If you passed a NULL pointer of 'p_msg_size'
+*                                OS_ERR_Q_INLINE           If the queue was created with inline payloads
 *                                OS_ERR_SCHED_LOCKED       The scheduler is locked
 *                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
 *                                OS_ERR_TIMEOUT            A message was not received within the specified timeout
@@ -490,6 +599,15 @@ void  *OSQPend (OS_Q         *p_q,
     }
 #endif
 
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+    if (OS_MSG_Q_IS_INLINE(&p_q->MsgQ)) {                       /* Inline payloads are read with OSQPendCopy()          */
+        OS_TRACE_Q_PEND_FAILED(p_q);
+        OS_TRACE_Q_PEND_EXIT(OS_ERR_Q_INLINE);
+       *p_err = OS_ERR_Q_INLINE;
+        return ((void *)0);
+    }
+#endif
+
     if (p_ts != (CPU_TS *)0) {
        *p_ts = 0u;                                              /* Initialize the returned timestamp                    */
     }
@@ -681,7 +799,7 @@ OS_OBJ_QTY  OSQPendAbort (OS_Q    *p_q,
 
     CPU_CRITICAL_ENTER();
     p_pend_list = &p_q->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on queue?                           */
+    if (OS_PEND_LIST_IS_EMPTY(p_pend_list)) {                   /* Any task waiting on queue?                           */
         CPU_CRITICAL_EXIT();                                    /* No                                                   */
        *p_err =  OS_ERR_PEND_ABORT_NONE;
         return (0u);
@@ -693,7 +811,15 @@ OS_OBJ_QTY  OSQPendAbort (OS_Q    *p_q,
 #else
     ts        = 0u;
 #endif
-    while (p_pend_list->HeadPtr != (OS_TCB *)0) {
+#if (OS_CFG_PEND_MULTI_EN == DEF_ENABLED)
+                                                                /* Tasks in OSPendMulti() first if higher priority      */
+    nbr_tasks = OS_PendMultiAbortObj((OS_PEND_OBJ *)((void *)p_q),
+                                     ts,
+                                     OS_STATUS_PEND_ABORT,
+                                     (opt == OS_OPT_PEND_ABORT_ALL) ? DEF_YES : DEF_NO);
+#endif
+    while ((p_pend_list->HeadPtr != (OS_TCB *)0) &&
+           ((nbr_tasks == 0u) || (opt == OS_OPT_PEND_ABORT_ALL))) {
         p_tcb = p_pend_list->HeadPtr;
         OS_PendAbort(p_tcb,
                      ts,
@@ -715,6 +841,337 @@ OS_OBJ_QTY  OSQPendAbort (OS_Q    *p_q,
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                      PEND ON A QUEUE AND COPY THE MESSAGE RECEIVED
+*
+* Description: This function waits for a message to be sent to a queue and copies the message payload into a buffer.
+*              It is the only way, with OSQPendN(), to read a queue created with inline payloads.
+*
+* Arguments  : p_q           is a pointer to the message queue
+*
+*              p_buf         is a pointer to the buffer that will receive the payload
+*
+*              buf_size      is the size of the buffer; longer messages are truncated
+*
+*              timeout       is an optional timeout period (in clock ticks), as for OSQPend()
+*
+*              opt           determines whether the user wants to block if the queue is empty or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the message was
+*                            received, pend aborted or the message queue deleted.  A NULL pointer is valid.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               The call was successful and your task received a message
+*                                OS_ERR_OBJ_DEL            If 'p_q' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If you pass a NULL pointer for 'p_q'
+*                                OS_ERR_OBJ_TYPE           If the message queue was not created
+*                                OS_ERR_OPT_INVALID        You specified an invalid option
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         The pend was aborted
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the queue was empty
+*                                OS_ERR_PTR_INVALID        If you passed a NULL pointer for 'p_buf'
+*                                OS_ERR_SCHED_LOCKED       The scheduler is locked
+*                                OS_ERR_STATUS_INVALID     If the pend status has an invalid value
+*                                OS_ERR_TIMEOUT            A message was not received within the specified timeout
+*
+* Returns    : The number of bytes copied into 'p_buf'
+*
+* Note(s)    : 1) On a queue carrying pointers, the payload is the 'msg_size' bytes the message points to.
+*
+*              2) While the task waits, 'p_buf' is kept in .MsgPtr so that OSQPost() can copy an inline payload
+*                 straight into it.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+OS_MSG_SIZE  OSQPendCopy (OS_Q         *p_q,
+                          void         *p_buf,
+                          OS_MSG_SIZE   buf_size,
+                          OS_TICK       timeout,
+                          OS_OPT        opt,
+                          CPU_TS       *p_ts,
+                          OS_ERR       *p_err)
+{
+    void         *p_void;
+    OS_MSG_SIZE   msg_size;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        OS_TRACE_Q_PEND_FAILED(p_q);
+       *p_err = OS_ERR_PEND_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_q == (OS_Q *)0) {                                     /* Validate arguments                                   */
+        OS_TRACE_Q_PEND_FAILED(p_q);
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    if (p_buf == (void *)0) {
+        OS_TRACE_Q_PEND_FAILED(p_q);
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    switch (opt) {
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+             OS_TRACE_Q_PEND_FAILED(p_q);
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+        OS_TRACE_Q_PEND_FAILED(p_q);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    if (p_ts != (CPU_TS *)0) {
+       *p_ts = 0u;                                              /* Initialize the returned timestamp                    */
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_void = OS_MsgQGet(&p_q->MsgQ,                             /* Any message waiting in the message queue?            */
+                       &msg_size,
+                        p_ts,
+                        p_err);
+    if (*p_err == OS_ERR_NONE) {
+        OS_TRACE_Q_PEND(p_q);
+        if (msg_size > buf_size) {
+            msg_size = buf_size;
+        }
+        if (OS_MSG_Q_IS_INLINE(&p_q->MsgQ)) {                   /* Copy before the slot can be reused                   */
+            OS_MsgCopy(p_buf, p_void, msg_size);
+            CPU_CRITICAL_EXIT();
+        } else {
+            CPU_CRITICAL_EXIT();
+            OS_MsgCopy(p_buf, p_void, msg_size);
+        }
+        return (msg_size);
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_Q_PEND_FAILED(p_q);
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;                        /* No                                                   */
+        return (0u);
+    } else {
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+            CPU_CRITICAL_EXIT();
+            OS_TRACE_Q_PEND_FAILED(p_q);
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return (0u);
+        }
+    }
+
+    OSTCBCurPtr->MsgPtr  = p_buf;                               /* See Note #2                                          */
+    OSTCBCurPtr->MsgSize = buf_size;
+    OS_Pend((OS_PEND_OBJ *)((void *)p_q),                       /* Block task pending on Message Queue                  */
+            OS_TASK_PEND_ON_Q,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OS_TRACE_Q_PEND_BLOCK(p_q);
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    p_void   = (void *)0;
+    msg_size = 0u;
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* Extract message from TCB (Put there by Post)         */
+             p_void   = OSTCBCurPtr->MsgPtr;
+             msg_size = OSTCBCurPtr->MsgSize;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_Q_PEND(p_q);
+            *p_err    = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_Q_PEND_FAILED(p_q);
+            *p_err    = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get event within TO          */
+             OS_TRACE_Q_PEND_FAILED(p_q);
+            *p_err    = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_Q_PEND_FAILED(p_q);
+            *p_err    = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+             OS_TRACE_Q_PEND_FAILED(p_q);
+            *p_err    = OS_ERR_STATUS_INVALID;
+             break;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if ((*p_err  == OS_ERR_NONE) &&                             /* A pointer was posted: copy what it points to         */
+        (p_void  != p_buf)) {
+        if (msg_size > buf_size) {
+            msg_size = buf_size;
+        }
+        OS_MsgCopy(p_buf, p_void, msg_size);
+    }
+    return (msg_size);
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                         PEND ON A QUEUE FOR SEVERAL MESSAGES
+*
+* Description: This function waits for at least one message to be sent to a queue, then copies up to 'qty' messages
+*              into an array of records.
+*
+* Arguments  : p_q           is a pointer to the message queue
+*
+*              p_buf         is a pointer to an array of 'qty' records of 'msg_size' bytes each
+*
+*              msg_size      is the size of a record; each message is copied at the start of its record and
+*                            truncated to 'msg_size' bytes
+*
+*              qty           is the maximum number of messages to receive
+*
+*              timeout       is an optional timeout period (in clock ticks) for the first message
+*
+*              opt           determines whether the user wants to block if the queue is empty or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of the first message.  A NULL
+*                            pointer is valid.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               At least one message was received
+*                                OS_ERR_Q_SIZE             If 'qty' is 0
+*                                Other                     See OSQPendCopy()
+*
+* Returns    : The number of messages received
+*
+* Note(s)    : 1) Only the first message can block.  The others are the messages already in the queue.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+OS_MSG_QTY  OSQPendN (OS_Q         *p_q,
+                      void         *p_buf,
+                      OS_MSG_SIZE   msg_size,
+                      OS_MSG_QTY    qty,
+                      OS_TICK       timeout,
+                      OS_OPT        opt,
+                      CPU_TS       *p_ts,
+                      OS_ERR       *p_err)
+{
+    CPU_INT08U   *p_rec;
+    void         *p_void;
+    OS_MSG_SIZE   size;
+    OS_MSG_QTY    nbr;
+    OS_ERR        err;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (qty == 0u) {
+       *p_err = OS_ERR_Q_SIZE;
+        return (0u);
+    }
+#endif
+
+    (void)OSQPendCopy(p_q,                                      /* Wait for the first message                           */
+                      p_buf,
+                      msg_size,
+                      timeout,
+                      opt,
+                      p_ts,
+                      p_err);
+    if (*p_err != OS_ERR_NONE) {
+        return (0u);
+    }
+
+    p_rec = (CPU_INT08U *)p_buf;
+    for (nbr = 1u; nbr < qty; nbr++) {                          /* Drain the messages already in the queue              */
+        p_rec += msg_size;
+        CPU_CRITICAL_ENTER();
+        p_void = OS_MsgQGet(&p_q->MsgQ,
+                           &size,
+                            (CPU_TS *)0,
+                           &err);
+        if (err != OS_ERR_NONE) {
+            CPU_CRITICAL_EXIT();
+            break;
+        }
+        if (size > msg_size) {
+            size = msg_size;
+        }
+        if (OS_MSG_Q_IS_INLINE(&p_q->MsgQ)) {
+            OS_MsgCopy((void *)p_rec, p_void, size);
+            CPU_CRITICAL_EXIT();
+        } else {
+            CPU_CRITICAL_EXIT();
+            OS_MsgCopy((void *)p_rec, p_void, size);
+        }
+    }
+    return (nbr);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                               POST MESSAGE TO A QUEUE
@@ -761,10 +1218,15 @@ OS_OBJ_QTY  OSQPendAbort (OS_Q    *p_q,
 *                                OS_ERR_OPT_INVALID       You specified an invalid option
 *                                OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
 *                                OS_ERR_Q_MAX             If the queue is full
+*                                OS_ERR_Q_MSG_SIZE        If 'msg_size' is larger than the slots of an inline queue
 *
 * Returns    : None
 *
-* Note(s)    : none
+* Note(s)    : 1) With OS_CFG_ISR_POST_DEFERRED_EN, a post from an ISR to a queue with inline payloads copies the
+*                 payload in a slot of the queue before returning, since the ISR may reuse the buffer at 'p_void' as
+*                 soon as OSQPost() returns.  If tasks are waiting, the ISR handler task then hands the queued message
+*                 over to them (see OS_QPostDeferred()).  If the ISR post queue is full, OS_ERR_INT_Q_FULL is returned
+*                 but the message stays in the queue, for the next OSQPendCopy().
 ************************************************************************************************************************
 */
 
@@ -774,10 +1236,7 @@ void  OSQPost (OS_Q         *p_q,
                OS_OPT        opt,
                OS_ERR       *p_err)
 {
-    OS_OPT         post_type;
-    OS_PEND_LIST  *p_pend_list;
-    OS_TCB        *p_tcb;
-    OS_TCB        *p_tcb_next;
+    CPU_BOOLEAN    rdy;
     CPU_TS         ts;
     CPU_SR_ALLOC();
 
@@ -833,56 +1292,250 @@ void  OSQPost (OS_Q         *p_q,
         return;
     }
 #endif
+
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+    if ((OS_MSG_Q_IS_INLINE(&p_q->MsgQ)) &&                     /* Payload must fit in a slot                           */
+        (msg_size > p_q->MsgQ.PoolPtr->DataSize)) {
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_Q_MSG_SIZE);
+       *p_err = OS_ERR_Q_MSG_SIZE;
+        return;
+    }
+#endif
+
 #if (OS_CFG_TS_EN == DEF_ENABLED)
-    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+    ts = OS_POST_TS_GET();                                      /* Get timestamp                                        */
 #else
     ts = 0u;
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Called from an ISR?                                  */
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+        if (OS_MSG_Q_IS_INLINE(&p_q->MsgQ)) {                   /* Yes, copy an inline payload now (see Note #1)        */
+            CPU_CRITICAL_ENTER();
+            OS_MsgQPut(&p_q->MsgQ,
+                       p_void,
+                       msg_size,
+                       opt,
+                       ts,
+                       p_err);
+            if (OS_PEND_LIST_IS_EMPTY(&p_q->PendList)) {
+                rdy = DEF_NO;
+            } else {
+                rdy = DEF_YES;
+            }
+            CPU_CRITICAL_EXIT();
+            if (*p_err != OS_ERR_NONE) {
+                OS_TRACE_Q_POST_FAILED(p_q);
+                OS_TRACE_Q_POST_EXIT(*p_err);
+                return;
+            }
+            if (rdy == DEF_NO) {                                /* No task waiting, the message is in the queue         */
+                OS_TRACE_Q_POST_EXIT(*p_err);
+                return;
+            }
+            p_void = (void *)0;                                 /* Payload is queued, only the hand-over is deferred    */
+        }
+#endif
+        OS_IntQPost(OS_OBJ_TYPE_Q,                              /* Defer the post to the ISR handler task               */
+                    (void *)p_q,
+                    p_void,
+                    msg_size,
+                    0u,
+                    opt,
+                    ts,
+                    p_err);
+        OS_TRACE_Q_POST_EXIT(*p_err);
+        return;
+    }
+#endif
+
     OS_TRACE_Q_POST(p_q);
 
     CPU_CRITICAL_ENTER();
-    p_pend_list = &p_q->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on message queue?                   */
-        if ((opt & OS_OPT_POST_LIFO) == 0u) {                   /* Determine whether we post FIFO or LIFO               */
-            post_type = OS_OPT_POST_FIFO;
-        } else {
-            post_type = OS_OPT_POST_LIFO;
-        }
-        OS_MsgQPut(&p_q->MsgQ,                                  /* Place message in the message queue                   */
+    rdy = OS_QPost(p_q,
                    p_void,
                    msg_size,
-                   post_type,
+                   opt,
                    ts,
                    p_err);
-        CPU_CRITICAL_EXIT();
-        OS_TRACE_Q_POST_EXIT(*p_err);
-        return;
+    CPU_CRITICAL_EXIT();
+
+    if ((rdy == DEF_YES) &&
+        ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+        OSSched();                                              /* Run the scheduler                                    */
     }
 
-    p_tcb = p_pend_list->HeadPtr;
-    while (p_tcb != (OS_TCB *)0) {
-        p_tcb_next = p_tcb->PendNextPtr;
-        OS_Post((OS_PEND_OBJ *)((void *)p_q),
-                p_tcb,
-                p_void,
-                msg_size,
-                ts);
-        if ((opt & OS_OPT_POST_ALL) == 0u)  {                   /* Post message to all tasks waiting?                   */
-            break;                                              /* No                                                   */
-        }
-        p_tcb = p_tcb_next;
+    OS_TRACE_Q_POST_EXIT(*p_err);
+}
+
+
+/*
+************************************************************************************************************************
+*                                          POST SEVERAL MESSAGES TO A QUEUE
+*
+* Description: This function sends an array of messages to a queue, as 'qty' calls to OSQPost() would, but with a
+*              single call to the scheduler at the end.
+*
+* Arguments  : p_q           is a pointer to a message queue
+*
+*              p_data        is a pointer to an array of 'qty' records of 'msg_size' bytes each.  On a queue carrying
+*                            pointers, the address of each record is posted.
+*
+*              msg_size      specifies the size of each record (in bytes)
+*
+*              qty           is the number of records to post
+*
+*              opt           determines the type of POST performed, see OSQPost()
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              All the messages were sent
+*                                OS_ERR_Q_SIZE            If 'qty' is 0
+*                                Other                    See OSQPost(), the error of the first message not sent
+*
+* Returns    : The number of messages sent
+*
+* Note(s)    : 1) Interrupts are re-enabled between messages.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+OS_MSG_QTY  OSQPostN (OS_Q         *p_q,
+                      void         *p_data,
+                      OS_MSG_SIZE   msg_size,
+                      OS_MSG_QTY    qty,
+                      OS_OPT        opt,
+                      OS_ERR       *p_err)
+{
+    CPU_INT08U   *p_rec;
+    OS_MSG_QTY    nbr;
+    CPU_BOOLEAN   rdy;
+    CPU_TS        ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
     }
+#endif
 
-    CPU_CRITICAL_EXIT();
+    OS_TRACE_Q_POST_ENTER(p_q, p_data, msg_size, opt);
 
-    if ((opt & OS_OPT_POST_NO_SCHED) == 0u) {
-        OSSched();                                              /* Run the scheduler                                    */
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_q == (OS_Q *)0) {                                     /* Validate 'p_q'                                       */
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OBJ_PTR_NULL);
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    if (qty == 0u) {
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_Q_SIZE);
+       *p_err = OS_ERR_Q_SIZE;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_FIFO:
+        case OS_OPT_POST_LIFO:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_ALL:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_ALL:
+        case OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED:
+        case OS_OPT_POST_FIFO | (OS_OPT)(OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED):
+        case OS_OPT_POST_LIFO | (OS_OPT)(OS_OPT_POST_ALL | OS_OPT_POST_NO_SCHED):
+             break;
+
+        default:
+             OS_TRACE_Q_POST_FAILED(p_q);
+             OS_TRACE_Q_POST_EXIT(OS_ERR_OPT_INVALID);
+            *p_err =  OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_q->Type != OS_OBJ_TYPE_Q) {                           /* Make sure message queue was created                  */
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_OBJ_TYPE);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+    if ((OS_MSG_Q_IS_INLINE(&p_q->MsgQ)) &&                     /* Payload must fit in a slot                           */
+        (msg_size > p_q->MsgQ.PoolPtr->DataSize)) {
+        OS_TRACE_Q_POST_FAILED(p_q);
+        OS_TRACE_Q_POST_EXIT(OS_ERR_Q_MSG_SIZE);
+       *p_err = OS_ERR_Q_MSG_SIZE;
+        return (0u);
+    }
+
+    p_rec = (CPU_INT08U *)p_data;
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Called from an ISR?                                  */
+        for (nbr = 0u; nbr < qty; nbr++) {                      /* Yes, defer each post to the ISR handler task         */
+            OSQPost(p_q,
+                    (void *)p_rec,
+                    msg_size,
+                    opt,
+                    p_err);
+            if (*p_err != OS_ERR_NONE) {
+                break;
+            }
+            p_rec += msg_size;
+        }
+        OS_TRACE_Q_POST_EXIT(*p_err);
+        return (nbr);
     }
+#endif
 
+    rdy = DEF_NO;
    *p_err = OS_ERR_NONE;
+    for (nbr = 0u; nbr < qty; nbr++) {
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+        ts = OS_POST_TS_GET();                                  /* Get timestamp                                        */
+#else
+        ts = 0u;
+#endif
+        OS_TRACE_Q_POST(p_q);
+        CPU_CRITICAL_ENTER();
+        if (OS_QPost(p_q,
+                     (void *)p_rec,
+                     msg_size,
+                     opt | OS_OPT_POST_NO_SCHED,
+                     ts,
+                     p_err) == DEF_YES) {
+            rdy = DEF_YES;
+        }
+        CPU_CRITICAL_EXIT();
+        if (*p_err != OS_ERR_NONE) {
+            OS_TRACE_Q_POST_FAILED(p_q);
+            break;
+        }
+        p_rec += msg_size;
+    }
+
+    if ((rdy == DEF_YES) &&                                     /* Run the scheduler once for all the messages          */
+        ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+        OSSched();
+    }
+
     OS_TRACE_Q_POST_EXIT(*p_err);
+    return (nbr);
 }
+#endif
 
 
 /*
@@ -916,6 +1569,172 @@ void  OS_QClr (OS_Q  *p_q)
 }
 
 
+/*
+************************************************************************************************************************
+*                                          POST MESSAGE TO A QUEUE (INTERNAL)
+*
+* Description: This function places a message in a queue or hands it to the task(s) waiting on the queue.
+*
+* Arguments  : p_q           is a pointer to the message queue
+*
+*              p_void        is a pointer to the message to send
+*
+*              msg_size      specifies the size of the message (in bytes)
+*
+*              opt           determines the type of POST performed, see OSQPost()
+*
+*              ts            is the timestamp of the post
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE              The message was sent
+*                                OS_ERR_MSG_POOL_EMPTY    If there are no more OS_MSGs to use to place the message into
+*                                OS_ERR_Q_MAX             If the queue is full
+*
+* Returns    : DEF_YES           if one or more tasks were made ready to run
+*              DEF_NO            otherwise
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function MUST be called with interrupts disabled.
+*
+*              3) On a queue with inline payloads, the message is copied into the buffer each waiting task passed to
+*                 OSQPendCopy().
+************************************************************************************************************************
+*/
+
+CPU_BOOLEAN  OS_QPost (OS_Q         *p_q,
+                       void         *p_void,
+                       OS_MSG_SIZE   msg_size,
+                       OS_OPT        opt,
+                       CPU_TS        ts,
+                       OS_ERR       *p_err)
+{
+    OS_OPT         post_type;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    OS_TCB        *p_tcb_next;
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+    OS_MSG_SIZE    size;
+#endif
+
+
+    p_pend_list = &p_q->PendList;
+    if (OS_PEND_LIST_IS_EMPTY(p_pend_list)) {                   /* Any task waiting on message queue?                   */
+        if ((opt & OS_OPT_POST_LIFO) == 0u) {                   /* Determine whether we post FIFO or LIFO               */
+            post_type = OS_OPT_POST_FIFO;
+        } else {
+            post_type = OS_OPT_POST_LIFO;
+        }
+        OS_MsgQPut(&p_q->MsgQ,                                  /* Place message in the message queue                   */
+                   p_void,
+                   msg_size,
+                   post_type,
+                   ts,
+                   p_err);
+        return (DEF_NO);
+    }
+
+    p_tcb = p_pend_list->HeadPtr;
+#if (OS_CFG_PEND_MULTI_EN == DEF_ENABLED)
+    if (OS_PendMultiPostObj((OS_PEND_OBJ *)((void *)p_q),       /* Tasks in OSPendMulti() first if higher priority      */
+                            p_void,
+                            msg_size,
+                            ts,
+                            opt) == DEF_YES) {
+        p_tcb = (OS_TCB *)0;                                    /* Post consumed, no other task to make ready           */
+    }
+#endif
+    while (p_tcb != (OS_TCB *)0) {
+        p_tcb_next = p_tcb->PendNextPtr;
+#if (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+        if (OS_MSG_Q_IS_INLINE(&p_q->MsgQ)) {                   /* See Note #3                                          */
+            size = msg_size;
+            if (size > p_tcb->MsgSize) {
+                size = p_tcb->MsgSize;
+            }
+            OS_MsgCopy(p_tcb->MsgPtr,
+                       p_void,
+                       size);
+            OS_Post((OS_PEND_OBJ *)((void *)p_q),
+                    p_tcb,
+                    p_tcb->MsgPtr,
+                    size,
+                    ts);
+        } else
+#endif
+        {
+            OS_Post((OS_PEND_OBJ *)((void *)p_q),
+                    p_tcb,
+                    p_void,
+                    msg_size,
+                    ts);
+        }
+        if ((opt & OS_OPT_POST_ALL) == 0u)  {                   /* Post message to all tasks waiting?                   */
+            break;                                              /* No                                                   */
+        }
+        p_tcb = p_tcb_next;
+    }
+
+   *p_err = OS_ERR_NONE;
+    return (DEF_YES);
+}
+
+
+/*
+************************************************************************************************************************
+*                                    HAND QUEUED INLINE MESSAGES OVER TO WAITING TASKS
+*
+* Description: This function is called by the ISR handler task to complete a post that an ISR made to a queue with
+*              inline payloads.  The ISR already copied the payload in a slot of the queue (see 'OSQPost()  Note #1'),
+*              this function gives the queued messages to the tasks waiting on the queue.
+*
+* Arguments  : p_q       is a pointer to the message queue
+*
+*              opt       is the option of the post made by the ISR (OS_OPT_POST_ALL is honored)
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) The loop stops when no task is waiting anymore or when the queue is empty, e.g. if a waiting task
+*                 timed out or if the messages were read by OSQPendCopy() in the meantime.  Messages left over by
+*                 a previous hand-over that could not be deferred are given away too.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED) && (OS_CFG_Q_SLOT_EN == DEF_ENABLED)
+void  OS_QPostDeferred (OS_Q    *p_q,
+                        OS_OPT   opt)
+{
+    void         *p_void;
+    OS_MSG_SIZE   msg_size;
+    CPU_TS        ts;
+    OS_ERR        err;
+    CPU_SR_ALLOC();
+
+
+    OS_TRACE_Q_POST(p_q);
+
+    CPU_CRITICAL_ENTER();
+    while ((!OS_PEND_LIST_IS_EMPTY(&p_q->PendList)) &&          /* See Note #2                                          */
+           (p_q->MsgQ.NbrEntries > 0u)) {
+        p_void = OS_MsgQGet(&p_q->MsgQ,                         /* Payload stays valid until interrupts are enabled     */
+                           &msg_size,
+                           &ts,
+                           &err);
+        (void)OS_QPost(p_q,                                     /* Copy the payload to the waiting task(s)              */
+                       p_void,
+                       msg_size,
+                       opt,
+                       ts,
+                       &err);
+    }
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                      ADD/REMOVE MESSAGE QUEUE TO/FROM DEBUG LIST
@@ -236,7 +236,7 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,
     nbr_tasks   = 0u;
     switch (opt) {
         case OS_OPT_DEL_NO_PEND:                                /* Delete semaphore only if no task waiting             */
-             if (p_pend_list->HeadPtr == (OS_TCB *)0) {
+             if (OS_PEND_LIST_IS_EMPTY(p_pend_list)) {
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
                  OS_SemDbgListRemove(p_sem);
                  OSSemQty--;
@@ -264,6 +264,13 @@ OS_OBJ_QTY  OSSemDel (OS_SEM  *p_sem,
                               OS_STATUS_PEND_DEL);
                  nbr_tasks++;
              }
+#if (OS_CFG_PEND_MULTI_EN == DEF_ENABLED)
+                                                                /* ... and all the tasks waiting in OSPendMulti()       */
+             nbr_tasks += OS_PendMultiAbortObj((OS_PEND_OBJ *)((void *)p_sem),
+                                               ts,
+                                               OS_STATUS_PEND_DEL,
+                                               DEF_YES);
+#endif
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
              OS_SemDbgListRemove(p_sem);
              OSSemQty--;
@@ -449,6 +456,9 @@ OS_SEM_CTR  OSSemPend (OS_SEM   *p_sem,
         }
     }
 
+#if (OS_CFG_SEM_BATCH_EN == DEF_ENABLED)
+    OSTCBCurPtr->SemPendCnt = 1u;                               /* A single count for OSSemPostN()                      */
+#endif
     OS_Pend((OS_PEND_OBJ *)((void *)p_sem),                     /* Block task pending on Semaphore                      */
             OS_TASK_PEND_ON_SEM,
             timeout);
@@ -606,7 +616,7 @@ OS_OBJ_QTY  OSSemPendAbort (OS_SEM  *p_sem,
 
     CPU_CRITICAL_ENTER();
     p_pend_list = &p_sem->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on semaphore?                       */
+    if (OS_PEND_LIST_IS_EMPTY(p_pend_list)) {                   /* Any task waiting on semaphore?                       */
         CPU_CRITICAL_EXIT();                                    /* No                                                   */
        *p_err =  OS_ERR_PEND_ABORT_NONE;
         return (0u);
@@ -618,7 +628,15 @@ OS_OBJ_QTY  OSSemPendAbort (OS_SEM  *p_sem,
 #else
     ts        = 0u;
 #endif
-    while (p_pend_list->HeadPtr != (OS_TCB *)0) {
+#if (OS_CFG_PEND_MULTI_EN == DEF_ENABLED)
+                                                                /* Tasks in OSPendMulti() first if higher priority      */
+    nbr_tasks = OS_PendMultiAbortObj((OS_PEND_OBJ *)((void *)p_sem),
+                                     ts,
+                                     OS_STATUS_PEND_ABORT,
+                                     (opt == OS_OPT_PEND_ABORT_ALL) ? DEF_YES : DEF_NO);
+#endif
+    while ((p_pend_list->HeadPtr != (OS_TCB *)0) &&
+           ((nbr_tasks == 0u) || (opt == OS_OPT_PEND_ABORT_ALL))) {
         p_tcb = p_pend_list->HeadPtr;
         OS_PendAbort(p_tcb,
                      ts,
@@ -640,6 +658,254 @@ OS_OBJ_QTY  OSSemPendAbort (OS_SEM  *p_sem,
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                        PEND ON SEMAPHORE FOR SEVERAL COUNTS
+*
+* Description: This function waits for a semaphore and takes as many of its counts as are available, up to 'max', in
+*              a single call.
+*
+* Arguments  : p_sem         is a pointer to the semaphore
+*
+*              max           is the largest number of counts to take (must be non-zero)
+*
+*              p_got         is a pointer to a variable that will receive the number of counts taken (0 upon error)
+*
+*              timeout       is an optional timeout period (in clock ticks), as for OSSemPend()
+*
+*              opt           determines whether the user wants to block if the semaphore is available or not:
+*
+*                                OS_OPT_PEND_BLOCKING
+*                                OS_OPT_PEND_NON_BLOCKING
+*
+*              p_ts          is a pointer to a variable that will receive the timestamp of when the semaphore was posted
+*                            or pend aborted or the semaphore deleted.  A NULL pointer is valid.
+*
+*              p_err         is a pointer to a variable that will contain an error code returned by this function.
+*
+*                                OS_ERR_NONE               At least one count was taken
+*                                OS_ERR_OBJ_DEL            If 'p_sem' was deleted
+*                                OS_ERR_OBJ_PTR_NULL       If 'p_sem' is a NULL pointer
+*                                OS_ERR_OBJ_TYPE           If 'p_sem' is not pointing at a semaphore
+*                                OS_ERR_OPT_INVALID        If you specified an invalid value for 'opt'
+*                                OS_ERR_OS_NOT_RUNNING     If uC/OS-III is not running yet
+*                                OS_ERR_PEND_ABORT         If the pend was aborted by another task
+*                                OS_ERR_PEND_ISR           If you called this function from an ISR
+*                                OS_ERR_PEND_WOULD_BLOCK   If you specified non-blocking but the semaphore was not
+*                                                          available
+*                                OS_ERR_PTR_INVALID        If 'p_got' is a NULL pointer
+*                                OS_ERR_SCHED_LOCKED       If you called this function when the scheduler is locked
+*                                OS_ERR_SEM_CNT_INVALID    If 'max' is 0
+*                                OS_ERR_STATUS_INVALID     Pend status is invalid
+*                                OS_ERR_TIMEOUT            The semaphore was not received within the specified
+*                                                          timeout
+*
+* Returns    : The current value of the semaphore counter or 0 if not available.
+*
+* Note(s)    : 1) A task blocked in this function is readied by the first post.  OSSemPost() gives it one count,
+*                 OSSemPostN() up to 'max' counts.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SEM_BATCH_EN == DEF_ENABLED)
+OS_SEM_CTR  OSSemPendUpTo (OS_SEM      *p_sem,
+                           OS_SEM_CTR   max,
+                           OS_SEM_CTR  *p_got,
+                           OS_TICK      timeout,
+                           OS_OPT       opt,
+                           CPU_TS      *p_ts,
+                           OS_ERR      *p_err)
+{
+    OS_SEM_CTR  ctr;
+    OS_SEM_CTR  got;
+    CPU_SR_ALLOC();
+
+
+#if (OS_CFG_TS_EN == DEF_DISABLED)
+    (void)p_ts;                                                 /* Prevent compiler warning for not using 'ts'          */
+#endif
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+    OS_TRACE_SEM_PEND_ENTER(p_sem, timeout, opt, p_ts);
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+        OS_TRACE_SEM_PEND_FAILED(p_sem);
+        OS_TRACE_SEM_PEND_EXIT(OS_ERR_PEND_ISR);
+       *p_err = OS_ERR_PEND_ISR;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+        OS_TRACE_SEM_PEND_EXIT(OS_ERR_OS_NOT_RUNNING);
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_sem == (OS_SEM *)0) {                                 /* Validate 'p_sem'                                     */
+        OS_TRACE_SEM_PEND_EXIT(OS_ERR_OBJ_PTR_NULL);
+       *p_err = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    if (p_got == (OS_SEM_CTR *)0) {                             /* Validate 'p_got'                                     */
+        OS_TRACE_SEM_PEND_EXIT(OS_ERR_PTR_INVALID);
+       *p_err = OS_ERR_PTR_INVALID;
+        return (0u);
+    }
+    if (max == 0u) {                                            /* Validate 'max'                                       */
+        OS_TRACE_SEM_PEND_EXIT(OS_ERR_SEM_CNT_INVALID);
+       *p_got = 0u;
+       *p_err = OS_ERR_SEM_CNT_INVALID;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_PEND_BLOCKING:
+        case OS_OPT_PEND_NON_BLOCKING:
+             break;
+
+        default:
+             OS_TRACE_SEM_PEND_FAILED(p_sem);
+             OS_TRACE_SEM_PEND_EXIT(OS_ERR_OPT_INVALID);
+            *p_got = 0u;
+            *p_err = OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_sem->Type != OS_OBJ_TYPE_SEM) {                       /* Make sure semaphore was created                      */
+        OS_TRACE_SEM_PEND_FAILED(p_sem);
+        OS_TRACE_SEM_PEND_EXIT(OS_ERR_OBJ_TYPE);
+       *p_got = 0u;
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+
+   *p_got = 0u;
+    CPU_CRITICAL_ENTER();
+    if (p_sem->Ctr > 0u) {                                      /* Resource available?                                  */
+        got = p_sem->Ctr;                                       /* Yes, take as many counts as allowed                  */
+        if (got > max) {
+            got = max;
+        }
+        p_sem->Ctr -= got;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts = p_sem->TS;                                   /* get timestamp of last post                           */
+        }
+#endif
+        ctr    = p_sem->Ctr;
+        OS_TRACE_SEM_PEND(p_sem);
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_SEM_PEND_EXIT(OS_ERR_NONE);
+       *p_got  = got;
+       *p_err  = OS_ERR_NONE;
+        return (ctr);
+    }
+
+    if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {               /* Caller wants to block if not available?              */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+        if (p_ts != (CPU_TS *)0) {
+           *p_ts = 0u;
+        }
+#endif
+        CPU_CRITICAL_EXIT();                                    /* No                                                   */
+        OS_TRACE_SEM_PEND_FAILED(p_sem);
+        OS_TRACE_SEM_PEND_EXIT(OS_ERR_PEND_WOULD_BLOCK);
+       *p_err = OS_ERR_PEND_WOULD_BLOCK;
+        return (0u);
+    } else {                                                    /* Yes                                                  */
+        if (OSSchedLockNestingCtr > 0u) {                       /* Can't pend when the scheduler is locked              */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+            if (p_ts != (CPU_TS *)0) {
+               *p_ts = 0u;
+            }
+#endif
+            CPU_CRITICAL_EXIT();
+            OS_TRACE_SEM_PEND_FAILED(p_sem);
+            OS_TRACE_SEM_PEND_EXIT(OS_ERR_SCHED_LOCKED);
+           *p_err = OS_ERR_SCHED_LOCKED;
+            return (0u);
+        }
+    }
+
+    OSTCBCurPtr->SemPendCnt = max;                              /* Counts wanted, replaced by the counts given          */
+    OS_Pend((OS_PEND_OBJ *)((void *)p_sem),                     /* Block task pending on Semaphore                      */
+            OS_TASK_PEND_ON_SEM,
+            timeout);
+    CPU_CRITICAL_EXIT();
+    OS_TRACE_SEM_PEND_BLOCK(p_sem);
+    OSSched();                                                  /* Find the next highest priority task ready to run     */
+
+    CPU_CRITICAL_ENTER();
+    switch (OSTCBCurPtr->PendStatus) {
+        case OS_STATUS_PEND_OK:                                 /* We got the semaphore                                 */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_SEM_PEND(p_sem);
+            *p_got = OSTCBCurPtr->SemPendCnt;
+            *p_err = OS_ERR_NONE;
+             break;
+
+        case OS_STATUS_PEND_ABORT:                              /* Indicate that we aborted                             */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_SEM_PEND_FAILED(p_sem);
+            *p_err = OS_ERR_PEND_ABORT;
+             break;
+
+        case OS_STATUS_PEND_TIMEOUT:                            /* Indicate that we didn't get semaphore within timeout */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = 0u;
+             }
+#endif
+             OS_TRACE_SEM_PEND_FAILED(p_sem);
+            *p_err = OS_ERR_TIMEOUT;
+             break;
+
+        case OS_STATUS_PEND_DEL:                                /* Indicate that object pended on has been deleted      */
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+             if (p_ts != (CPU_TS *)0) {
+                *p_ts = OSTCBCurPtr->TS;
+             }
+#endif
+             OS_TRACE_SEM_PEND_FAILED(p_sem);
+            *p_err = OS_ERR_OBJ_DEL;
+             break;
+
+        default:
+             OS_TRACE_SEM_PEND_FAILED(p_sem);
+            *p_err = OS_ERR_STATUS_INVALID;
+             CPU_CRITICAL_EXIT();
+             OS_TRACE_SEM_PEND_EXIT(*p_err);
+             return (0u);
+    }
+    ctr = p_sem->Ctr;
+    CPU_CRITICAL_EXIT();
+    OS_TRACE_SEM_PEND_EXIT(*p_err);
+    return (ctr);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                 POST TO A SEMAPHORE
@@ -733,15 +999,30 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
     }
 #endif
 #if (OS_CFG_TS_EN == DEF_ENABLED)
-    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+    ts = OS_POST_TS_GET();                                      /* Get timestamp                                        */
 #else
     ts = 0u;
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Called from an ISR?                                  */
+        OS_IntQPost(OS_OBJ_TYPE_SEM,                            /* Yes, defer the post to the ISR handler task        */
+                    (void *)p_sem,
+                    (void *)0,
+                    0u,
+                    0u,
+                    opt,
+                    ts,
+                    p_err);
+        OS_TRACE_SEM_POST_EXIT(*p_err);
+        return (0u);
+    }
+#endif
+
     OS_TRACE_SEM_POST(p_sem);
     CPU_CRITICAL_ENTER();
     p_pend_list = &p_sem->PendList;
-    if (p_pend_list->HeadPtr == (OS_TCB *)0) {                  /* Any task waiting on semaphore?                       */
+    if (OS_PEND_LIST_IS_EMPTY(p_pend_list)) {                   /* Any task waiting on semaphore?                       */
         if (p_sem->Ctr == (OS_SEM_CTR)-1) {
            CPU_CRITICAL_EXIT();
           *p_err = OS_ERR_SEM_OVF;
@@ -760,8 +1041,20 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
     }
 
     p_tcb = p_pend_list->HeadPtr;
+#if (OS_CFG_PEND_MULTI_EN == DEF_ENABLED)
+    if (OS_PendMultiPostObj((OS_PEND_OBJ *)((void *)p_sem),     /* Tasks in OSPendMulti() first if higher priority      */
+                            (void *)0,
+                            0u,
+                            ts,
+                            opt) == DEF_YES) {
+        p_tcb = (OS_TCB *)0;                                    /* Post consumed, no other task to make ready           */
+    }
+#endif
     while (p_tcb != (OS_TCB *)0) {
         p_tcb_next = p_tcb->PendNextPtr;
+#if (OS_CFG_SEM_BATCH_EN == DEF_ENABLED)
+        p_tcb->SemPendCnt = 1u;                                 /* Each task waiting gets a single count                */
+#endif
         OS_Post((OS_PEND_OBJ *)((void *)p_sem),
                 p_tcb,
                 (void *)0,
@@ -783,6 +1076,196 @@ OS_SEM_CTR  OSSemPost (OS_SEM  *p_sem,
 }
 
 
+/*
+************************************************************************************************************************
+*                                          POST SEVERAL COUNTS TO A SEMAPHORE
+*
+* Description: This function signals a semaphore 'cnt' times in a single call, e.g. once per byte received by an ISR.
+*
+* Arguments  : p_sem    is a pointer to the semaphore
+*
+*              cnt      is the number of counts to post (must be non-zero)
+*
+*              opt      determines the type of POST performed:
+*
+*                           OS_OPT_POST_1            POST the counts to the tasks waiting, highest priority first
+*                           OS_OPT_POST_NO_SCHED     Do not call the scheduler
+*
+*                           Note(s): 1) OS_OPT_POST_NO_SCHED can be added with OS_OPT_POST_1.
+*
+*              p_err    is a pointer to a variable that will contain an error code returned by this function.
+*
+*                           OS_ERR_NONE              The call was successful and the semaphore was signaled
+*                           OS_ERR_OBJ_PTR_NULL      If 'p_sem' is a NULL pointer
+*                           OS_ERR_OBJ_TYPE          If 'p_sem' is not pointing at a semaphore
+*                           OS_ERR_OPT_INVALID       If you specified an invalid option
+*                           OS_ERR_OS_NOT_RUNNING    If uC/OS-III is not running yet
+*                           OS_ERR_SEM_CNT_INVALID   If 'cnt' is 0
+*                           OS_ERR_SEM_OVF           If the post would cause the semaphore count to overflow, no
+*                                                    count is posted and no task is made ready
+*
+* Returns    : The current value of the semaphore counter or 0 upon error.
+*
+* Note(s)    : 1) The counts are handed to the tasks waiting, in priority order: a task in OSSemPend() or OSPendMulti()
+*                 takes one count, a task in OSSemPendUpTo() takes up to its 'max'.  What is left is added to the
+*                 semaphore counter.
+*
+*              2) The scheduler is called once, whatever the number of tasks made ready.
+*
+*              3) The overflow is checked before any task is made ready, so that the post is all or nothing.  Tasks
+*                 only wait on a semaphore whose counter is 0, thus the counts overflow the counter if and only if
+*                 'cnt' does not fit in what is left above the current counter.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_SEM_BATCH_EN == DEF_ENABLED)
+OS_SEM_CTR  OSSemPostN (OS_SEM      *p_sem,
+                        OS_SEM_CTR   cnt,
+                        OS_OPT       opt,
+                        OS_ERR      *p_err)
+{
+    OS_SEM_CTR     ctr;
+    OS_SEM_CTR     take;
+    OS_PEND_LIST  *p_pend_list;
+    OS_TCB        *p_tcb;
+    CPU_BOOLEAN    rdy;
+    CPU_TS         ts;
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return (0u);
+    }
+#endif
+
+    OS_TRACE_SEM_POST_ENTER(p_sem, opt);
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+        OS_TRACE_SEM_POST_EXIT(OS_ERR_OS_NOT_RUNNING);
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return (0u);
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_sem == (OS_SEM *)0) {                                 /* Validate 'p_sem'                                     */
+        OS_TRACE_SEM_POST_FAILED(p_sem);
+        OS_TRACE_SEM_POST_EXIT(OS_ERR_OBJ_PTR_NULL);
+       *p_err  = OS_ERR_OBJ_PTR_NULL;
+        return (0u);
+    }
+    if (cnt == 0u) {                                            /* Validate 'cnt'                                       */
+        OS_TRACE_SEM_POST_FAILED(p_sem);
+        OS_TRACE_SEM_POST_EXIT(OS_ERR_SEM_CNT_INVALID);
+       *p_err  = OS_ERR_SEM_CNT_INVALID;
+        return (0u);
+    }
+    switch (opt) {                                              /* Validate 'opt'                                       */
+        case OS_OPT_POST_1:
+        case OS_OPT_POST_1 | OS_OPT_POST_NO_SCHED:
+             break;
+
+        default:
+             OS_TRACE_SEM_POST_FAILED(p_sem);
+             OS_TRACE_SEM_POST_EXIT(OS_ERR_OPT_INVALID);
+            *p_err =  OS_ERR_OPT_INVALID;
+             return (0u);
+    }
+#endif
+
+#if (OS_CFG_OBJ_TYPE_CHK_EN == DEF_ENABLED)
+    if (p_sem->Type != OS_OBJ_TYPE_SEM) {                       /* Make sure semaphore was created                      */
+        OS_TRACE_SEM_POST_FAILED(p_sem);
+        OS_TRACE_SEM_POST_EXIT(OS_ERR_OBJ_TYPE);
+       *p_err = OS_ERR_OBJ_TYPE;
+        return (0u);
+    }
+#endif
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    ts = OS_POST_TS_GET();                                      /* Get timestamp                                        */
+#else
+    ts = 0u;
+#endif
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Called from an ISR?                                  */
+        OS_IntQPost(OS_OBJ_TYPE_SEM,                            /* Yes, defer the post to the ISR handler task          */
+                    (void *)p_sem,
+                    (void *)(CPU_ADDR)cnt,                      /* The count travels in the message pointer             */
+                    0u,
+                    0u,
+                    opt,
+                    ts,
+                    p_err);
+        OS_TRACE_SEM_POST_EXIT(*p_err);
+        return (0u);
+    }
+#endif
+
+    OS_TRACE_SEM_POST(p_sem);
+    rdy         = DEF_NO;
+    p_pend_list = &p_sem->PendList;
+    CPU_CRITICAL_ENTER();
+    if (cnt > ((OS_SEM_CTR)-1 - p_sem->Ctr)) {                  /* Reject before readying any task (See Note #3)        */
+        CPU_CRITICAL_EXIT();
+        OS_TRACE_SEM_POST_FAILED(p_sem);
+        OS_TRACE_SEM_POST_EXIT(OS_ERR_SEM_OVF);
+       *p_err = OS_ERR_SEM_OVF;
+        return (0u);
+    }
+    while (cnt > 0u) {                                          /* Hand the counts to the tasks waiting (See Note #1)   */
+#if (OS_CFG_PEND_MULTI_EN == DEF_ENABLED)
+        if (OS_PendMultiPostObj((OS_PEND_OBJ *)((void *)p_sem), /* Tasks in OSPendMulti() first if higher priority      */
+                                (void *)0,
+                                0u,
+                                ts,
+                                OS_OPT_POST_1) == DEF_YES) {
+            cnt--;
+            rdy = DEF_YES;
+            continue;
+        }
+#endif
+        p_tcb = p_pend_list->HeadPtr;
+        if (p_tcb == (OS_TCB *)0) {                             /* No more tasks waiting                                */
+            break;
+        }
+        take = p_tcb->SemPendCnt;
+        if (take > cnt) {
+            take = cnt;
+        }
+        p_tcb->SemPendCnt = take;
+        OS_Post((OS_PEND_OBJ *)((void *)p_sem),
+                p_tcb,
+                (void *)0,
+                0u,
+                ts);
+        cnt -= take;
+        rdy  = DEF_YES;
+    }
+
+    p_sem->Ctr += cnt;                                          /* Keep the counts left                                 */
+    ctr         = p_sem->Ctr;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    if (cnt > 0u) {
+        p_sem->TS = ts;                                         /* Save timestamp in semaphore control block            */
+    }
+#endif
+    CPU_CRITICAL_EXIT();
+
+    if ((rdy == DEF_YES) &&                                     /* Run the scheduler once (See Note #2)                 */
+        ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+        OSSched();
+    }
+   *p_err = OS_ERR_NONE;
+    OS_TRACE_SEM_POST_EXIT(*p_err);
+    return (ctr);
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                    SET SEMAPHORE
@@ -854,7 +1337,7 @@ void  OSSemSet (OS_SEM      *p_sem,
         p_sem->Ctr = cnt;                                       /* Yes, set it to the new value specified.              */
     } else {
         p_pend_list = &p_sem->PendList;                         /* No                                                   */
-        if (p_pend_list->HeadPtr == (OS_TCB *)0) {              /* See if task(s) waiting?                              */
+        if (OS_PEND_LIST_IS_EMPTY(p_pend_list)) {               /* See if task(s) waiting?                              */
             p_sem->Ctr = cnt;                                   /* No, OK to set the value                              */
         } else {
            *p_err      = OS_ERR_TASK_WAITING;
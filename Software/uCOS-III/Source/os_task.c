@@ -40,6 +40,167 @@
 const  CPU_CHAR  *os_task__c = "$Id: $";
 #endif
 
+/*
+************************************************************************************************************************
+*                                              SET A TASK'S CPU BUDGET
+*
+* Description: This function limits the CPU time a task can use.  The task is charged one budget tick for every tick
+*              interrupt that finds it running.  When its budget is exhausted, the task is demoted to a background
+*              priority or suspended until the budget is replenished.
+*
+*              The budget is replenished following the sporadic server rule: 'period' ticks after the task first
+*              used it since the last replenishment.
+*
+* Arguments  : p_tcb       is a pointer to the task's OS_TCB.  Specifying a NULL pointer indicates that you wish to
+*                          set the budget of the calling task.
+*
+*              budget      is the CPU budget, in ticks, per replenishment period.  Specifying 0 removes the budget.
+*
+*              period      is the replenishment period, in ticks.
+*
+*              prio        is the priority of the task while its budget is exhausted (OS_OPT_TASK_BUDGET_DEMOTE only).
+*                          It can NOT be in the EDF band (see Note #4).
+*
+*              opt         determines what happens when the budget is exhausted:
+*
+*                              OS_OPT_TASK_BUDGET_DEMOTE     the task runs at 'prio' until it is replenished
+*                              OS_OPT_TASK_BUDGET_SUSPEND    the task is suspended until it is replenished
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                   The call was successful
+*                              OS_ERR_OPT_INVALID            If you specified an invalid option
+*                              OS_ERR_PRIO_INVALID           If 'prio' is invalid or in the EDF band
+*                              OS_ERR_SET_ISR                If you called this function from an ISR
+*                              OS_ERR_TASK_BUDGET_INVALID    If 'budget' is larger than 'period'
+*                              OS_ERR_TASK_INVALID           If you specified the idle task or the ISR handler task
+*
+* Returns    : none
+*
+* Note(s)    : 1) The budget is enforced at tick granularity in OSTimeTick().  A task that exhausts its budget while
+*                 the scheduler is locked is suspended once it unlocks the scheduler.
+*
+*              2) .BudgetOverrunCtr counts the number of times the budget was exhausted and .BudgetOverrunTicks the
+*                 ticks the task was charged while its budget was exhausted.
+*
+*              3) A task is never demoted below the priority it inherited from, or the ceiling of, the mutexes it owns:
+*                 the demotion would otherwise let medium priority tasks delay the tasks waiting on these mutexes
+*                 (priority inversion).  A demoted task still inherits the priority of the tasks that pend on its
+*                 mutexes later on.
+*
+*              4) OS_CFG_SCHED_EDF_TASK_MAX only accounts for the tasks created in (or moved to) the EDF band, so a
+*                 task demoted into the band could overflow the EDF heap.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+void  OSTaskBudgetSet (OS_TCB   *p_tcb,
+                       OS_TICK   budget,
+                       OS_TICK   period,
+                       OS_PRIO   prio,
+                       OS_OPT    opt,
+                       OS_ERR   *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    switch (opt) {
+        case OS_OPT_TASK_BUDGET_DEMOTE:
+             if (prio >= (OS_CFG_PRIO_MAX - 1u)) {              /* Cannot demote to the idle task priority              */
+                *p_err = OS_ERR_PRIO_INVALID;
+                 return;
+             }
+             break;
+
+#if (OS_CFG_TASK_SUSPEND_EN == DEF_ENABLED)
+        case OS_OPT_TASK_BUDGET_SUSPEND:
+             break;
+#endif
+
+        default:
+            *p_err = OS_ERR_OPT_INVALID;
+             return;
+    }
+
+    if (budget > period) {
+       *p_err = OS_ERR_TASK_BUDGET_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    if ((opt == OS_OPT_TASK_BUDGET_DEMOTE) &&                   /* Cannot demote into the EDF band, see Note #4         */
+        (OS_EDF_PRIO_IN_BAND(prio))) {
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_TASK_IDLE_EN == DEF_ENABLED)
+    if (p_tcb == &OSIdleTaskTCB) {
+       *p_err = OS_ERR_TASK_INVALID;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (p_tcb == &OSIntQTaskTCB) {
+       *p_err = OS_ERR_TASK_INVALID;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {
+        p_tcb = OSTCBCurPtr;
+    }
+
+    if (p_tcb->BudgetThrottled == DEF_TRUE) {                   /* Undo the enforcement of the previous budget          */
+        OS_TaskBudgetRelease(p_tcb);
+    }
+    if (p_tcb->BudgetTicks > 0u) {
+        OS_TaskBudgetListRemove(p_tcb);
+    }
+
+    p_tcb->BudgetTicks        = budget;
+    p_tcb->BudgetPeriod       = period;
+    p_tcb->BudgetRemain       = budget;
+    p_tcb->BudgetReplenishCtr = 0u;
+    p_tcb->BudgetPrio         = prio;
+    p_tcb->BudgetOpt          = opt;
+    p_tcb->BudgetOverrunCtr   = 0u;
+    p_tcb->BudgetOverrunTicks = 0u;
+
+    if (budget > 0u) {
+        p_tcb->BudgetNextPtr = OSTaskBudgetListPtr;             /* Add to the list of tasks with a budget               */
+        OSTaskBudgetListPtr  = p_tcb;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (OSRunning == OS_STATE_OS_RUNNING) {
+        OSSched();                                              /* The task may have been resumed or promoted           */
+    }
+
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                CHANGE PRIORITY OF A TASK
@@ -74,6 +235,9 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
 {
 #if (OS_CFG_MUTEX_EN == DEF_ENABLED)
     OS_PRIO  prio_high;
+#endif
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    OS_PRIO  prio_old;
 #endif
     CPU_SR_ALLOC();
 
@@ -104,6 +268,14 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
         return;
     }
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if ((prio_new == 0u) ||                                     /* Priority 0 is reserved for the ISR handler task      */
+        (p_tcb    == &OSIntQTaskTCB)) {
+       *p_err = OS_ERR_PRIO_INVALID;
+        return;
+    }
+#endif
+
     CPU_CRITICAL_ENTER();
 
     if (p_tcb == (OS_TCB *)0) {                                 /* Are we changing the priority of 'self'?              */
@@ -115,6 +287,26 @@ void  OSTaskChangePrio (OS_TCB   *p_tcb,
         p_tcb = OSTCBCurPtr;
     }
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+    prio_old = p_tcb->BasePrio;
+#else
+    prio_old = p_tcb->Prio;
+#endif
+    if (OS_EDF_PRIO_IN_BAND(prio_new) != OS_EDF_PRIO_IN_BAND(prio_old)) {
+        if (OS_EDF_PRIO_IN_BAND(prio_new)) {                    /* Entering the EDF band: reserve a place in the heap   */
+            if (OSEdfTaskQty >= OS_CFG_SCHED_EDF_TASK_MAX) {
+                CPU_CRITICAL_EXIT();
+               *p_err = OS_ERR_TASK_EDF_FULL;
+                return;
+            }
+            OSEdfTaskQty++;
+        } else {
+            OSEdfTaskQty--;
+        }
+    }
+#endif
+
 #if (OS_CFG_MUTEX_EN == DEF_ENABLED)
     p_tcb->BasePrio = prio_new;                                 /* Update base priority                                 */
 
@@ -327,6 +519,16 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 #endif
     }
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (prio == 0u) {
+        if (p_tcb != &OSIntQTaskTCB) {
+            OS_TRACE_TASK_CREATE_FAILED(p_tcb);
+           *p_err = OS_ERR_PRIO_INVALID;                        /* Priority 0 is reserved for the ISR handler task      */
+            return;
+        }
+    }
+#endif
+
     OS_TaskInitTCB(p_tcb);                                      /* Initialize the TCB to default values                 */
 
    *p_err = OS_ERR_NONE;
@@ -367,6 +569,20 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
     }
 #endif
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    if (OS_EDF_PRIO_IN_BAND(prio)) {                            /* Reserve a place in the EDF heap                      */
+        CPU_CRITICAL_ENTER();
+        if (OSEdfTaskQty >= OS_CFG_SCHED_EDF_TASK_MAX) {
+            CPU_CRITICAL_EXIT();
+            OS_TRACE_TASK_CREATE_FAILED(p_tcb);
+           *p_err = OS_ERR_TASK_EDF_FULL;
+            return;
+        }
+        OSEdfTaskQty++;
+        CPU_CRITICAL_EXIT();
+    }
+#endif
+
 #if (OS_CFG_TASK_STK_REDZONE_EN == DEF_ENABLED)                 /* Initialize Redzoned stack                            */
     OS_TaskStkRedzoneInit(p_stk_base, stk_size);
 #endif
@@ -441,6 +657,9 @@ void  OSTaskCreate (OS_TCB        *p_tcb,
 #endif
                                                                 /* -------------- ADD TASK TO READY LIST -------------- */
     CPU_CRITICAL_ENTER();
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    p_tcb->EdfDeadline = OSTickCtr;                             /* Until a deadline is set, see OSEdfDeadlineSet()      */
+#endif
     OS_PrioInsert(p_tcb->Prio);
     OS_RdyListInsertTail(p_tcb);
 
@@ -536,6 +755,13 @@ void  OSTaskDel (OS_TCB  *p_tcb,
     }
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (p_tcb == &OSIntQTaskTCB) {                              /* Not allowed to delete the ISR handler task           */
+       *p_err = OS_ERR_TASK_DEL_INVALID;
+        return;
+    }
+#endif
+
     if (p_tcb == (OS_TCB *)0) {                                 /* Delete 'Self'?                                       */
         CPU_CRITICAL_ENTER();
         p_tcb  = OSTCBCurPtr;                                   /* Yes.                                                 */
@@ -569,6 +795,7 @@ void  OSTaskDel (OS_TCB  *p_tcb,
                       break;
 
                  case OS_TASK_PEND_ON_FLAG:                     /* Remove from pend list                                */
+                 case OS_TASK_PEND_ON_MULTI:
                  case OS_TASK_PEND_ON_Q:
                  case OS_TASK_PEND_ON_SEM:
                       OS_PendListRemove(p_tcb);
@@ -633,6 +860,22 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 
     OSTaskQty--;                                                /* One less task being managed                          */
 
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+    if (p_tcb->BudgetTicks > 0u) {                              /* Stop charging and replenishing the task's budget     */
+        OS_TaskBudgetListRemove(p_tcb);
+    }
+#endif
+
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+    if (OS_EDF_PRIO_IN_BAND(p_tcb->BasePrio)) {                 /* Free the task's place in the EDF heap                */
+#else
+    if (OS_EDF_PRIO_IN_BAND(p_tcb->Prio)) {
+#endif
+        OSEdfTaskQty--;
+    }
+#endif
+
     OS_TRACE_TASK_DEL(p_tcb);
 
 #if (OS_CFG_TASK_STK_REDZONE_EN != DEF_ENABLED)                 /* Don't clear the TCB before checking the red-zone     */
@@ -648,6 +891,260 @@ void  OSTaskDel (OS_TCB  *p_tcb,
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                                 MAKE A TASK PERIODIC
+*
+* Description: This function makes a task periodic.  Once set, the task calls OSTaskPeriodWait() at the end of each
+*              job and is released again on absolute tick boundaries (release 'n' occurs at the tick the period was
+*              set plus 'phase' plus 'n' times 'period') so that the execution time of the task does not stretch the
+*              period.
+*
+* Arguments  : p_tcb       is a pointer to the task's OS_TCB.  Specifying a NULL pointer indicates that you wish to
+*                          make the calling task periodic.
+*
+*              period      is the release period, in ticks.  Specifying 0 makes the task non-periodic.
+*
+*              phase       is the number of ticks from now to the first release.
+*
+*              deadline    is the relative deadline of each job, in ticks.  A job that has not called
+*                          OSTaskPeriodWait() 'deadline' ticks after its release is counted as an overrun.  Specifying
+*                          0 sets the deadline to the period.
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                   The call was successful
+*                              OS_ERR_SET_ISR                If you called this function from an ISR
+*                              OS_ERR_TASK_PERIOD_INVALID    If 'deadline' is larger than 'period'
+*
+* Returns    : none
+*
+* Note(s)    : 1) The overrun, skip and jitter statistics of the task are reset.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_PERIOD_EN == DEF_ENABLED)
+void  OSTaskPeriodSet (OS_TCB   *p_tcb,
+                       OS_TICK   period,
+                       OS_TICK   phase,
+                       OS_TICK   deadline,
+                       OS_ERR   *p_err)
+{
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    CPU_TS            period_ts;
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+    CPU_TS_TMR_FREQ   ts_freq;
+    CPU_ERR           cpu_err;
+#endif
+#endif
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't call this function from an ISR                 */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (deadline > period) {                                    /* The deadline can't be past the next release          */
+       *p_err = OS_ERR_TASK_PERIOD_INVALID;
+        return;
+    }
+#endif
+
+    if (deadline == 0u) {
+        deadline = period;
+    }
+
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+#if (CPU_CFG_TS_TMR_EN == DEF_ENABLED)
+    ts_freq   = CPU_TS_TmrFreqGet(&cpu_err);                    /* Period in CPU_TS units, for the jitter statistics    */
+    period_ts = (CPU_TS)(((CPU_INT64U)ts_freq * period) / OSCfg_TickRate_Hz);
+#else
+    period_ts = 0u;
+#endif
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {
+        p_tcb = OSTCBCurPtr;
+    }
+
+    p_tcb->PeriodTicks      = period;
+    p_tcb->PeriodDeadline   = deadline;
+#if (OS_CFG_DYN_TICK_EN == DEF_ENABLED)
+    p_tcb->PeriodRelease    = BSP_OS_TickGet() + phase;         /* First release                                        */
+#else
+    p_tcb->PeriodRelease    = OSTickCtr        + phase;
+#endif
+    p_tcb->PeriodJobCtr     = 0u;
+    p_tcb->PeriodOverrunCtr = 0u;
+    p_tcb->PeriodSkipCtr    = 0u;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    p_tcb->PeriodTS         = period_ts;
+    p_tcb->PeriodJitter     = 0u;
+    p_tcb->PeriodJitterMax  = 0u;
+    p_tcb->PeriodJitterTot  = 0u;
+#endif
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    OS_EdfDeadlineSet(p_tcb, p_tcb->PeriodRelease + deadline);  /* Deadline of the first job                            */
+#endif
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                             WAIT FOR THE NEXT RELEASE
+*
+* Description: This function is called by a periodic task (see OSTaskPeriodSet()) at the end of each job.  The task
+*              is delayed until its next release.
+*
+* Arguments  : p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                 The call was successful
+*                              OS_ERR_OS_NOT_RUNNING       If uC/OS-III is not running yet
+*                              OS_ERR_SCHED_LOCKED         Can't delay when the scheduler is locked
+*                              OS_ERR_TASK_NOT_PERIODIC    If the calling task is not periodic
+*                              OS_ERR_TIME_DLY_ISR         If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) A job that calls OSTaskPeriodWait() 'deadline' ticks or more after its release increments
+*                 .PeriodOverrunCtr.
+*
+*              2) If the next release has already passed, the task is not delayed: it runs the latest release that
+*                 has passed and the releases missed in between are added to .PeriodSkipCtr.  The phase of the task
+*                 is kept.
+*
+*              3) The release jitter of a job is the difference between the time elapsed since the start of the
+*                 previous job, as read from the CPU timestamp timer, and the nominal period.  The last, peak and
+*                 accumulated jitters are kept in .PeriodJitter, .PeriodJitterMax and .PeriodJitterTot (in CPU_TS
+*                 units).
+*
+*              4) The scheduler also runs when the task is not delayed: with OS_CFG_SCHED_EDF_EN, the later deadline
+*                 of the next job may let another task of the EDF band run first.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_PERIOD_EN == DEF_ENABLED)
+void  OSTaskPeriodWait (OS_ERR  *p_err)
+{
+    OS_TCB       *p_tcb;
+    OS_TICK       tick_ctr;
+    OS_TICK       release;
+    OS_TICK       skip;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    CPU_TS        ts;
+    CPU_TS        jitter;
+    CPU_TS        nominal;
+#endif
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Not allowed to call from an ISR                      */
+       *p_err = OS_ERR_TIME_DLY_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+    if (OSSchedLockNestingCtr > 0u) {                           /* Can't delay when the scheduler is locked             */
+       *p_err = OS_ERR_SCHED_LOCKED;
+        return;
+    }
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = OSTCBCurPtr;
+    if (p_tcb->PeriodTicks == 0u) {
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_TASK_NOT_PERIODIC;
+        return;
+    }
+
+#if (OS_CFG_DYN_TICK_EN == DEF_ENABLED)
+    tick_ctr = BSP_OS_TickGet();
+#else
+    tick_ctr = OSTickCtr;
+#endif
+    release  = p_tcb->PeriodRelease;
+    if (p_tcb->PeriodJobCtr > 0u) {                             /* The first call only waits for the first release      */
+        if ((tick_ctr - release) >= p_tcb->PeriodDeadline) {    /* See Note #1.                                         */
+            p_tcb->PeriodOverrunCtr++;
+        }
+        release += p_tcb->PeriodTicks;
+    }
+
+    skip = 0u;
+    OS_TickListInsertDly(p_tcb,                                 /* Wait for the absolute release tick                   */
+                         release,
+                         OS_OPT_TIME_MATCH,
+                         p_err);
+    if (*p_err == OS_ERR_NONE) {
+        OS_TRACE_TASK_DLY(release - tick_ctr);
+        OS_RdyListRemove(p_tcb);
+    } else {                                                    /* Release already passed, see Note #2.                 */
+        skip     = (tick_ctr - release) / p_tcb->PeriodTicks;
+        release += skip * p_tcb->PeriodTicks;
+        p_tcb->PeriodSkipCtr += skip;
+    }
+    p_tcb->PeriodRelease = release;
+    p_tcb->PeriodJobCtr++;
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    OS_EdfDeadlineSet(p_tcb, release + p_tcb->PeriodDeadline);  /* Deadline of the next job                             */
+#endif
+    CPU_CRITICAL_EXIT();
+
+    OSSched();                                                  /* Find next task to run (see Note #4)                */
+
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    ts = OS_TS_GET();                                           /* See Note #3.                                         */
+    if (p_tcb->PeriodJobCtr > 1u) {
+        nominal = p_tcb->PeriodTS * (CPU_TS)(skip + 1u);
+        jitter  = ts - p_tcb->PeriodStartTS;
+        if (jitter > nominal) {
+            jitter -= nominal;
+        } else {
+            jitter  = nominal - jitter;
+        }
+        p_tcb->PeriodJitter     = jitter;
+        p_tcb->PeriodJitterTot += jitter;
+        if (p_tcb->PeriodJitterMax < jitter) {
+            p_tcb->PeriodJitterMax = jitter;
+        }
+    }
+    p_tcb->PeriodStartTS = ts;
+#endif
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                                    FLUSH TASK's QUEUE
@@ -1058,7 +1555,9 @@ CPU_BOOLEAN  OSTaskQPendAbort (OS_TCB  *p_tcb,
 *
 * Returns    : none
 *
-* Note(s)    : none
+* Note(s)    : 1) The OS_MSGs come from the global pool, shared with the other queues, unless the task was given its own
+*                 slots by OSTaskQSlotsSet().  Task queues only carry pointers: unlike a queue created by
+*                 OSQCreateSlots(), the data pointed to is never copied and MUST remain valid until the task reads it.
 ************************************************************************************************************************
 */
 
@@ -1107,11 +1606,29 @@ void  OSTaskQPost (OS_TCB       *p_tcb,
 #endif
 
 #if (OS_CFG_TS_EN == DEF_ENABLED)
-    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+    ts = OS_POST_TS_GET();                                      /* Get timestamp                                        */
 #else
     ts = 0u;
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Called from an ISR?                                  */
+        if (p_tcb == (OS_TCB *)0) {                             /* Post to 'self', i.e. to the task interrupted         */
+            p_tcb = OSTCBCurPtr;
+        }
+        OS_IntQPost(OS_OBJ_TYPE_TASK_MSG,                       /* Yes, defer the post to the ISR handler task        */
+                    (void *)p_tcb,
+                    p_void,
+                    msg_size,
+                    0u,
+                    opt,
+                    ts,
+                    p_err);
+        OS_TRACE_TASK_MSG_Q_POST_EXIT(*p_err);
+        return;
+    }
+#endif
+
     OS_TRACE_TASK_MSG_Q_POST(&p_tcb->MsgQ);
 
    *p_err = OS_ERR_NONE;                                        /* Assume we won't have any errors                      */
@@ -1169,6 +1686,103 @@ void  OSTaskQPost (OS_TCB       *p_tcb,
 #endif
 
 
+/*
+************************************************************************************************************************
+*                                            GIVE A TASK'S QUEUE ITS OWN SLOTS
+*
+* Description: This function makes a task's message queue take its OS_MSGs from a slot array supplied by the caller
+*              instead of the global pool of OS_MSGs, so it can't run out of OS_MSGs because of another queue.
+*
+* Arguments  : p_tcb       is a pointer to the task's OS_TCB.  Specifying a NULL pointer indicates that you wish to
+*                          set the slots of the calling task.
+*
+*              p_msg_tbl   is a pointer to an array of 'max_qty' OS_MSGs used as the slots of the queue
+*
+*              max_qty     is the maximum size of the task's queue (must be non-zero).  It replaces the 'q_size'
+*                          given to OSTaskCreate().
+*
+*              p_err       is a pointer to a variable that will contain an error code returned by this function.
+*
+*                              OS_ERR_NONE                 The call was successful
+*                              OS_ERR_MSG_POOL_NULL_PTR    If you passed a NULL pointer for 'p_msg_tbl'
+*                              OS_ERR_OS_NOT_RUNNING       If uC/OS-III is not running yet
+*                              OS_ERR_Q_NOT_EMPTY          If the task's queue holds messages
+*                              OS_ERR_Q_SIZE               If the size you specified is 0
+*                              OS_ERR_SET_ISR              If you called this function from an ISR
+*
+* Returns    : none
+*
+* Note(s)    : 1) Call this function after OSTaskCreate() & before posting to the task.  The slots are used until the
+*                 task is deleted; OSTaskCreate() gives a new task the global pool again.
+*
+*              2) The slots only hold pointers (see 'OSTaskQPost()  Note #1').  Each task with its own slots needs
+*                 OS_CFG_TASK_Q_SLOT_EN, which adds an OS_MSG_POOL to every OS_TCB.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_Q_EN == DEF_ENABLED) && (OS_CFG_TASK_Q_SLOT_EN == DEF_ENABLED)
+void  OSTaskQSlotsSet (OS_TCB      *p_tcb,
+                       OS_MSG      *p_msg_tbl,
+                       OS_MSG_QTY   max_qty,
+                       OS_ERR      *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+#ifdef OS_SAFETY_CRITICAL
+    if (p_err == (OS_ERR *)0) {
+        OS_SAFETY_CRITICAL_EXCEPTION();
+        return;
+    }
+#endif
+
+#if (OS_CFG_CALLED_FROM_ISR_CHK_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Can't set the slots from an ISR                      */
+       *p_err = OS_ERR_SET_ISR;
+        return;
+    }
+#endif
+
+#if (OS_CFG_INVALID_OS_CALLS_CHK_EN == DEF_ENABLED)             /* Is the kernel running?                               */
+    if (OSRunning != OS_STATE_OS_RUNNING) {
+       *p_err = OS_ERR_OS_NOT_RUNNING;
+        return;
+    }
+#endif
+
+#if (OS_CFG_ARG_CHK_EN == DEF_ENABLED)
+    if (p_msg_tbl == (OS_MSG *)0) {                             /* Validate the slots                                   */
+       *p_err = OS_ERR_MSG_POOL_NULL_PTR;
+        return;
+    }
+    if (max_qty == 0u) {                                        /* Cannot specify a zero size queue                     */
+       *p_err = OS_ERR_Q_SIZE;
+        return;
+    }
+#endif
+
+    CPU_CRITICAL_ENTER();
+    if (p_tcb == (OS_TCB *)0) {                                 /* Set the slots of the calling task?                   */
+        p_tcb = OSTCBCurPtr;
+    }
+    if (p_tcb->MsgQ.NbrEntries > 0u) {                          /* Messages MUST go back to the pool they came from     */
+        CPU_CRITICAL_EXIT();
+       *p_err = OS_ERR_Q_NOT_EMPTY;
+        return;
+    }
+    OS_MsgPoolCreate(&p_tcb->MsgPool,
+                      p_msg_tbl,
+                      max_qty,
+                      (void *)0,                                /* Pointers only (see Note #2)                          */
+                      0u);
+    p_tcb->MsgQ.PoolPtr        = &p_tcb->MsgPool;
+    p_tcb->MsgQ.NbrEntriesSize =  max_qty;
+    CPU_CRITICAL_EXIT();
+   *p_err = OS_ERR_NONE;
+}
+#endif
+
+
 /*
 ************************************************************************************************************************
 *                                       GET THE CURRENT VALUE OF A TASK REGISTER
@@ -1839,11 +2453,29 @@ OS_SEM_CTR  OSTaskSemPost (OS_TCB  *p_tcb,
 #endif
 
 #if (OS_CFG_TS_EN == DEF_ENABLED)
-    ts = OS_TS_GET();                                           /* Get timestamp                                        */
+    ts = OS_POST_TS_GET();                                      /* Get timestamp                                        */
 #else
     ts = 0u;
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (OSIntNestingCtr > 0u) {                                 /* Called from an ISR?                                  */
+        if (p_tcb == (OS_TCB *)0) {                             /* Post to 'self', i.e. to the task interrupted         */
+            p_tcb = OSTCBCurPtr;
+        }
+        OS_IntQPost(OS_OBJ_TYPE_TASK_SIGNAL,                    /* Yes, defer the post to the ISR handler task        */
+                    (void *)p_tcb,
+                    (void *)0,
+                    0u,
+                    0u,
+                    opt,
+                    ts,
+                    p_err);
+        OS_TRACE_TASK_SEM_POST_EXIT(*p_err);
+        return (0u);
+    }
+#endif
+
     OS_TRACE_TASK_SEM_POST(p_tcb);
 
     CPU_CRITICAL_ENTER();
@@ -2191,6 +2823,13 @@ void   OSTaskSuspend (OS_TCB  *p_tcb,
     }
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+    if (p_tcb == &OSIntQTaskTCB) {                              /* Make sure not suspending the ISR handler task        */
+       *p_err = OS_ERR_TASK_SUSPEND_INT_HANDLER;
+        return;
+    }
+#endif
+
     OS_TRACE_TASK_SUSPEND(p_tcb);
 
     CPU_CRITICAL_ENTER();
@@ -2412,6 +3051,10 @@ void  OS_TaskInit (OS_ERR  *p_err)
 
     OSTaskQty        = 0u;                                      /* Clear the number of tasks                            */
 
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+    OSTaskBudgetListPtr = (OS_TCB *)0;
+#endif
+
 #if ((OS_CFG_TASK_PROFILE_EN == DEF_ENABLED) || (OS_CFG_DBG_EN == DEF_ENABLED))
     OSTaskCtxSwCtr   = 0u;                                      /* Clear the context switch counter                     */
 #endif
@@ -2494,6 +3137,9 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 #if (OS_CFG_FLAG_EN == DEF_ENABLED)
     p_tcb->FlagsPend            =                     0u;
     p_tcb->FlagsOpt             =                     0u;
+#if (OS_CFG_FLAG_IDX_EN == DEF_ENABLED)
+    p_tcb->FlagsIdxSlot         =  OS_FLAG_IDX_SLOT_NONE;
+#endif
     p_tcb->FlagsRdy             =                     0u;
 #endif
 
@@ -2515,6 +3161,9 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
 #endif
 
     p_tcb->SemCtr               =                     0u;
+#if (OS_CFG_SEM_BATCH_EN == DEF_ENABLED)
+    p_tcb->SemPendCnt           =                     0u;
+#endif
 #if (OS_CFG_TASK_PROFILE_EN == DEF_ENABLED)
     p_tcb->SemPendTime          =                     0u;
     p_tcb->SemPendTimeMax       =                     0u;
@@ -2541,6 +3190,43 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->TickCtrPrev          =                     0u;
 #endif
 
+#if (OS_CFG_SCHED_EDF_EN == DEF_ENABLED)
+    p_tcb->EdfDeadline          =                     0u;
+    p_tcb->EdfHeapIx            =   OS_EDF_HEAP_IX_NONE;
+#endif
+
+#if (OS_CFG_TASK_PERIOD_EN == DEF_ENABLED)
+    p_tcb->PeriodTicks          =                     0u;
+    p_tcb->PeriodDeadline       =                     0u;
+    p_tcb->PeriodRelease        =                     0u;
+    p_tcb->PeriodJobCtr         =                     0u;
+    p_tcb->PeriodOverrunCtr     =                     0u;
+    p_tcb->PeriodSkipCtr        =                     0u;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    p_tcb->PeriodTS             =                     0u;
+    p_tcb->PeriodStartTS        =                     0u;
+    p_tcb->PeriodJitter         =                     0u;
+    p_tcb->PeriodJitterMax      =                     0u;
+    p_tcb->PeriodJitterTot      =                     0u;
+#endif
+#endif
+
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+    p_tcb->BudgetNextPtr        = (OS_TCB           *)0;
+    p_tcb->BudgetTicks          =                     0u;
+    p_tcb->BudgetPeriod         =                     0u;
+    p_tcb->BudgetRemain         =                     0u;
+    p_tcb->BudgetReplenishCtr   =                     0u;
+    p_tcb->BudgetOverrunTicks   =                     0u;
+    p_tcb->BudgetOverrunCtr     =                     0u;
+    p_tcb->BudgetOpt            =      OS_OPT_TASK_NONE;
+    p_tcb->BudgetPrio           =                     0u;
+#if (OS_CFG_MUTEX_EN != DEF_ENABLED)
+    p_tcb->BudgetPrioSave       =                     0u;
+#endif
+    p_tcb->BudgetThrottled      =             DEF_FALSE;
+#endif
+
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
     p_tcb->TimeQuanta           =                     0u;
     p_tcb->TimeQuantaCtr        =                     0u;
@@ -2569,8 +3255,15 @@ void  OS_TaskInitTCB (OS_TCB  *p_tcb)
     p_tcb->PendNextPtr          = (OS_TCB           *)0;
     p_tcb->PendPrevPtr          = (OS_TCB           *)0;
     p_tcb->PendObjPtr           = (OS_PEND_OBJ      *)0;
+#if (OS_CFG_PEND_LIST_BUCKET_EN == DEF_ENABLED)
+    p_tcb->PendPrio             = (OS_PRIO           )0;
+#endif
     p_tcb->PendOn               =  OS_TASK_PEND_ON_NOTHING;
     p_tcb->PendStatus           =  OS_STATUS_PEND_OK;
+#if (OS_CFG_PEND_MULTI_EN == DEF_ENABLED)
+    p_tcb->PendDataTblPtr       = (OS_PEND_DATA     *)0;
+    p_tcb->PendDataTblEntries   = (OS_OBJ_QTY        )0;
+#endif
     p_tcb->TaskState            =  OS_TASK_STATE_RDY;
 
     p_tcb->Prio                 =  OS_PRIO_INIT;
@@ -2775,6 +3468,12 @@ void  OS_TaskChangePrio(OS_TCB  *p_tcb,
                           OS_PendListChangePrio(p_tcb);
                           break;
 
+#if (OS_CFG_PEND_MULTI_EN == DEF_ENABLED)
+                     case OS_TASK_PEND_ON_MULTI:
+                          OS_PendMultiChangePrio(p_tcb);
+                          break;
+#endif
+
                      case OS_TASK_PEND_ON_MUTEX:
 #if (OS_CFG_MUTEX_EN == DEF_ENABLED)
                           OS_PendListChangePrio(p_tcb);
@@ -2815,3 +3514,269 @@ void  OS_TaskChangePrio(OS_TCB  *p_tcb,
         p_tcb = p_tcb_owner;
     } while (p_tcb != (OS_TCB *)0);
 }
+
+
+/*
+************************************************************************************************************************
+*                                                CHARGE AND REPLENISH CPU BUDGETS
+*
+* Description: This function is called by OSTimeTick() to charge the interrupted task for 'ticks' ticks of CPU time,
+*              to replenish the budgets whose period elapsed and to enforce the budgets that are exhausted.
+*
+* Arguments  : ticks       is the number of ticks elapsed since the last call
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) A budget is replenished 'period' ticks after the task first used it since the last replenishment
+*                 (sporadic server with a single pending replenishment).
+*
+*              3) A demoted task is demoted again on every tick until its budget is replenished: releasing a mutex
+*                 undoes the priority it inherited, which may have kept it above its demoted priority.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+void  OS_TaskBudgetTick (OS_TICK  ticks)
+{
+    OS_TCB   *p_tcb;
+    OS_TICK   overrun;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    p_tcb = OSTCBCurPtr;
+    if (p_tcb->BudgetTicks > 0u) {                              /* Charge the interrupted task                          */
+        if (p_tcb->BudgetReplenishCtr == 0u) {                  /* See Note #2                                          */
+            p_tcb->BudgetReplenishCtr = p_tcb->BudgetPeriod;
+        }
+        if (p_tcb->BudgetRemain > ticks) {
+            p_tcb->BudgetRemain -= ticks;
+        } else {
+            overrun = ticks - p_tcb->BudgetRemain;
+            if (p_tcb->BudgetRemain > 0u) {                     /* Budget exhausted now                                 */
+                p_tcb->BudgetOverrunCtr++;
+            }
+            p_tcb->BudgetRemain        = 0u;
+            p_tcb->BudgetOverrunTicks += overrun;
+        }
+    }
+
+    p_tcb = OSTaskBudgetListPtr;
+    while (p_tcb != (OS_TCB *)0) {
+        if (p_tcb->BudgetReplenishCtr > 0u) {
+            if (p_tcb->BudgetReplenishCtr > ticks) {
+                p_tcb->BudgetReplenishCtr -= ticks;
+            } else {                                            /* Replenish                                            */
+                p_tcb->BudgetReplenishCtr = 0u;
+                p_tcb->BudgetRemain       = p_tcb->BudgetTicks;
+                if (p_tcb->BudgetThrottled == DEF_TRUE) {
+                    OS_TaskBudgetRelease(p_tcb);
+                }
+            }
+        }
+        if ((p_tcb->BudgetRemain    == 0u) &&                   /* Enforce, see Note #3                                 */
+            ((p_tcb->BudgetThrottled == DEF_FALSE) ||
+             (p_tcb->BudgetOpt       == OS_OPT_TASK_BUDGET_DEMOTE))) {
+            OS_TaskBudgetThrottle(p_tcb);
+        }
+        p_tcb = p_tcb->BudgetNextPtr;
+    }
+    CPU_CRITICAL_EXIT();
+}
+#endif
+
+
+/*
+************************************************************************************************************************
+*                                        ENFORCE / RELEASE A TASK'S CPU BUDGET
+*
+* Description: OS_TaskBudgetThrottle() demotes or suspends a task whose budget is exhausted.  OS_TaskBudgetRelease()
+*              restores its priority or resumes it.
+*
+* Arguments  : p_tcb       is a pointer to the task's OS_TCB
+*
+* Returns    : none
+*
+* Note(s)    : 1) These functions are INTERNAL to uC/OS-III and your application MUST NOT call them.
+*
+*              2) These functions are assumed to be called with interrupts disabled.
+*
+*              3) The running task can't be removed from the ready list while it holds the scheduler lock: the
+*                 suspension is retried at the next tick.
+*
+*              4) A task that owns mutexes is demoted to the numerically lower of its demoted priority and the highest
+*                 priority of its mutex group (waiters and ceilings), see OSTaskBudgetSet() Note #3.  Demoting a task
+*                 that is already demoted only applies this rule again.  OS_TaskBudgetRelease() uses the same rule with
+*                 the base priority instead of the demoted one.
+************************************************************************************************************************
+*/
+
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+void  OS_TaskBudgetThrottle (OS_TCB  *p_tcb)
+{
+    OS_PRIO  prio;
+#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+    OS_PRIO  prio_high;
+#endif
+
+
+    if (p_tcb->BudgetOpt == OS_OPT_TASK_BUDGET_DEMOTE) {
+        prio = p_tcb->BudgetPrio;
+#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+        if (p_tcb->MutexGrpHeadPtr != (OS_MUTEX *)0) {          /* Keep the inherited or ceiling priority, see Note #4  */
+            prio_high = OS_MutexGrpPrioFindHighest(p_tcb);
+            if (prio_high < prio) {
+                prio = prio_high;
+            }
+        }
+#else
+        if (p_tcb->BudgetThrottled == DEF_FALSE) {
+            p_tcb->BudgetPrioSave = p_tcb->Prio;
+        }
+#endif
+        if (p_tcb->Prio < prio) {
+            OS_TaskChangePrio(p_tcb, prio);
+        }
+        p_tcb->BudgetThrottled = DEF_TRUE;
+        return;
+    }
+
+#if (OS_CFG_TASK_SUSPEND_EN == DEF_ENABLED)
+    if ((p_tcb                 == OSTCBCurPtr) &&               /* See Note #3                                          */
+        (OSSchedLockNestingCtr >  0u)) {
+        return;
+    }
+    if (p_tcb->SuspendCtr == (OS_NESTING_CTR)-1) {
+        return;
+    }
+
+    switch (p_tcb->TaskState) {
+        case OS_TASK_STATE_RDY:
+             p_tcb->TaskState = OS_TASK_STATE_SUSPENDED;
+             OS_RdyListRemove(p_tcb);
+             break;
+
+        case OS_TASK_STATE_DLY:
+             p_tcb->TaskState = OS_TASK_STATE_DLY_SUSPENDED;
+             break;
+
+        case OS_TASK_STATE_PEND:
+             p_tcb->TaskState = OS_TASK_STATE_PEND_SUSPENDED;
+             break;
+
+        case OS_TASK_STATE_PEND_TIMEOUT:
+             p_tcb->TaskState = OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED;
+             break;
+
+        case OS_TASK_STATE_SUSPENDED:
+        case OS_TASK_STATE_DLY_SUSPENDED:
+        case OS_TASK_STATE_PEND_SUSPENDED:
+        case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+             break;
+
+        default:
+             return;
+    }
+    p_tcb->SuspendCtr++;
+    p_tcb->BudgetThrottled = DEF_TRUE;
+    OS_TRACE_TASK_SUSPEND(p_tcb);
+#endif
+}
+
+
+void  OS_TaskBudgetRelease (OS_TCB  *p_tcb)
+{
+    OS_PRIO  prio;
+#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+    OS_PRIO  prio_high;
+#endif
+
+
+    p_tcb->BudgetThrottled = DEF_FALSE;
+
+    if (p_tcb->BudgetOpt == OS_OPT_TASK_BUDGET_DEMOTE) {
+#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+        prio = p_tcb->BasePrio;                                 /* Back to the base priority, or to the inherited one,  */
+                                                                /* ... see OS_TaskBudgetThrottle() Note #4              */
+        if (p_tcb->MutexGrpHeadPtr != (OS_MUTEX *)0) {
+            prio_high = OS_MutexGrpPrioFindHighest(p_tcb);
+            if (prio_high < prio) {
+                prio = prio_high;
+            }
+        }
+#else
+        prio = p_tcb->BudgetPrioSave;
+#endif
+        if (prio < p_tcb->Prio) {
+            OS_TaskChangePrio(p_tcb, prio);
+        }
+        return;
+    }
+
+#if (OS_CFG_TASK_SUSPEND_EN == DEF_ENABLED)
+    if (p_tcb->SuspendCtr == 0u) {                              /* Already resumed by OSTaskResume()                    */
+        return;
+    }
+    p_tcb->SuspendCtr--;
+    if (p_tcb->SuspendCtr == 0u) {
+        switch (p_tcb->TaskState) {
+            case OS_TASK_STATE_SUSPENDED:
+                 p_tcb->TaskState = OS_TASK_STATE_RDY;
+                 OS_RdyListInsert(p_tcb);                       /* Insert the task in the ready list                    */
+                 break;
+
+            case OS_TASK_STATE_DLY_SUSPENDED:
+                 p_tcb->TaskState = OS_TASK_STATE_DLY;
+                 break;
+
+            case OS_TASK_STATE_PEND_SUSPENDED:
+                 p_tcb->TaskState = OS_TASK_STATE_PEND;
+                 break;
+
+            case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
+                 p_tcb->TaskState = OS_TASK_STATE_PEND_TIMEOUT;
+                 break;
+
+            default:
+                 break;
+        }
+    }
+    OS_TRACE_TASK_RESUME(p_tcb);
+#endif
+}
+
+
+/*
+************************************************************************************************************************
+*                                    REMOVE A TASK FROM THE LIST OF TASKS WITH A BUDGET
+*
+* Description: This function is called by OSTaskBudgetSet() and OSTaskDel() to unlink a task from OSTaskBudgetListPtr.
+*
+* Arguments  : p_tcb       is a pointer to the task's OS_TCB
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application MUST NOT call it.
+*
+*              2) This function is assumed to be called with interrupts disabled.
+************************************************************************************************************************
+*/
+
+void  OS_TaskBudgetListRemove (OS_TCB  *p_tcb)
+{
+    OS_TCB  **pp_tcb;
+
+
+    pp_tcb = &OSTaskBudgetListPtr;
+    while (*pp_tcb != (OS_TCB *)0) {
+        if (*pp_tcb == p_tcb) {
+           *pp_tcb               = p_tcb->BudgetNextPtr;
+            p_tcb->BudgetNextPtr = (OS_TCB *)0;
+            return;
+        }
+        pp_tcb = &(*pp_tcb)->BudgetNextPtr;
+    }
+}
+#endif
@@ -593,6 +593,10 @@ void  OSTimeTick (void)
     OS_SchedRoundRobin(&OSRdyList[OSPrioCur]);
 #endif
 
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+    OS_TaskBudgetTick(1u);                                      /* Charge and enforce CPU budgets                       */
+#endif
+
 #if (OS_CFG_TMR_EN == DEF_ENABLED)
     OSTmrUpdateCtr--;
     if (OSTmrUpdateCtr == 0u) {
@@ -638,6 +642,10 @@ void OSTimeDynTick (OS_TICK ticks)
     OSTickCtrPend += ticks;
     CPU_CRITICAL_EXIT();
 
+#if (OS_CFG_TASK_BUDGET_EN == DEF_ENABLED)
+    OS_TaskBudgetTick(ticks);                                   /* Charge and enforce CPU budgets                       */
+#endif
+
     (void)OSTaskSemPost(&OSTickTaskTCB,                          /* Signal tick task                                     */
                          OS_OPT_POST_NONE,
                         &err);
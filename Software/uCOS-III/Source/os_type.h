@@ -55,7 +55,11 @@ typedef   CPU_INT32U      OS_CTX_SW_CTR;               /* Counter of context swi
 
 typedef   CPU_INT32U      OS_CYCLES;                   /* CPU clock cycles,                                   <32>/64 */
 
-typedef   CPU_INT32U      OS_FLAGS;                    /* Event flags,                                      8/16/<32> */
+#if (OS_CFG_FLAG_64_EN == DEF_ENABLED)
+typedef   CPU_INT64U      OS_FLAGS;                    /* Event flags,                                   8/16/<32>/64 */
+#else
+typedef   CPU_INT32U      OS_FLAGS;                    /* Event flags,                                   8/16/<32>/64 */
+#endif
 
 typedef   CPU_INT32U      OS_IDLE_CTR;                 /* Holds the number of times the idle task runs,       <32>/64 */
 
@@ -74,7 +78,11 @@ typedef   CPU_INT16U      OS_OPT;                      /* Holds function options
 
 typedef   CPU_INT32U      OS_MON_RES;                  /* Monitor result flags,                                       */
 
+#if (OS_CFG_PRIO_MAX > 255u)                                  /* OS_PRIO_INIT (OS_CFG_PRIO_MAX) must fit as well      */
+typedef   CPU_INT16U      OS_PRIO;                     /* Priority of a task,                               <8>/16/32 */
+#else
 typedef   CPU_INT08U      OS_PRIO;                     /* Priority of a task,                               <8>/16/32 */
+#endif
 
 typedef   CPU_INT16U      OS_QTY;                      /* Quantity                                            <16>/32 */
 
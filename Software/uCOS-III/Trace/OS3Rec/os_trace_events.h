@@ -0,0 +1,302 @@
+/*
+**************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                               BINARY IN-RAM TRACE RECORDER
+*
+* File    : OS_TRACE_EVENTS.H
+* Version : V3.06.01
+**************************************************************************************************************************
+* Note(s) : (1) This file binds the uC/OS-III trace hooks declared in 'os_trace.h' to the in-RAM trace recorder
+*               implemented in 'os_trace_rec.c'.  It is only included when OS_CFG_TRACE_EN is DEF_ENABLED.
+*
+*           (2) Every event is stored as a fixed 8-byte record (see OS_TRACE_REC_EVT) :
+*
+*                   TS      32-bit OS_TS_GET() timestamp (DWT CYCCNT on the MSP432)
+*                   EvtId    8-bit event identifier (OS_TRACE_REC_EVT_xxx)
+*                   Arg08    8-bit event argument (priority, object type, ...)
+*                   Arg16   16-bit object ID, interrupt ID or truncated tick/delay value
+*
+*           (3) Kernel objects and tasks are assigned a 16-bit ID when they are created; the ID is stored in the
+*               xxxID field of the object (see 'os.h') and its name is copied into the recorder's object table so
+*               that a dump is self-describing.  ID 0 denotes an object that was created before the recorder was
+*               initialized or that did not fit in the object table.
+*
+*           (4) The recorder state (OSTraceRec) is laid out so that it can be saved as one block of memory from the
+*               debugger and converted by 'os_trace_rec_conv.py'.  Keep both in sync when changing the layout.
+**************************************************************************************************************************
+*/
+
+#ifndef   OS_TRACE_EVENTS_H
+#define   OS_TRACE_EVENTS_H
+
+
+#include  <cpu.h>
+#include  <cpu_core.h>
+#include  <lib_def.h>
+#include  <os_cfg.h>
+
+
+/*
+**************************************************************************************************************************
+*                                                  DEFAULT CONFIGURATION
+**************************************************************************************************************************
+*/
+
+#ifndef  OS_CFG_TRACE_REC_EVT_NBR
+#define  OS_CFG_TRACE_REC_EVT_NBR              512u             /* Nbr of events in the ring (MUST be a power of 2)      */
+#endif
+
+#ifndef  OS_CFG_TRACE_REC_OBJ_NBR
+#define  OS_CFG_TRACE_REC_OBJ_NBR               16u             /* Nbr of named tasks/objects in the object table        */
+#endif
+
+#ifndef  OS_CFG_TRACE_REC_MODE
+#define  OS_CFG_TRACE_REC_MODE                 OS_TRACE_REC_MODE_OVERWRITE
+#endif
+
+
+/*
+**************************************************************************************************************************
+*                                                        DEFINES
+**************************************************************************************************************************
+*/
+
+#define  OS_TRACE_REC_MAGIC                    0x5233534Fu      /* 'OS3R' in little-endian memory order                  */
+#define  OS_TRACE_REC_VER                          1u
+
+#define  OS_TRACE_REC_OBJ_NAME_LEN                20u
+
+                                                                /* -------------------- RECORDING MODES ---------------- */
+#define  OS_TRACE_REC_MODE_OVERWRITE               0u           /* Ring buffer, oldest events are overwritten            */
+#define  OS_TRACE_REC_MODE_STOP_WHEN_FULL          1u           /* Stop recording once the buffer is full                */
+
+                                                                /* --------------------- OBJECT TYPES ------------------ */
+#define  OS_TRACE_REC_OBJ_TYPE_TASK                1u
+#define  OS_TRACE_REC_OBJ_TYPE_SEM                 2u
+#define  OS_TRACE_REC_OBJ_TYPE_Q                   3u
+#define  OS_TRACE_REC_OBJ_TYPE_FLAG                4u
+#define  OS_TRACE_REC_OBJ_TYPE_MUTEX               5u
+#define  OS_TRACE_REC_OBJ_TYPE_TASK_Q              6u
+#define  OS_TRACE_REC_OBJ_TYPE_MEM                 7u
+
+                                                                /* ------------------------ EVENTS --------------------- */
+#define  OS_TRACE_REC_EVT_OBJ_CREATE            0x01u           /* Arg08 = obj type,   Arg16 = obj ID                    */
+#define  OS_TRACE_REC_EVT_TASK_DEL              0x02u           /*                     Arg16 = task ID                   */
+#define  OS_TRACE_REC_EVT_TASK_READY            0x03u           /* Arg08 = prio,       Arg16 = task ID                   */
+#define  OS_TRACE_REC_EVT_TASK_SWITCHED_IN      0x04u           /* Arg08 = prio,       Arg16 = task ID                   */
+#define  OS_TRACE_REC_EVT_TASK_DLY              0x05u           /*                     Arg16 = dly (ticks, saturated)    */
+#define  OS_TRACE_REC_EVT_TASK_SUSPEND          0x06u           /*                     Arg16 = task ID                   */
+#define  OS_TRACE_REC_EVT_TASK_RESUME           0x07u           /*                     Arg16 = task ID                   */
+#define  OS_TRACE_REC_EVT_TASK_PRIO_CHANGE      0x08u           /* Arg08 = new prio,   Arg16 = task ID                   */
+#define  OS_TRACE_REC_EVT_TASK_PRIO_INHERIT     0x09u           /* Arg08 = new prio,   Arg16 = task ID                   */
+#define  OS_TRACE_REC_EVT_TASK_PRIO_DISINHERIT  0x0Au           /* Arg08 = new prio,   Arg16 = task ID                   */
+
+#define  OS_TRACE_REC_EVT_ISR_BEGIN             0x10u           /*                     Arg16 = BSP interrupt ID          */
+#define  OS_TRACE_REC_EVT_ISR_END               0x11u
+#define  OS_TRACE_REC_EVT_ISR_EXIT_TO_SCHED     0x12u
+#define  OS_TRACE_REC_EVT_TICK                  0x13u           /*                     Arg16 = OSTickCtr (low 16 bits)   */
+
+                                                                /* Object events : OS_TRACE_REC_EVT_OBJ_BASE(type) + op  */
+#define  OS_TRACE_REC_EVT_OBJ_BASE(type)        (CPU_INT08U)(0x20u + (((type) - 1u) * 8u))
+
+#define  OS_TRACE_REC_EVT_OP_POST                  0u           /* Post / put                                            */
+#define  OS_TRACE_REC_EVT_OP_POST_FAILED           1u
+#define  OS_TRACE_REC_EVT_OP_PEND                  2u           /* Pend / get (object available)                         */
+#define  OS_TRACE_REC_EVT_OP_PEND_FAILED           3u
+#define  OS_TRACE_REC_EVT_OP_PEND_BLOCK            4u           /* Pend that blocks the calling task                     */
+#define  OS_TRACE_REC_EVT_OP_DEL                   5u
+
+
+/*
+**************************************************************************************************************************
+*                                                       DATA TYPES
+**************************************************************************************************************************
+*/
+
+typedef  struct  os_trace_rec_evt {                             /* See Note #2.                                          */
+    CPU_TS32             TS;
+    CPU_INT08U           EvtId;
+    CPU_INT08U           Arg08;
+    CPU_INT16U           Arg16;
+} OS_TRACE_REC_EVT;
+
+
+typedef  struct  os_trace_rec_obj {
+    CPU_INT16U           Id;
+    CPU_INT08U           Type;                                  /* OS_TRACE_REC_OBJ_TYPE_xxx                             */
+    CPU_INT08U           Prio;                                  /* Task priority at creation (tasks only)                */
+    CPU_CHAR             Name[OS_TRACE_REC_OBJ_NAME_LEN];
+} OS_TRACE_REC_OBJ;
+
+
+typedef  struct  os_trace_rec {                                 /* See Note #4.                                          */
+    CPU_INT32U           Magic;
+    CPU_INT16U           Ver;
+    CPU_INT16U           ObjNbrMax;
+    CPU_INT32U           EvtNbrMax;
+    CPU_INT32U           TS_FreqHz;                             /* Timestamp frequency, 0 if not yet known               */
+    CPU_INT32U           WrIx;                                  /* Total nbr of events reserved since last clear         */
+    CPU_INT08U           Mode;                                  /* OS_TRACE_REC_MODE_xxx                                 */
+    CPU_BOOLEAN          En;
+    CPU_INT16U           ObjNbr;
+    OS_TRACE_REC_OBJ     ObjTbl[OS_CFG_TRACE_REC_OBJ_NBR];
+    OS_TRACE_REC_EVT     EvtBuf[OS_CFG_TRACE_REC_EVT_NBR];
+} OS_TRACE_REC;
+
+
+/*
+**************************************************************************************************************************
+*                                                    GLOBAL VARIABLES
+**************************************************************************************************************************
+*/
+
+extern  OS_TRACE_REC  OSTraceRec;
+
+
+/*
+**************************************************************************************************************************
+*                                                  FUNCTION PROTOTYPES
+**************************************************************************************************************************
+*/
+
+void        OS_TraceRecInit   (void);
+
+void        OS_TraceRecStart  (void);
+
+void        OS_TraceRecStop   (void);
+
+void        OS_TraceRecClr    (void);
+
+void        OS_TraceRecModeSet(CPU_INT08U   mode);
+
+void        OS_TraceRecEvt    (CPU_INT08U   evt_id,
+                               CPU_INT08U   arg08,
+                               CPU_INT16U   arg16);
+
+CPU_INT16U  OS_TraceRecObjReg (CPU_INT08U   type,
+                               CPU_CHAR    *p_name,
+                               CPU_INT08U   prio);
+
+
+/*
+**************************************************************************************************************************
+*                                                  uC/OS-III TRACE HOOKS
+**************************************************************************************************************************
+*/
+
+                                                                /* 'p_obj' MAY be NULL in the xxx_FAILED() hooks.        */
+#define  OS_TRACE_REC_OBJ_EVT(type, op, p_obj, id_field)                                                                \
+                                                OS_TraceRecEvt((CPU_INT08U)(OS_TRACE_REC_EVT_OBJ_BASE(type) + (op)),     \
+                                                               0u,                                                     \
+                                                               (CPU_INT16U)(((p_obj) == 0) ? 0u : (p_obj)->id_field))
+
+                                                                /* A NULL 'p_tcb' designates the calling task.           */
+#define  OS_TRACE_REC_TASK_ID(p_tcb)            (((p_tcb) == (OS_TCB *)0) ? OSTCBCurPtr->TaskID : (p_tcb)->TaskID)
+
+#define  OS_TRACE_REC_TASK_SEM_EVT(op, p_tcb)   OS_TraceRecEvt((CPU_INT08U)(OS_TRACE_REC_EVT_OBJ_BASE(OS_TRACE_REC_OBJ_TYPE_TASK) + (op)), \
+                                                               0u,                                                     \
+                                                               OS_TRACE_REC_TASK_ID(p_tcb))
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+#define  OS_TRACE_REC_TCB_NAME(p_tcb)           ((p_tcb)->NamePtr)
+#else
+#define  OS_TRACE_REC_TCB_NAME(p_tcb)           ((CPU_CHAR *)0)
+#endif
+
+                                                                /* ------------------ RECORDER CONTROL ----------------- */
+#define  OS_TRACE_INIT()                        OS_TraceRecInit()
+#define  OS_TRACE_START()                       OS_TraceRecStart()
+#define  OS_TRACE_STOP()                        OS_TraceRecStop()
+#define  OS_TRACE_CLEAR()                       OS_TraceRecClr()
+
+                                                                /* --------------------- INTERRUPTS -------------------- */
+#define  OS_TRACE_ISR_BEGIN(isr_id)             OS_TraceRecEvt(OS_TRACE_REC_EVT_ISR_BEGIN, 0u, (CPU_INT16U)(isr_id))
+#define  OS_TRACE_ISR_END()                     OS_TraceRecEvt(OS_TRACE_REC_EVT_ISR_END,   0u, 0u)
+#define  OS_TRACE_ISR_EXIT_TO_SCHEDULER()       OS_TraceRecEvt(OS_TRACE_REC_EVT_ISR_EXIT_TO_SCHED, 0u, 0u)
+#define  OS_TRACE_TICK_INCREMENT(OSTickCtr)     OS_TraceRecEvt(OS_TRACE_REC_EVT_TICK, 0u, (CPU_INT16U)(OSTickCtr))
+
+                                                                /* ------------------------ TASKS ---------------------- */
+#define  OS_TRACE_TASK_CREATE(p_tcb)            do { (p_tcb)->TaskID = OS_TraceRecObjReg(OS_TRACE_REC_OBJ_TYPE_TASK,      \
+                                                                                         OS_TRACE_REC_TCB_NAME(p_tcb),    \
+                                                                                         (CPU_INT08U)(p_tcb)->Prio);      \
+                                                   } while (0)
+#define  OS_TRACE_TASK_SEM_CREATE(p_tcb, p_name) do { (p_tcb)->SemID = (p_tcb)->TaskID; } while (0)
+#define  OS_TRACE_TASK_MSG_Q_CREATE(p_msg_q, p_name)                                                                    \
+                                                do { (p_msg_q)->MsgQID = OS_TraceRecObjReg(OS_TRACE_REC_OBJ_TYPE_TASK_Q,   \
+                                                                                           (p_name), 0u);                \
+                                                   } while (0)
+#define  OS_TRACE_TASK_DEL(p_tcb)               OS_TraceRecEvt(OS_TRACE_REC_EVT_TASK_DEL,      0u, OS_TRACE_REC_TASK_ID(p_tcb))
+#define  OS_TRACE_TASK_READY(p_tcb)             OS_TraceRecEvt(OS_TRACE_REC_EVT_TASK_READY,                             \
+                                                               (CPU_INT08U)(p_tcb)->Prio, (p_tcb)->TaskID)
+#define  OS_TRACE_TASK_SWITCHED_IN(p_tcb)       OS_TraceRecEvt(OS_TRACE_REC_EVT_TASK_SWITCHED_IN,                       \
+                                                               (CPU_INT08U)(p_tcb)->Prio, (p_tcb)->TaskID)
+#define  OS_TRACE_TASK_DLY(dly_ticks)           OS_TraceRecEvt(OS_TRACE_REC_EVT_TASK_DLY, 0u,                           \
+                                                               (CPU_INT16U)(((dly_ticks) > DEF_INT_16U_MAX_VAL) ?        \
+                                                                            DEF_INT_16U_MAX_VAL : (dly_ticks)))
+#define  OS_TRACE_TASK_SUSPEND(p_tcb)           OS_TraceRecEvt(OS_TRACE_REC_EVT_TASK_SUSPEND,  0u, OS_TRACE_REC_TASK_ID(p_tcb))
+#define  OS_TRACE_TASK_RESUME(p_tcb)            OS_TraceRecEvt(OS_TRACE_REC_EVT_TASK_RESUME,   0u, OS_TRACE_REC_TASK_ID(p_tcb))
+#define  OS_TRACE_TASK_PRIO_CHANGE(p_tcb, prio) OS_TraceRecEvt(OS_TRACE_REC_EVT_TASK_PRIO_CHANGE,                       \
+                                                               (CPU_INT08U)(prio), OS_TRACE_REC_TASK_ID(p_tcb))
+
+#define  OS_TRACE_TASK_SEM_POST(p_tcb)          OS_TRACE_REC_TASK_SEM_EVT(OS_TRACE_REC_EVT_OP_POST, p_tcb)
+#define  OS_TRACE_TASK_SEM_POST_FAILED(p_tcb)   OS_TRACE_REC_TASK_SEM_EVT(OS_TRACE_REC_EVT_OP_POST_FAILED, p_tcb)
+#define  OS_TRACE_TASK_SEM_PEND(p_tcb)          OS_TRACE_REC_TASK_SEM_EVT(OS_TRACE_REC_EVT_OP_PEND, p_tcb)
+#define  OS_TRACE_TASK_SEM_PEND_FAILED(p_tcb)   OS_TRACE_REC_TASK_SEM_EVT(OS_TRACE_REC_EVT_OP_PEND_FAILED, p_tcb)
+#define  OS_TRACE_TASK_SEM_PEND_BLOCK(p_tcb)    OS_TRACE_REC_TASK_SEM_EVT(OS_TRACE_REC_EVT_OP_PEND_BLOCK, p_tcb)
+
+#define  OS_TRACE_TASK_MSG_Q_POST(p_msg_q)         OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_TASK_Q, OS_TRACE_REC_EVT_OP_POST,        p_msg_q, MsgQID)
+#define  OS_TRACE_TASK_MSG_Q_POST_FAILED(p_msg_q)  OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_TASK_Q, OS_TRACE_REC_EVT_OP_POST_FAILED, p_msg_q, MsgQID)
+#define  OS_TRACE_TASK_MSG_Q_PEND(p_msg_q)         OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_TASK_Q, OS_TRACE_REC_EVT_OP_PEND,        p_msg_q, MsgQID)
+#define  OS_TRACE_TASK_MSG_Q_PEND_FAILED(p_msg_q)  OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_TASK_Q, OS_TRACE_REC_EVT_OP_PEND_FAILED, p_msg_q, MsgQID)
+#define  OS_TRACE_TASK_MSG_Q_PEND_BLOCK(p_msg_q)   OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_TASK_Q, OS_TRACE_REC_EVT_OP_PEND_BLOCK,  p_msg_q, MsgQID)
+
+                                                                /* ---------------------- SEMAPHORES ------------------- */
+#define  OS_TRACE_SEM_CREATE(p_sem, p_name)     do { (p_sem)->SemID = OS_TraceRecObjReg(OS_TRACE_REC_OBJ_TYPE_SEM, (p_name), 0u); } while (0)
+#define  OS_TRACE_SEM_DEL(p_sem)                OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_SEM, OS_TRACE_REC_EVT_OP_DEL,         p_sem, SemID)
+#define  OS_TRACE_SEM_POST(p_sem)               OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_SEM, OS_TRACE_REC_EVT_OP_POST,        p_sem, SemID)
+#define  OS_TRACE_SEM_POST_FAILED(p_sem)        OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_SEM, OS_TRACE_REC_EVT_OP_POST_FAILED, p_sem, SemID)
+#define  OS_TRACE_SEM_PEND(p_sem)               OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_SEM, OS_TRACE_REC_EVT_OP_PEND,        p_sem, SemID)
+#define  OS_TRACE_SEM_PEND_FAILED(p_sem)        OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_SEM, OS_TRACE_REC_EVT_OP_PEND_FAILED, p_sem, SemID)
+#define  OS_TRACE_SEM_PEND_BLOCK(p_sem)         OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_SEM, OS_TRACE_REC_EVT_OP_PEND_BLOCK,  p_sem, SemID)
+
+                                                                /* ------------------- MESSAGE QUEUES ------------------ */
+#define  OS_TRACE_Q_CREATE(p_q, p_name)         do { (p_q)->MsgQ.MsgQID = OS_TraceRecObjReg(OS_TRACE_REC_OBJ_TYPE_Q, (p_name), 0u); } while (0)
+#define  OS_TRACE_Q_DEL(p_q)                    OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_Q, OS_TRACE_REC_EVT_OP_DEL,         p_q, MsgQ.MsgQID)
+#define  OS_TRACE_Q_POST(p_q)                   OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_Q, OS_TRACE_REC_EVT_OP_POST,        p_q, MsgQ.MsgQID)
+#define  OS_TRACE_Q_POST_FAILED(p_q)            OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_Q, OS_TRACE_REC_EVT_OP_POST_FAILED, p_q, MsgQ.MsgQID)
+#define  OS_TRACE_Q_PEND(p_q)                   OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_Q, OS_TRACE_REC_EVT_OP_PEND,        p_q, MsgQ.MsgQID)
+#define  OS_TRACE_Q_PEND_FAILED(p_q)            OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_Q, OS_TRACE_REC_EVT_OP_PEND_FAILED, p_q, MsgQ.MsgQID)
+#define  OS_TRACE_Q_PEND_BLOCK(p_q)             OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_Q, OS_TRACE_REC_EVT_OP_PEND_BLOCK,  p_q, MsgQ.MsgQID)
+
+                                                                /* --------------------- EVENT FLAGS ------------------- */
+#define  OS_TRACE_FLAG_CREATE(p_grp, p_name)    do { (p_grp)->FlagID = OS_TraceRecObjReg(OS_TRACE_REC_OBJ_TYPE_FLAG, (p_name), 0u); } while (0)
+#define  OS_TRACE_FLAG_DEL(p_grp)               OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_FLAG, OS_TRACE_REC_EVT_OP_DEL,         p_grp, FlagID)
+#define  OS_TRACE_FLAG_POST(p_grp)              OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_FLAG, OS_TRACE_REC_EVT_OP_POST,        p_grp, FlagID)
+#define  OS_TRACE_FLAG_POST_FAILED(p_grp)       OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_FLAG, OS_TRACE_REC_EVT_OP_POST_FAILED, p_grp, FlagID)
+#define  OS_TRACE_FLAG_PEND(p_grp)              OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_FLAG, OS_TRACE_REC_EVT_OP_PEND,        p_grp, FlagID)
+#define  OS_TRACE_FLAG_PEND_FAILED(p_grp)       OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_FLAG, OS_TRACE_REC_EVT_OP_PEND_FAILED, p_grp, FlagID)
+#define  OS_TRACE_FLAG_PEND_BLOCK(p_grp)        OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_FLAG, OS_TRACE_REC_EVT_OP_PEND_BLOCK,  p_grp, FlagID)
+
+                                                                /* ----------------------- MUTEXES --------------------- */
+#define  OS_TRACE_MUTEX_CREATE(p_mutex, p_name) do { (p_mutex)->MutexID = OS_TraceRecObjReg(OS_TRACE_REC_OBJ_TYPE_MUTEX, (p_name), 0u); } while (0)
+#define  OS_TRACE_MUTEX_DEL(p_mutex)            OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_MUTEX, OS_TRACE_REC_EVT_OP_DEL,         p_mutex, MutexID)
+#define  OS_TRACE_MUTEX_POST(p_mutex)           OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_MUTEX, OS_TRACE_REC_EVT_OP_POST,        p_mutex, MutexID)
+#define  OS_TRACE_MUTEX_POST_FAILED(p_mutex)    OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_MUTEX, OS_TRACE_REC_EVT_OP_POST_FAILED, p_mutex, MutexID)
+#define  OS_TRACE_MUTEX_PEND(p_mutex)           OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_MUTEX, OS_TRACE_REC_EVT_OP_PEND,        p_mutex, MutexID)
+#define  OS_TRACE_MUTEX_PEND_FAILED(p_mutex)    OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_MUTEX, OS_TRACE_REC_EVT_OP_PEND_FAILED, p_mutex, MutexID)
+#define  OS_TRACE_MUTEX_PEND_BLOCK(p_mutex)     OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_MUTEX, OS_TRACE_REC_EVT_OP_PEND_BLOCK,  p_mutex, MutexID)
+#define  OS_TRACE_MUTEX_TASK_PRIO_INHERIT(p_tcb, prio)      OS_TraceRecEvt(OS_TRACE_REC_EVT_TASK_PRIO_INHERIT,                  \
+                                                                           (CPU_INT08U)(prio), OS_TRACE_REC_TASK_ID(p_tcb))
+#define  OS_TRACE_MUTEX_TASK_PRIO_DISINHERIT(p_tcb, prio)   OS_TraceRecEvt(OS_TRACE_REC_EVT_TASK_PRIO_DISINHERIT,               \
+                                                                           (CPU_INT08U)(prio), OS_TRACE_REC_TASK_ID(p_tcb))
+
+                                                                /* ------------------ MEMORY PARTITIONS ---------------- */
+#define  OS_TRACE_MEM_CREATE(p_mem, p_name)     do { (p_mem)->MemID = OS_TraceRecObjReg(OS_TRACE_REC_OBJ_TYPE_MEM, (p_name), 0u); } while (0)
+#define  OS_TRACE_MEM_PUT(p_mem)                OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_MEM, OS_TRACE_REC_EVT_OP_POST,        p_mem, MemID)
+#define  OS_TRACE_MEM_PUT_FAILED(p_mem)         OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_MEM, OS_TRACE_REC_EVT_OP_POST_FAILED, p_mem, MemID)
+#define  OS_TRACE_MEM_GET(p_mem)                OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_MEM, OS_TRACE_REC_EVT_OP_PEND,        p_mem, MemID)
+#define  OS_TRACE_MEM_GET_FAILED(p_mem)         OS_TRACE_REC_OBJ_EVT(OS_TRACE_REC_OBJ_TYPE_MEM, OS_TRACE_REC_EVT_OP_PEND_FAILED, p_mem, MemID)
+
+#endif
@@ -0,0 +1,276 @@
+/*
+**************************************************************************************************************************
+*                                                      uC/OS-III
+*                                                 The Real-Time Kernel
+*
+*                                               BINARY IN-RAM TRACE RECORDER
+*
+* File    : OS_TRACE_REC.C
+* Version : V3.06.01
+**************************************************************************************************************************
+* Note(s) : (1) Events are written without disabling interrupts : a slot is reserved with CPU_AtomicFetchAdd32() on the
+*               write index and then filled in.  An ISR that preempts a writer between reservation and fill-in simply
+*               takes the next slot, so slots may be (slightly) out of timestamp order; the host converter sorts them.
+*
+*           (2) Task/object registration copies the object name and is expected to happen at creation time only; it
+*               therefore uses a regular critical section.
+*
+*           (3) To analyze a run, halt the target, save 'sizeof(OSTraceRec)' bytes starting at '&OSTraceRec' as a raw
+*               binary file and convert it with 'os_trace_rec_conv.py'.
+**************************************************************************************************************************
+*/
+
+#define  MICRIUM_SOURCE
+#include "os.h"
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const  CPU_CHAR  *os_trace_rec__c = "$Id: $";
+#endif
+
+
+#if (defined(OS_CFG_TRACE_EN) && (OS_CFG_TRACE_EN == DEF_ENABLED))
+
+#if ((OS_CFG_TRACE_REC_EVT_NBR & (OS_CFG_TRACE_REC_EVT_NBR - 1u)) != 0u)
+#error  "OS_CFG_TRACE_REC_EVT_NBR MUST be a power of 2"
+#endif
+
+
+OS_TRACE_REC  OSTraceRec;
+
+
+/*
+**************************************************************************************************************************
+*                                               INITIALIZE THE TRACE RECORDER
+*
+* Description: This function is called by OSInit() through OS_TRACE_INIT() to initialize the recorder.  Recording starts
+*              immediately so that kernel objects created during OSInit() are registered.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) This function is INTERNAL to uC/OS-III and your application should not call it.
+**************************************************************************************************************************
+*/
+
+void  OS_TraceRecInit (void)
+{
+    OSTraceRec.Magic     = OS_TRACE_REC_MAGIC;
+    OSTraceRec.Ver       = OS_TRACE_REC_VER;
+    OSTraceRec.ObjNbrMax = OS_CFG_TRACE_REC_OBJ_NBR;
+    OSTraceRec.EvtNbrMax = OS_CFG_TRACE_REC_EVT_NBR;
+    OSTraceRec.TS_FreqHz = 0u;                                  /* Timestamp timer not started yet (see BSP_Init())     */
+    OSTraceRec.WrIx      = 0u;
+    OSTraceRec.Mode      = OS_CFG_TRACE_REC_MODE;
+    OSTraceRec.ObjNbr    = 0u;
+    OSTraceRec.En        = DEF_TRUE;
+}
+
+
+/*
+**************************************************************************************************************************
+*                                              START/STOP THE TRACE RECORDER
+*
+* Description: OS_TraceRecStart() (re)starts recording and refreshes the timestamp frequency stored in the recorder
+*              header.  OS_TraceRecStop() freezes the buffer so that it can be dumped while the system keeps running.
+*
+* Arguments  : none
+*
+* Returns    : none
+*
+* Note(s)    : 1) Call OS_TRACE_START() once the timestamp timer is initialized (i.e. after BSP_Init()) so that the dump
+*                 carries the correct frequency.
+**************************************************************************************************************************
+*/
+
+void  OS_TraceRecStart (void)
+{
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    CPU_ERR  err;
+
+
+    OSTraceRec.TS_FreqHz = CPU_TS_TmrFreqGet(&err);
+    if (err != CPU_ERR_NONE) {
+        OSTraceRec.TS_FreqHz = 0u;
+    }
+#endif
+    OSTraceRec.En = DEF_TRUE;
+}
+
+
+void  OS_TraceRecStop (void)
+{
+    OSTraceRec.En = DEF_FALSE;
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                 CLEAR THE TRACE BUFFER
+*
+* Description: This function discards all recorded events.  Registered objects are kept.
+*
+* Arguments  : none
+*
+* Returns    : none
+**************************************************************************************************************************
+*/
+
+void  OS_TraceRecClr (void)
+{
+    OS_TRACE_REC_EVT  *p_evt;
+    CPU_INT32U         i;
+    CPU_BOOLEAN        en;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    en              = OSTraceRec.En;
+    OSTraceRec.En   = DEF_FALSE;
+    OSTraceRec.WrIx = 0u;
+    CPU_CRITICAL_EXIT();
+
+    p_evt = &OSTraceRec.EvtBuf[0];
+    for (i = 0u; i < OS_CFG_TRACE_REC_EVT_NBR; i++) {
+        p_evt->EvtId = 0u;                                      /* Event ID 0 marks an unused slot                      */
+        p_evt++;
+    }
+
+    OSTraceRec.En   = en;
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                  SET THE RECORDING MODE
+*
+* Description: This function selects what happens when the trace buffer is full.
+*
+* Arguments  : mode     OS_TRACE_REC_MODE_OVERWRITE         keep the most recent OS_CFG_TRACE_REC_EVT_NBR events
+*                       OS_TRACE_REC_MODE_STOP_WHEN_FULL    keep the first   OS_CFG_TRACE_REC_EVT_NBR events
+*
+* Returns    : none
+*
+* Note(s)    : 1) The buffer is cleared so that a dump never mixes both modes.
+**************************************************************************************************************************
+*/
+
+void  OS_TraceRecModeSet (CPU_INT08U  mode)
+{
+    if ((mode != OS_TRACE_REC_MODE_OVERWRITE) &&
+        (mode != OS_TRACE_REC_MODE_STOP_WHEN_FULL)) {
+        return;
+    }
+    OSTraceRec.Mode = mode;
+    OS_TraceRecClr();
+    OSTraceRec.En   = DEF_TRUE;
+}
+
+
+/*
+**************************************************************************************************************************
+*                                                     RECORD AN EVENT
+*
+* Description: This function stores one 8-byte event in the trace buffer.  It is called by the OS_TRACE_xxx() hooks from
+*              both task and ISR level.
+*
+* Arguments  : evt_id   is the event identifier (see OS_TRACE_REC_EVT_xxx)
+*
+*              arg08    is the 8-bit event argument
+*
+*              arg16    is the 16-bit event argument (object ID, interrupt ID, ...)
+*
+* Returns    : none
+*
+* Note(s)    : 1) See 'os_trace_rec.c  Note #1'.
+**************************************************************************************************************************
+*/
+
+void  OS_TraceRecEvt (CPU_INT08U  evt_id,
+                      CPU_INT08U  arg08,
+                      CPU_INT16U  arg16)
+{
+    OS_TRACE_REC_EVT  *p_evt;
+    CPU_INT32U         ix;
+
+
+    if (OSTraceRec.En != DEF_TRUE) {
+        return;
+    }
+
+    ix = CPU_AtomicFetchAdd32(&OSTraceRec.WrIx, 1u);            /* Reserve a slot (lock-free)                           */
+    if (OSTraceRec.Mode == OS_TRACE_REC_MODE_STOP_WHEN_FULL) {
+        if (ix >= OS_CFG_TRACE_REC_EVT_NBR) {                   /* Buffer full?                                         */
+            OSTraceRec.En = DEF_FALSE;                          /* Yes, stop recording                                  */
+            return;
+        }
+    }
+
+    p_evt        = &OSTraceRec.EvtBuf[ix & (OS_CFG_TRACE_REC_EVT_NBR - 1u)];
+    p_evt->TS    = OS_TS_GET();
+    p_evt->Arg08 = arg08;
+    p_evt->Arg16 = arg16;
+    p_evt->EvtId = evt_id;
+}
+
+
+/*
+**************************************************************************************************************************
+*                                              REGISTER A TASK OR KERNEL OBJECT
+*
+* Description: This function assigns an ID to a newly created task or kernel object, copies its name into the object
+*              table and records an OS_TRACE_REC_EVT_OBJ_CREATE event.
+*
+* Arguments  : type     is the object type (see OS_TRACE_REC_OBJ_TYPE_xxx)
+*
+*              p_name   is a pointer to the object name (MAY be NULL)
+*
+*              prio     is the task priority (tasks only)
+*
+* Returns    : The ID assigned to the object, or 0 if the object table is full.
+**************************************************************************************************************************
+*/
+
+CPU_INT16U  OS_TraceRecObjReg (CPU_INT08U   type,
+                               CPU_CHAR    *p_name,
+                               CPU_INT08U   prio)
+{
+    OS_TRACE_REC_OBJ  *p_obj;
+    CPU_INT16U         id;
+    CPU_INT08U         i;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+    if (OSTraceRec.ObjNbr >= OS_CFG_TRACE_REC_OBJ_NBR) {
+        CPU_CRITICAL_EXIT();
+        OS_TraceRecEvt(OS_TRACE_REC_EVT_OBJ_CREATE, type, 0u);
+        return (0u);
+    }
+    p_obj = &OSTraceRec.ObjTbl[OSTraceRec.ObjNbr];
+    OSTraceRec.ObjNbr++;
+    id    =  OSTraceRec.ObjNbr;                                 /* IDs are 1-based, 0 means 'unknown'                   */
+    CPU_CRITICAL_EXIT();
+
+    p_obj->Type = type;
+    p_obj->Prio = prio;
+    i           = 0u;
+    if (p_name != (CPU_CHAR *)0) {                              /* Copy name, truncated to fit the table entry          */
+        while ((i < (OS_TRACE_REC_OBJ_NAME_LEN - 1u)) &&
+               (p_name[i] != (CPU_CHAR)'\0')) {
+            p_obj->Name[i] = p_name[i];
+            i++;
+        }
+    }
+    while (i < OS_TRACE_REC_OBJ_NAME_LEN) {
+        p_obj->Name[i] = (CPU_CHAR)'\0';
+        i++;
+    }
+    p_obj->Id   = id;
+
+    OS_TraceRecEvt(OS_TRACE_REC_EVT_OBJ_CREATE, type, id);
+
+    return (id);
+}
+
+#endif
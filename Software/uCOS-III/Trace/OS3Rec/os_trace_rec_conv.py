@@ -0,0 +1,329 @@
+#!/usr/bin/env python3
+"""
+uC/OS-III binary trace recorder - dump converter
+
+Converts a memory dump of 'OSTraceRec' (see os_trace_events.h / os_trace_rec.c)
+into the Chrome trace event JSON format, which can be opened in
+chrome://tracing or https://ui.perfetto.dev.
+
+Obtaining a dump (CCS):
+    halt the target, open the Memory Browser, "Save Memory" starting at
+    &OSTraceRec with a length of sizeof(OSTraceRec) bytes, either as raw
+    binary or as "TI Data" (32-bit hex words). Both formats are accepted.
+
+Usage:
+    os_trace_rec_conv.py dump.bin -o trace.json [--ts-freq 48000000] [--summary]
+
+The layout parsed here MUST match OS_TRACE_REC in os_trace_events.h.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+REC_MAGIC = 0x5233534F
+REC_VER = 1
+OBJ_NAME_LEN = 20
+
+HDR_FMT = "<IHHIIIBBH"
+OBJ_FMT = "<HBB%ds" % OBJ_NAME_LEN
+EVT_FMT = "<IBBH"
+
+MODE_OVERWRITE = 0
+
+OBJ_TYPES = {
+    1: "Task",
+    2: "Sem",
+    3: "Q",
+    4: "Flag",
+    5: "Mutex",
+    6: "TaskQ",
+    7: "Mem",
+}
+
+OBJ_OPS = {
+    0: "Post",
+    1: "PostFailed",
+    2: "Pend",
+    3: "PendFailed",
+    4: "PendBlock",
+    5: "Del",
+}
+
+EVT_OBJ_CREATE = 0x01
+EVT_TASK_DEL = 0x02
+EVT_TASK_READY = 0x03
+EVT_TASK_SWITCHED_IN = 0x04
+EVT_TASK_DLY = 0x05
+EVT_TASK_SUSPEND = 0x06
+EVT_TASK_RESUME = 0x07
+EVT_TASK_PRIO_CHANGE = 0x08
+EVT_TASK_PRIO_INHERIT = 0x09
+EVT_TASK_PRIO_DISINHERIT = 0x0A
+EVT_ISR_BEGIN = 0x10
+EVT_ISR_END = 0x11
+EVT_ISR_EXIT_TO_SCHED = 0x12
+EVT_TICK = 0x13
+EVT_OBJ_BASE = 0x20
+
+TASK_EVT_NAMES = {
+    EVT_TASK_DEL: "TaskDel",
+    EVT_TASK_READY: "TaskReady",
+    EVT_TASK_SUSPEND: "TaskSuspend",
+    EVT_TASK_RESUME: "TaskResume",
+    EVT_TASK_PRIO_CHANGE: "TaskPrioChange",
+    EVT_TASK_PRIO_INHERIT: "MutexPrioInherit",
+    EVT_TASK_PRIO_DISINHERIT: "MutexPrioDisinherit",
+}
+
+# BSP_INT_ID_xxx from bsp_int.h
+BSP_INT_NAMES = [
+    "PSS", "CS", "PCM", "WTD", "FPU", "FLCTL", "COMP0", "COMP1",
+    "TA0_0", "TA0_N", "TA1_0", "TA1_N", "TA2_0", "TA2_N", "TA3_0", "TA3_N",
+    "EUSCIA0", "EUSCIA1", "EUSCIA2", "EUSCIA3",
+    "EUSCIB0", "EUSCIB1", "EUSCIB2", "EUSCIB3",
+    "ADC14", "T32_INT1", "T32_INT2", "T32_INTC", "AES", "RTC",
+    "DMA_ERR", "DMA_INT3", "DMA_INT2", "DMA_INT1", "DMA_INT0",
+    "PORT1", "PORT2", "PORT3", "PORT4", "PORT5", "PORT6",
+]
+
+PID = 1
+TID_ISR = 1
+TID_TASK_BASE = 100
+
+
+def load_dump(path):
+    """Return the raw bytes of a binary or TI Data (.dat) memory dump."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != b"1651":
+        return data
+    words = []
+    for line in data.decode("ascii", "replace").splitlines()[1:]:
+        line = line.strip()
+        if line:
+            words.append(int(line, 16))
+    return struct.pack("<%dI" % len(words), *words)
+
+
+def parse(data):
+    hdr_size = struct.calcsize(HDR_FMT)
+    (magic, ver, obj_nbr_max, evt_nbr_max, ts_freq, wr_ix,
+     mode, _en, obj_nbr) = struct.unpack_from(HDR_FMT, data, 0)
+    if magic != REC_MAGIC:
+        raise ValueError("bad magic 0x%08X, not an OSTraceRec dump" % magic)
+    if ver != REC_VER:
+        raise ValueError("unsupported recorder version %d" % ver)
+
+    objs = {}
+    off = hdr_size
+    obj_size = struct.calcsize(OBJ_FMT)
+    for i in range(min(obj_nbr, obj_nbr_max)):
+        oid, otype, prio, name = struct.unpack_from(OBJ_FMT, data, off + i * obj_size)
+        name = name.split(b"\0", 1)[0].decode("ascii", "replace")
+        objs[oid] = (otype, prio, name)
+    off += obj_nbr_max * obj_size
+
+    evt_size = struct.calcsize(EVT_FMT)
+    if len(data) < off + evt_nbr_max * evt_size:
+        raise ValueError("dump truncated: need %d bytes, got %d"
+                         % (off + evt_nbr_max * evt_size, len(data)))
+
+    if mode == MODE_OVERWRITE and wr_ix > evt_nbr_max:
+        first, count = wr_ix - evt_nbr_max, evt_nbr_max
+    else:
+        first, count = 0, min(wr_ix, evt_nbr_max)
+
+    evts = []
+    for n in range(count):
+        slot = (first + n) % evt_nbr_max
+        ts, evt_id, arg08, arg16 = struct.unpack_from(EVT_FMT, data, off + slot * evt_size)
+        if evt_id != 0:
+            evts.append((ts, evt_id, arg08, arg16))
+    return ts_freq, objs, unwrap(evts)
+
+
+def unwrap(evts):
+    """Extend the 32-bit timestamps to 64 bits and sort by time.
+
+    Slots are only approximately ordered (an ISR may take a slot between the
+    reservation and the timestamp of a preempted writer), so each timestamp is
+    unwrapped relative to the previous one using a signed 32-bit delta.
+    """
+    out = []
+    prev = None
+    for ts, evt_id, arg08, arg16 in evts:
+        if prev is None:
+            t = ts
+        else:
+            delta = (ts - prev) & 0xFFFFFFFF
+            if delta >= 0x80000000:
+                delta -= 0x100000000
+            t = prev + delta
+        prev = t
+        out.append((t, evt_id, arg08, arg16))
+    out.sort(key=lambda e: e[0])
+    return out
+
+
+def obj_name(objs, oid, dflt_type="Obj"):
+    if oid in objs:
+        otype, _prio, name = objs[oid]
+        return name or "%s#%d" % (OBJ_TYPES.get(otype, dflt_type), oid)
+    return "%s#%d" % (dflt_type, oid)
+
+
+def isr_name(isr_id):
+    if isr_id < len(BSP_INT_NAMES):
+        return BSP_INT_NAMES[isr_id]
+    return "IRQ%d" % isr_id
+
+
+def convert(ts_freq, objs, evts):
+    us_per_cnt = 1e6 / ts_freq
+    t0 = evts[0][0] if evts else 0
+    out = []
+    stats = {"isr": {}, "task": {}}
+
+    def us(t):
+        return (t - t0) * us_per_cnt
+
+    def meta(tid, name, sort):
+        out.append({"ph": "M", "pid": PID, "tid": tid, "name": "thread_name",
+                    "args": {"name": name}})
+        out.append({"ph": "M", "pid": PID, "tid": tid, "name": "thread_sort_index",
+                    "args": {"sort_index": sort}})
+
+    out.append({"ph": "M", "pid": PID, "name": "process_name",
+                "args": {"name": "uC/OS-III"}})
+    meta(TID_ISR, "Interrupts", 0)
+    for oid, (otype, prio, _name) in sorted(objs.items()):
+        if otype == 1:
+            meta(TID_TASK_BASE + oid, "%s (prio %d)" % (obj_name(objs, oid, "Task"), prio),
+                 1 + prio)
+
+    cur_task = None
+    cur_start = None
+    isr_stack = []
+
+    def ctx_tid():
+        if isr_stack:
+            return TID_ISR
+        if cur_task is not None:
+            return TID_TASK_BASE + cur_task
+        return TID_ISR
+
+    def instant(t, name, tid, args=None):
+        e = {"ph": "i", "s": "t", "pid": PID, "tid": tid, "ts": us(t), "name": name}
+        if args:
+            e["args"] = args
+        out.append(e)
+
+    for t, evt_id, arg08, arg16 in evts:
+        if evt_id == EVT_TASK_SWITCHED_IN:
+            if cur_task is not None:
+                out.append({"ph": "E", "pid": PID, "tid": TID_TASK_BASE + cur_task, "ts": us(t)})
+                s = stats["task"].setdefault(cur_task, [0, 0])
+                s[0] += 1
+                s[1] += t - cur_start
+            cur_task, cur_start = arg16, t
+            out.append({"ph": "B", "pid": PID, "tid": TID_TASK_BASE + arg16, "ts": us(t),
+                        "name": obj_name(objs, arg16, "Task"), "args": {"prio": arg08}})
+        elif evt_id == EVT_ISR_BEGIN:
+            isr_stack.append((arg16, t))
+            out.append({"ph": "B", "pid": PID, "tid": TID_ISR, "ts": us(t),
+                        "name": isr_name(arg16)})
+        elif evt_id == EVT_ISR_END:
+            if isr_stack:
+                isr_id, t_begin = isr_stack.pop()
+                out.append({"ph": "E", "pid": PID, "tid": TID_ISR, "ts": us(t)})
+                s = stats["isr"].setdefault(isr_id, [0, 0, 0])
+                s[0] += 1
+                s[1] += t - t_begin
+                s[2] = max(s[2], t - t_begin)
+        elif evt_id == EVT_ISR_EXIT_TO_SCHED:
+            instant(t, "IntExitToSched", TID_ISR)
+        elif evt_id == EVT_TICK:
+            instant(t, "Tick", TID_ISR, {"ctr": arg16})
+        elif evt_id == EVT_OBJ_CREATE:
+            instant(t, "Create %s" % obj_name(objs, arg16, OBJ_TYPES.get(arg08, "Obj")),
+                    ctx_tid(), {"type": OBJ_TYPES.get(arg08, arg08), "id": arg16})
+        elif evt_id == EVT_TASK_DLY:
+            instant(t, "TaskDly", ctx_tid(), {"ticks": arg16})
+        elif evt_id in TASK_EVT_NAMES:
+            instant(t, "%s %s" % (TASK_EVT_NAMES[evt_id], obj_name(objs, arg16, "Task")),
+                    ctx_tid(), {"prio": arg08, "id": arg16})
+        elif evt_id >= EVT_OBJ_BASE:
+            otype = ((evt_id - EVT_OBJ_BASE) >> 3) + 1
+            op = (evt_id - EVT_OBJ_BASE) & 7
+            tname = OBJ_TYPES.get(otype, "Obj")
+            if otype == 1:
+                tname = "TaskSem"
+                name = obj_name(objs, arg16, "Task")
+            else:
+                name = obj_name(objs, arg16, tname)
+            instant(t, "%s%s %s" % (tname, OBJ_OPS.get(op, "Op%d" % op), name), ctx_tid(),
+                    {"id": arg16})
+        else:
+            instant(t, "Evt 0x%02X" % evt_id, ctx_tid(), {"arg08": arg08, "arg16": arg16})
+
+    if evts:
+        t_end = evts[-1][0]
+        if cur_task is not None:
+            out.append({"ph": "E", "pid": PID, "tid": TID_TASK_BASE + cur_task, "ts": us(t_end)})
+        for _ in isr_stack:
+            out.append({"ph": "E", "pid": PID, "tid": TID_ISR, "ts": us(t_end)})
+
+    return {"traceEvents": out, "displayTimeUnit": "ns"}, stats
+
+
+def print_summary(ts_freq, objs, evts, stats, f):
+    span = (evts[-1][0] - evts[0][0]) if evts else 0
+    f.write("events: %d, span: %.3f ms @ %d Hz\n" % (len(evts), span * 1e3 / ts_freq, ts_freq))
+    f.write("\n%-12s %8s %12s %10s %10s\n" % ("ISR", "count", "total [us]", "avg [us]", "max [us]"))
+    for isr_id, (cnt, tot, mx) in sorted(stats["isr"].items(), key=lambda kv: -kv[1][1]):
+        f.write("%-12s %8d %12.1f %10.2f %10.2f\n"
+                % (isr_name(isr_id), cnt, tot * 1e6 / ts_freq,
+                   tot * 1e6 / ts_freq / cnt, mx * 1e6 / ts_freq))
+    f.write("\n%-20s %8s %12s %8s\n" % ("Task", "slices", "total [us]", "load"))
+    for oid, (cnt, tot) in sorted(stats["task"].items(), key=lambda kv: -kv[1][1]):
+        f.write("%-20s %8d %12.1f %7.1f%%\n"
+                % (obj_name(objs, oid, "Task"), cnt, tot * 1e6 / ts_freq,
+                   (100.0 * tot / span) if span else 0.0))
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Convert an OSTraceRec memory dump to Chrome trace JSON")
+    ap.add_argument("dump", help="raw binary or TI Data memory dump of OSTraceRec")
+    ap.add_argument("-o", "--output", default="-", help="output JSON file (default: stdout)")
+    ap.add_argument("--ts-freq", type=int, default=0,
+                    help="timestamp frequency in Hz if the dump does not carry one")
+    ap.add_argument("--summary", action="store_true",
+                    help="print per-ISR and per-task timing statistics to stderr")
+    args = ap.parse_args()
+
+    try:
+        ts_freq, objs, evts = parse(load_dump(args.dump))
+    except (ValueError, struct.error) as e:
+        sys.exit("%s: %s" % (args.dump, e))
+
+    if args.ts_freq:
+        ts_freq = args.ts_freq
+    if ts_freq == 0:
+        sys.exit("%s: timestamp frequency unknown, use --ts-freq" % args.dump)
+
+    trace, stats = convert(ts_freq, objs, evts)
+
+    if args.output == "-":
+        json.dump(trace, sys.stdout)
+    else:
+        with open(args.output, "w") as f:
+            json.dump(trace, f)
+
+    if args.summary:
+        print_summary(ts_freq, objs, evts, stats, sys.stderr)
+
+
+if __name__ == "__main__":
+    main()